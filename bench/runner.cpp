@@ -0,0 +1,407 @@
+/*
+ *  This file is part of the Avalon programming language
+ * 
+ *  Copyright (c) 2018 Ntwali Bashige Toussaint
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include <functional>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+#include <cstdio>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <map>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "qpp.h"
+
+/* Error */
+#include "error/error.hpp"
+
+/* Front-end */
+#include "scanner/scanner.hpp"
+#include "lexer/lexer.hpp"
+#include "parser/parser.hpp"
+#include "importer/importer.hpp"
+#include "checker/checker.hpp"
+#include "cleaner/cleaner.hpp"
+
+/* Program */
+#include "representer/symtable/gtable.hpp"
+#include "representer/ast/program.hpp"
+#include "representer/ast/expr/literal_expression.hpp"
+
+/* Interpreter */
+#include "interpreter/interpreter.hpp"
+#include "interpreter/qprocessor.hpp"
+#include "interpreter/output_buffer.hpp"
+
+/* Utils */
+#include "utils/file_util.hpp"
+
+
+using namespace avalon;
+
+/*
+ * the outcome of a single benchmark
+ */
+struct result {
+    std::string name;
+    std::size_t iterations;
+    double mean;
+    double min;
+    double max;
+};
+
+/*
+ * the options given on the command line
+ */
+struct options {
+    std::string filter;
+    std::string output;
+    std::string baseline;
+    std::size_t repeat;
+    std::size_t max_qubits;
+    double threshold;
+};
+
+/**
+ * now
+ * returns a monotonic time in seconds
+ */
+static double now() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * measure
+ * runs setup then times run, as many times as asked, and records the result
+ */
+static void measure(const options& opts, std::vector<result>& results, const std::string& name, std::function<void()> setup, std::function<void()> run) {
+    if(opts.filter.empty() == false && name.find(opts.filter) == std::string::npos)
+        return;
+
+    result res;
+    res.name = name;
+    res.iterations = opts.repeat;
+    res.min = 0;
+    res.max = 0;
+    double total = 0;
+    for(std::size_t i = 0; i < opts.repeat; i++) {
+        setup();
+        double start = now();
+        run();
+        double elapsed = now() - start;
+        total += elapsed;
+        res.min = (i == 0) ? elapsed : std::min(res.min, elapsed);
+        res.max = std::max(res.max, elapsed);
+    }
+    res.mean = total / opts.repeat;
+    results.push_back(res);
+    std::cerr << std::left << std::setw(28) << name << std::right << std::fixed << std::setprecision(6) << res.min << " s" << std::endl;
+}
+
+/**
+ * silence
+ * sends the standard output to /dev/null while the interpreter runs, and restores it after.
+ * the program's output buffer is flushed before restoring so its content is discarded too and
+ * the cost of writing it is part of the measured time.
+ */
+static int silence() {
+    std::fflush(stdout);
+    int saved = ::dup(STDOUT_FILENO);
+    int devnull = ::open("/dev/null", O_WRONLY);
+    ::dup2(devnull, STDOUT_FILENO);
+    ::close(devnull);
+    return saved;
+}
+
+static void restore(int saved) {
+    output_buffer::flush();
+    std::fflush(stdout);
+    ::dup2(saved, STDOUT_FILENO);
+    ::close(saved);
+}
+
+/**
+ * bench_program
+ * times every stage of the pipeline on the given program
+ */
+static void bench_program(const options& opts, std::vector<result>& results, const std::string& name, std::vector<std::string>& search_paths) {
+    const std::string source_path = "programs/" + name + ".avl";
+    file_util futil(search_paths);
+    const std::string source_abs_path = futil.get_source_path(source_path);
+    scanner scr(source_abs_path);
+    const std::string source = scr.scan();
+    error error_handler(source_path);
+
+    std::vector<std::shared_ptr<token> > tokens;
+    program prog;
+    gtable gtab;
+    std::vector<std::string> arguments;
+
+    auto do_lex = [&]() {
+        lexer lxr(source_path, source, error_handler);
+        tokens = lxr.lex();
+    };
+    auto do_parse = [&]() {
+        parser psr(tokens, source_path, error_handler);
+        prog = psr.parse();
+    };
+    auto do_import = [&]() {
+        importer ipr(prog, search_paths, error_handler);
+        gtab = ipr.import_all();
+    };
+    auto do_check = [&]() {
+        checker ckr(prog, gtab, source_path, error_handler);
+        ckr.check();
+    };
+    auto do_clean = [&]() {
+        cleaner clr(gtab, error_handler);
+        gtab = clr.clean();
+    };
+
+    measure(opts, results, "lex/" + name, [](){}, do_lex);
+    measure(opts, results, "parse/" + name, do_lex, do_parse);
+    measure(opts, results, "import/" + name, [&](){ do_lex(); do_parse(); }, do_import);
+    measure(opts, results, "check/" + name, [&](){ do_lex(); do_parse(); do_import(); }, do_check);
+    measure(opts, results, "interpret/" + name, [&](){ do_lex(); do_parse(); do_import(); do_check(); do_clean(); }, [&]() {
+        interpreter itr(gtab, error_handler);
+        int saved = silence();
+        try {
+            itr.interpret(arguments);
+        } catch(...) {
+            restore(saved);
+            throw;
+        }
+        restore(saved);
+    });
+}
+
+/*
+ * a fresh quantum processor holding a register of qubits all in the zero state
+ */
+struct circuit {
+    circuit(std::size_t qubits) : m_error_handler("__bench__"), m_qproc(m_error_handler), m_qubits(qubits) {
+        token tok(QUBITS, "0q0", 0, 0, "__bench__");
+        std::shared_ptr<literal_expression> lit = std::make_shared<literal_expression>(tok, QUBIT_EXPR, "0q0");
+        std::pair<qpp::idx, qpp::idx> indices = m_qproc.add_ket(lit, qpp::st.zero(qubits), qubits);
+        lit -> set_start_index(indices.first);
+        lit -> set_end_index(indices.second);
+    }
+
+    error m_error_handler;
+    qprocessor m_qproc;
+    std::size_t m_qubits;
+};
+
+/**
+ * bench_circuits
+ * times the quantum processor on standard circuits of increasing size
+ */
+static void bench_circuits(const options& opts, std::vector<result>& results) {
+    Eigen::Matrix2cd hadamard = qpp::gt.H;
+    Eigen::Matrix2cd pauli_x = qpp::gt.X;
+
+    // the same random rotations are used for every size so runs are comparable
+    std::vector<Eigen::Matrix2cd, Eigen::aligned_allocator<Eigen::Matrix2cd> > rotations;
+    for(std::size_t i = 0; i < 64; i++)
+        rotations.push_back(qpp::randU(2));
+
+    for(std::size_t qubits = 10; qubits <= opts.max_qubits; qubits += 4) {
+        std::unique_ptr<circuit> circ;
+        auto setup = [&]() {
+            circ.reset(nullptr);
+            circ.reset(new circuit(qubits));
+        };
+        std::string size = std::to_string(qubits);
+
+        // GHZ: a hadamard followed by a chain of controlled nots, then a full measurement
+        measure(opts, results, "ghz/" + size, setup, [&]() {
+            circ -> m_qproc.apply(hadamard, 0, 0);
+            for(std::size_t i = 0; i + 1 < qubits; i++)
+                circ -> m_qproc.capply(pauli_x, i, i + 1);
+            circ -> m_qproc.measure(0, qubits - 1);
+        });
+
+        // QFT: hadamards and controlled phase rotations, without the final swaps
+        measure(opts, results, "qft/" + size, setup, [&]() {
+            for(std::size_t j = 0; j < qubits; j++) {
+                circ -> m_qproc.apply(hadamard, j, j);
+                for(std::size_t k = j + 1; k < qubits; k++) {
+                    Eigen::Matrix2cd phase = Eigen::Matrix2cd::Identity();
+                    phase(1, 1) = std::exp(qpp::cplx(0, 2 * qpp::pi / std::pow(2.0, k - j + 1)));
+                    circ -> m_qproc.capply(phase, k, j);
+                }
+            }
+        });
+
+        // random layers: a random rotation on every qubit followed by controlled nots between neighbours
+        measure(opts, results, "random/" + size, setup, [&]() {
+            for(std::size_t layer = 0; layer < 4; layer++) {
+                for(std::size_t i = 0; i < qubits; i++)
+                    circ -> m_qproc.apply(rotations[(layer * qubits + i) % rotations.size()], i, i);
+                for(std::size_t i = layer % 2; i + 1 < qubits; i += 2)
+                    circ -> m_qproc.capply(pauli_x, i, i + 1);
+            }
+        });
+    }
+}
+
+/**
+ * write_json
+ * writes the results as json
+ */
+static void write_json(std::ostream& os, std::vector<result>& results) {
+    os << std::fixed << std::setprecision(9) << "{\"benchmarks\": [" << std::endl;
+    for(std::size_t i = 0; i < results.size(); i++) {
+        result& res = results[i];
+        os << "    {\"name\": \"" << res.name << "\", \"iterations\": " << res.iterations
+           << ", \"mean\": " << res.mean << ", \"min\": " << res.min << ", \"max\": " << res.max << "}"
+           << (i + 1 < results.size() ? "," : "") << std::endl;
+    }
+    os << "]}" << std::endl;
+}
+
+/**
+ * read_baseline
+ * reads the minimum time of each benchmark from a file written by a previous run
+ */
+static std::map<std::string, double> read_baseline(const std::string& path) {
+    std::map<std::string, double> baseline;
+    std::ifstream file(path);
+    std::string line;
+    while(std::getline(file, line)) {
+        std::string::size_type name_pos = line.find("\"name\": \"");
+        std::string::size_type min_pos = line.find("\"min\": ");
+        if(name_pos == std::string::npos || min_pos == std::string::npos)
+            continue;
+        name_pos += 9;
+        std::string name = line.substr(name_pos, line.find('"', name_pos) - name_pos);
+        baseline[name] = std::atof(line.c_str() + min_pos + 7);
+    }
+    return baseline;
+}
+
+/**
+ * compare
+ * compares the results against the baseline and returns the number of regressions
+ */
+static int compare(const options& opts, std::vector<result>& results) {
+    std::map<std::string, double> baseline = read_baseline(opts.baseline);
+    if(baseline.empty()) {
+        std::cerr << "No benchmark found in the baseline <" << opts.baseline << ">." << std::endl;
+        return 1;
+    }
+
+    int regressions = 0;
+    for(auto& res : results) {
+        auto it = baseline.find(res.name);
+        if(it == baseline.end() || it -> second <= 0)
+            continue;
+
+        double change = (res.min - it -> second) / it -> second;
+        bool regressed = change > opts.threshold;
+        if(regressed)
+            regressions++;
+        std::cerr << std::left << std::setw(28) << res.name << std::right << std::fixed << std::setprecision(1)
+                  << std::showpos << change * 100 << "%" << std::noshowpos << (regressed ? "  REGRESSION" : "") << std::endl;
+    }
+    return regressions;
+}
+
+static void usage() {
+    std::cout << "Usage: avalon-bench [options]" << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << "  --filter <text>       only run benchmarks whose name contains the text" << std::endl;
+    std::cout << "  --repeat <count>      run each benchmark this many times, 5 by default" << std::endl;
+    std::cout << "  --max-qubits <count>  largest circuit to simulate, from 10 to 26, 18 by default" << std::endl;
+    std::cout << "  --output <file>       write the results as json to the file instead of standard output" << std::endl;
+    std::cout << "  --baseline <file>     compare against the results of a previous run and fail on regressions" << std::endl;
+    std::cout << "  --threshold <ratio>   slow down tolerated before reporting a regression, 0.10 by default" << std::endl;
+}
+
+int main(int argc, char * argv[]) {
+    options opts;
+    opts.repeat = 5;
+    opts.max_qubits = 18;
+    opts.threshold = 0.10;
+
+    for(int i = 1; i < argc; i++) {
+        std::string option(argv[i]);
+        bool has_value = i + 1 < argc;
+        if(option == "--filter" && has_value)
+            opts.filter = argv[++i];
+        else if(option == "--repeat" && has_value)
+            opts.repeat = std::max(1, std::atoi(argv[++i]));
+        else if(option == "--max-qubits" && has_value)
+            opts.max_qubits = std::min(26, std::max(10, std::atoi(argv[++i])));
+        else if(option == "--output" && has_value)
+            opts.output = argv[++i];
+        else if(option == "--baseline" && has_value)
+            opts.baseline = argv[++i];
+        else if(option == "--threshold" && has_value)
+            opts.threshold = std::atof(argv[++i]);
+        else {
+            usage();
+            return 1;
+        }
+    }
+
+    // the benchmark programs live next to this file and the standard library in the sdk
+    std::vector<std::string> search_paths;
+    const char * bench_home = std::getenv("AVALON_BENCH_HOME");
+    search_paths.push_back(bench_home ? bench_home : "bench");
+    const char * avalon_home = std::getenv("AVALON_HOME");
+    search_paths.push_back(avalon_home ? avalon_home : "sdk");
+
+    std::vector<result> results;
+    try {
+        std::vector<std::string> programs = {"fizzbuzz", "lsearch", "maps"};
+        for(auto& name : programs)
+            bench_program(opts, results, name, search_paths);
+        bench_circuits(opts, results);
+    } catch(std::exception& err) {
+        std::cerr << "Benchmark failed: " << err.what() << std::endl;
+        return 1;
+    }
+
+    if(opts.output.empty()) {
+        write_json(std::cout, results);
+    }
+    else {
+        std::ofstream out(opts.output);
+        write_json(out, results);
+    }
+
+    if(opts.baseline.empty() == false)
+        return compare(opts, results) == 0 ? 0 : 1;
+    return 0;
+}
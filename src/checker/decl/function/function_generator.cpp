@@ -38,6 +38,7 @@
 #include "representer/ast/stmt/expression_stmt.hpp"
 #include "representer/ast/stmt/return_stmt.hpp"
 #include "representer/ast/stmt/while_stmt.hpp"
+#include "representer/ast/stmt/for_stmt.hpp"
 #include "representer/ast/stmt/block_stmt.hpp"
 #include "representer/ast/stmt/if_stmt.hpp"
 #include "representer/ast/stmt/stmt.hpp"
@@ -215,6 +216,9 @@ namespace avalon {
         if(a_statement -> is_while()) {
             generate_while(a_statement);
         }
+        else if(a_statement -> is_for()) {
+            generate_for(a_statement);
+        }
         else if(a_statement -> is_if()) {
             generate_if(a_statement);
         }
@@ -253,6 +257,18 @@ namespace avalon {
         generate_block(body);
     }
 
+    void function_generator::generate_for(std::shared_ptr<stmt>& a_statement) {
+        std::shared_ptr<for_stmt> const & f_stmt = std::static_pointer_cast<for_stmt>(a_statement);
+
+        // we work on the iterable, the loop variables get their type instances from it during checking
+        std::shared_ptr<expr>& iterable = f_stmt -> get_iterable();
+        generate_expression(iterable);
+
+        // we work on the body of the for loop
+        block_stmt& body = f_stmt -> get_block();
+        generate_block(body);
+    }
+
     void function_generator::generate_if(std::shared_ptr<stmt>& a_statement) {
         std::shared_ptr<if_stmt> const & i_stmt = std::static_pointer_cast<if_stmt>(a_statement);
 
@@ -112,6 +112,7 @@ namespace avalon {
          */
         void generate_statement(std::shared_ptr<decl>& declaration);
         void generate_while(std::shared_ptr<stmt>& a_statement);
+        void generate_for(std::shared_ptr<stmt>& a_statement);
         void generate_if(std::shared_ptr<stmt>& a_statement);
         void generate_return(std::shared_ptr<stmt>& a_statement);
         void generate_block(std::shared_ptr<stmt>& a_statement);
@@ -29,6 +29,7 @@
 
 /* AST */
 #include "representer/ast/stmt/while_stmt.hpp"
+#include "representer/ast/stmt/for_stmt.hpp"
 #include "representer/ast/stmt/block_stmt.hpp"
 #include "representer/ast/decl/statement.hpp"
 #include "representer/ast/decl/function.hpp"
@@ -99,6 +100,9 @@ namespace avalon {
         if(l_stmt -> is_while()) {
             analyze_while(l_stmt, current_decl, previous_decl);
         }
+        else if(l_stmt -> is_for()) {
+            analyze_for(l_stmt, current_decl, previous_decl);
+        }
         else if(l_stmt -> is_if()) {
             analyze_if(l_stmt, current_decl, previous_decl);
         }
@@ -171,6 +175,23 @@ namespace avalon {
         current_decl -> terminates(analyze_block(body));
     }
 
+    /**
+     * analyze_for
+     * this function makes sure a for statement is reachable and analyzes its body
+     * the iterable can be empty so a for loop never terminates execution on its own
+     */
+    void termination_checker::analyze_for(std::shared_ptr<stmt>& current_stmt, std::shared_ptr<decl>& current_decl, std::shared_ptr<decl>& previous_decl) {
+        std::shared_ptr<for_stmt> const & fr_stmt = std::static_pointer_cast<for_stmt>(current_stmt);
+
+        // reachability
+        current_decl -> is_reachable(is_reachable(previous_decl));
+
+        // termination
+        block_stmt& body = fr_stmt -> get_block();
+        analyze_block(body);
+        current_decl -> terminates(false);
+    }
+
     /**
      * analyze_if
      * this function makes sure a if statement is reachable and checks if it terminates
@@ -75,6 +75,12 @@ namespace avalon {
          */
         void analyze_while(std::shared_ptr<stmt>& current_stmt, std::shared_ptr<decl>& current_decl, std::shared_ptr<decl>& previous_decl);
 
+        /**
+         * analyze_for
+         * this function makes sure a for statement is reachable and analyzes its body
+         */
+        void analyze_for(std::shared_ptr<stmt>& current_stmt, std::shared_ptr<decl>& current_decl, std::shared_ptr<decl>& previous_decl);
+
         /**
          * analyze_if
          * this function makes sure a if statement is reachable and checks if it terminates
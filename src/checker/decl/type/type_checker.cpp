@@ -231,6 +231,10 @@ namespace avalon {
             }
         }
 
+        // complete type instances are interned so later comparisons against them are a pointer comparison
+        if(res.first == false && res.second == false)
+            instance.intern();
+
         return res;
     }
 
@@ -156,7 +156,8 @@ namespace avalon {
             throw invalid_variable(err.get_token(), err.what());
         }
 
-        // string, tuples, lists and maps must always be immutable
+        // string and tuples must always be immutable
+        // lists and maps can be mutable as their builtins modify them in place through references
         if(variable_val -> is_literal_expression()) {
             std::shared_ptr<literal_expression> const & lit_expr = std::static_pointer_cast<literal_expression>(variable_val);
             if(lit_expr -> get_expression_type() == STRING_EXPR && variable_decl -> is_mutable() == true)
@@ -169,14 +170,6 @@ namespace avalon {
             if(variable_decl -> is_mutable() == true)
                 throw invalid_variable(variable_decl -> get_token(), "Variable declaration initialized with tuple expressions must be immutable.");
         }
-        else if(variable_val -> is_list_expression()) {
-            if(variable_decl -> is_mutable() == true)
-                throw invalid_variable(variable_decl -> get_token(), "Variable declaration initialized with list expressions must be immutable.");
-        }
-        else if(variable_val -> is_map_expression()) {
-            if(variable_decl -> is_mutable() == true)
-                throw invalid_variable(variable_decl -> get_token(), "Variable declaration initialized with map expressions must be immutable.");
-        }
 
         // if we have a reference variable, make sure that if it points to an immutable variable, it is also immutable
         type_instance var_instance = variable_decl -> get_type_instance();
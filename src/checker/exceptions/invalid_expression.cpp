@@ -47,7 +47,7 @@ namespace avalon {
      * get_token
      * returns the token to the expression token in the source code
      */
-    const token& invalid_expression::get_token() {
+    const token& invalid_expression::get_token() const {
         return m_tok;
     }
 }
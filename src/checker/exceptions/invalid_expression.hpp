@@ -49,7 +49,7 @@ namespace avalon {
          * get_token
          * returns the token to the expression token in the source code
          */
-        const token& get_token();
+        const token& get_token() const;
 
     private:
         /**
@@ -22,6 +22,7 @@
  *  SOFTWARE.
  */
 
+#include <algorithm>
 #include <stdexcept>
 #include <utility>
 #include <cstddef>
@@ -60,6 +61,7 @@
 
 /* Builtins */
 #include "representer/builtins/lang/avalon_string.hpp"
+#include "representer/builtins/lang/avalon_gate.hpp"
 #include "representer/builtins/lang/avalon_bool.hpp"
 #include "representer/builtins/lang/avalon_int.hpp"
 
@@ -298,7 +300,7 @@ namespace avalon {
 
             // if we have a tuple, we inspect the content to make sure the element being accessed is not a reference expression
             if(var_instance.get_category() == TUPLE) {
-                check_reference_subscript_tuple(var_instance, rval);
+                check_reference_subscript_tuple(ref_expr, var_instance, rval);
                 ref_expr -> set_expression_type(REF_TUPLE_EXPR);
             }
             // if we have a list, we make sure that it is not a list of references
@@ -326,7 +328,7 @@ namespace avalon {
         }
     }
 
-    void expression_checker::check_reference_subscript_tuple(type_instance& var_instance, std::shared_ptr<expr>& key_expr) {
+    void expression_checker::check_reference_subscript_tuple(std::shared_ptr<reference_expression> const & ref_expr, type_instance& var_instance, std::shared_ptr<expr>& key_expr) {
         std::vector<type_instance>& params = var_instance.get_params();
         const token& key_tok = key_expr -> expr_token();
         std::size_t key = 0;
@@ -359,6 +361,9 @@ namespace avalon {
         } catch(const std::out_of_range& err) {
             throw invalid_expression(key_tok, "The tuple has no element at the given key.");
         }
+
+        // the element referenced never changes so the interpreter can use the key as is
+        ref_expr -> set_index(key);
     }
 
     void expression_checker::check_reference_subscript_list(type_instance& var_instance, std::shared_ptr<expr>& var_expr) {
@@ -821,6 +826,12 @@ namespace avalon {
         std::string mangled_name = mangle_constructor(call_name, params, instance);
         call_expr -> set_callee(sub_ns_name, mangled_name, params.size());
 
+        // gates built from literals are folded into their unitary matrix right away
+        static avalon_gate avl_gate;
+        type_instance gate_instance = avl_gate.get_type_instance();
+        if(type_instance_strong_compare(instance, gate_instance) && avalon_gate::is_constant(call_expr))
+            avalon_gate::get_unitary(call_expr);
+
         // return the infered type of the record constructor
         return instance;
     }
@@ -848,6 +859,27 @@ namespace avalon {
         std::map<token,type_instance>& cons_params = cons.get_params();
         std::vector<type_instance> params;
 
+        // we put the arguments in the order of the constructor parameters so every value built by this constructor has the same layout
+        // this lets attribute accesses resolve to a position during checking and patterns match values field by field
+        // the interpreter still evaluates them in the order of the source, which we record the first time the call is checked
+        if(call_expr -> get_evaluation_order().empty()) {
+            std::vector<std::size_t> sorted_positions(args.size());
+            for(std::size_t i = 0; i < args.size(); i++)
+                sorted_positions[i] = i;
+            std::stable_sort(sorted_positions.begin(), sorted_positions.end(), [&args](std::size_t lhs, std::size_t rhs) {
+                return args[lhs].first < args[rhs].first;
+            });
+
+            std::vector<std::pair<token, std::shared_ptr<expr> > > sorted_args;
+            std::vector<std::size_t> evaluation_order(args.size());
+            for(std::size_t i = 0; i < sorted_positions.size(); i++) {
+                sorted_args.push_back(args[sorted_positions[i]]);
+                evaluation_order[sorted_positions[i]] = i;
+            }
+            args = sorted_args;
+            call_expr -> set_evaluation_order(evaluation_order);
+        }
+
         // we check the constructor's parameters
         for(auto& arg : args) {
             token& arg_tok = arg.first;
@@ -942,6 +974,26 @@ namespace avalon {
                     if(arg_it -> first != star_tok)
                         throw invalid_expression(arg_it -> first, "Unexpected argument name. Either provide names for all arguments or none at all.");
                 }
+
+                // the builtins that modify their argument in place (list and map updates) declare it as a mutable reference
+                // such a parameter can only receive references to mutable variables so immutable variables are left alone
+                type_instance& param_instance = param_it -> second -> get_type_instance();
+                if(new_fun.is_builtin() && param_it -> second -> is_mutable() && param_instance.is_reference()) {
+                    std::shared_ptr<variable> ref_var = nullptr;
+                    if(arg_it -> second -> is_reference_expression()) {
+                        std::shared_ptr<reference_expression> const & ref_expr = std::static_pointer_cast<reference_expression>(arg_it -> second);
+                        if(ref_expr -> get_expression_type() == REF_VAR_EXPR)
+                            ref_var = ref_expr -> get_variable();
+                    }
+                    else if(arg_it -> second -> is_identifier_expression()) {
+                        std::shared_ptr<identifier_expression> const & id_expr = std::static_pointer_cast<identifier_expression>(arg_it -> second);
+                        if(id_expr -> get_expression_type() == VAR_EXPR)
+                            ref_var = l_scope -> get_variable(id_expr -> get_namespace(), id_expr -> get_name());
+                    }
+
+                    if(ref_var != nullptr && ref_var -> is_mutable() == false)
+                        throw invalid_expression(arg_it -> second -> expr_token(), "The variable <" + mangle_variable(* ref_var) + "> is immutable hence cannot be passed to a function that modifies it.");
+                }
             }
         }
 
@@ -1490,7 +1542,7 @@ namespace avalon {
         if(var_decl -> is_global()) {
             std::shared_ptr<expr>& var_value = var_decl -> get_value();
             if(var_value -> is_tuple_expression()) {
-                return check_tuple_attribute(var_value, rval, l_scope, ns_name);
+                return check_tuple_attribute(binary_expr, var_value, rval, l_scope, ns_name);
             }
             else {
                 return check_custom_attribute(binary_expr, lval, rval, l_scope, ns_name);
@@ -1508,14 +1560,17 @@ namespace avalon {
         }
     }
 
-    type_instance expression_checker::check_tuple_attribute(std::shared_ptr<expr>& lval_val, std::shared_ptr<expr>& rval, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
+    type_instance expression_checker::check_tuple_attribute(std::shared_ptr<binary_expression> const & binary_expr, std::shared_ptr<expr>& lval_val, std::shared_ptr<expr>& rval, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         std::shared_ptr<tuple_expression> const & tuple_expr = std::static_pointer_cast<tuple_expression>(lval_val);
         std::vector<std::pair<std::string, std::shared_ptr<expr> > >& elements = tuple_expr -> get_elements();
         const token& rval_tok = rval -> expr_token();
 
-        for(auto& element : elements) {
-            if(element.first == rval_tok.get_lexeme())
-                return check(element.second, l_scope, ns_name);
+        for(std::size_t index = 0; index < elements.size(); index++) {
+            if(elements[index].first == rval_tok.get_lexeme()) {
+                // the interpreter reads the element by position instead of looking it up by name
+                binary_expr -> set_element_index(index);
+                return check(elements[index].second, l_scope, ns_name);
+            }
         }
 
         throw invalid_expression(rval_tok, "This attribute does not exist in the named tuple contained in the variable being accessed.");
@@ -1524,9 +1579,17 @@ namespace avalon {
     type_instance expression_checker::check_custom_attribute(std::shared_ptr<binary_expression> const & binary_expr, std::shared_ptr<expr>& lval, std::shared_ptr<expr>& rval, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         // we check the lval
         type_instance lval_instance = check(lval, l_scope, ns_name);
-
-        // we build a function call expression for __getattr__ that will be validated
         token rval_tok = rval -> expr_token();
+
+        // if the attribute is a field of the record the lval holds, we read it directly from the value
+        std::size_t field_index = 0;
+        type_instance field_instance;
+        if(get_record_field(lval_instance, rval_tok, field_index, field_instance)) {
+            binary_expr -> set_element_index(field_index);
+            return field_instance;
+        }
+
+        // otherwise we build a function call expression for __getattr__ that will be validated
         std::string call_name = "__getattr_" + rval_tok.get_lexeme() + "__";
         token call_tok(rval_tok.get_type(), call_name, rval_tok.get_line(), rval_tok.get_column(), rval_tok.get_source_path());
         std::shared_ptr<call_expression> getattr_expr = std::make_shared<call_expression>(call_tok);
@@ -1551,7 +1614,7 @@ namespace avalon {
         type_instance& var_instance = var_decl -> get_type_instance();
 
         if(var_instance.get_category() == TUPLE) {
-            return check_tuple_subscript(var_instance, rval, l_scope, ns_name);
+            return check_tuple_subscript(binary_expr, var_instance, rval, l_scope, ns_name);
         }
         else if(var_instance.get_category() == LIST) {
             return check_list_subscript(var_instance, rval, l_scope, ns_name);
@@ -1564,7 +1627,7 @@ namespace avalon {
         }
     }
 
-    type_instance expression_checker::check_tuple_subscript(type_instance& var_instance, std::shared_ptr<expr>& rval, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
+    type_instance expression_checker::check_tuple_subscript(std::shared_ptr<binary_expression> const & binary_expr, type_instance& var_instance, std::shared_ptr<expr>& rval, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         std::vector<type_instance>& params = var_instance.get_params();
         const token& rval_tok = rval -> expr_token();
         std::size_t key = 0;
@@ -1588,6 +1651,9 @@ namespace avalon {
             throw invalid_expression(rval_tok, "This key is out of range within the tuple contained in the variable.");
         }
 
+        // the interpreter reads the element by position instead of parsing the key again
+        binary_expr -> set_element_index(key);
+
         // return the type instance
         return m_inferrer.infer_tuple_subscript(var_instance, rval, l_scope, ns_name);
     }
@@ -1709,6 +1775,9 @@ namespace avalon {
         type_instance rval_instance = check(rval, l_scope, ns_name);
         m_inside_match = false;
 
+        // the rval is compiled now that we know which identifiers are constructors and which are variables to capture into
+        match_expr -> compile_pattern(l_scope);
+
         // we make sure both the rval and lval type instance are the same
         if(type_instance_weak_compare(lval_instance, rval_instance) == false) {
             throw invalid_expression(lval -> expr_token(), "This lval expression has type instance <" + mangle_type_instance(lval_instance) + "> while the rval expression expression has type instance <" + mangle_type_instance(rval_instance) + ">. Both type instances but be the same - though not necessarily equal.");
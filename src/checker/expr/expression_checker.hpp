@@ -105,7 +105,7 @@ namespace avalon {
         void check_reference_binary(std::shared_ptr<reference_expression> const & ref_expr, std::shared_ptr<binary_expression> const & bin_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name, const std::string& sub_ns_name);
         void check_reference_attribute(std::shared_ptr<reference_expression> const & ref_expr, std::shared_ptr<binary_expression> const & bin_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name, const std::string& sub_ns_name);
         void check_reference_subscript(std::shared_ptr<reference_expression> const & ref_expr, std::shared_ptr<binary_expression> const & bin_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name, const std::string& sub_ns_name);
-        void check_reference_subscript_tuple(type_instance& var_instance, std::shared_ptr<expr>& key_expr);
+        void check_reference_subscript_tuple(std::shared_ptr<reference_expression> const & ref_expr, type_instance& var_instance, std::shared_ptr<expr>& key_expr);
         void check_reference_subscript_list(type_instance& var_instance, std::shared_ptr<expr>& var_expr);
         void check_reference_subscript_map(type_instance& var_instance, std::shared_ptr<expr>& var_expr);
         void check_reference_subscript_custom(type_instance& var_instance, std::shared_ptr<binary_expression> const & bin_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
@@ -242,10 +242,10 @@ namespace avalon {
         type_instance check_namespace_binary(std::shared_ptr<binary_expression> const & binary_expr, const std::string& sub_ns_name, std::shared_ptr<expr>& rval, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
         type_instance check_variable_binary(std::shared_ptr<binary_expression> const & binary_expr, std::shared_ptr<expr>& lval, std::shared_ptr<expr>& rval, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
         type_instance check_variable_attribute(std::shared_ptr<binary_expression> const & binary_expr, std::shared_ptr<expr>& lval, std::shared_ptr<expr>& rval, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
-        type_instance check_tuple_attribute(std::shared_ptr<expr>& lval_val, std::shared_ptr<expr>& rval, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
+        type_instance check_tuple_attribute(std::shared_ptr<binary_expression> const & binary_expr, std::shared_ptr<expr>& lval_val, std::shared_ptr<expr>& rval, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
         type_instance check_custom_attribute(std::shared_ptr<binary_expression> const & binary_expr, std::shared_ptr<expr>& lval, std::shared_ptr<expr>& rval, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
         type_instance check_variable_subscript(std::shared_ptr<binary_expression> const & binary_expr, std::shared_ptr<expr>& lval, std::shared_ptr<expr>& rval, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
-        type_instance check_tuple_subscript(type_instance& var_instance, std::shared_ptr<expr>& rval, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
+        type_instance check_tuple_subscript(std::shared_ptr<binary_expression> const & binary_expr, type_instance& var_instance, std::shared_ptr<expr>& rval, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
         type_instance check_list_subscript(type_instance& var_instance, std::shared_ptr<expr>& rval, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
         type_instance check_map_subscript(type_instance& var_instance, std::shared_ptr<expr>& rval, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
         type_instance check_custom_subscript(std::shared_ptr<binary_expression> const & binary_expr, std::shared_ptr<expr>& lval, std::shared_ptr<expr>& rval, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
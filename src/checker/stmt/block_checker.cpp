@@ -32,6 +32,7 @@
 #include "representer/ast/stmt/return_stmt.hpp"
 #include "representer/ast/stmt/block_stmt.hpp"
 #include "representer/ast/stmt/while_stmt.hpp"
+#include "representer/ast/stmt/for_stmt.hpp"
 #include "representer/ast/stmt/break_stmt.hpp"
 #include "representer/ast/stmt/pass_stmt.hpp"
 #include "representer/ast/decl/statement.hpp"
@@ -45,8 +46,10 @@
 #include "representer/ast/expr/reference_expression.hpp"
 
 /* Builtins */
+#include "representer/builtins/lang/avalon_string.hpp"
 #include "representer/builtins/lang/avalon_void.hpp"
 #include "representer/builtins/lang/avalon_bool.hpp"
+#include "representer/builtins/lang/avalon_int.hpp"
 
 /* Symbol table */
 #include "representer/symtable/scope.hpp"
@@ -142,6 +145,9 @@ namespace avalon {
         if(l_stmt -> is_while()) {
             check_while(l_stmt, l_scope, ns_name);
         }
+        else if(l_stmt -> is_for()) {
+            check_for(l_stmt, l_scope, ns_name);
+        }
         else if(l_stmt -> is_if()) {
             check_if(l_stmt, l_scope, ns_name);
         }
@@ -199,6 +205,100 @@ namespace avalon {
             m_inside_loop = false;
     }
 
+    /**
+     * check_for
+     * given a statement, check if it is a valid for statement
+     * we can iterate over lists, maps (over keys or keys and values), strings (one character at a time)
+     * and integer ranges given as an integer <n> (from 0 to n - 1) or a tuple of two or three integers (start, end[, step])
+     */
+    void block_checker::check_for(std::shared_ptr<stmt>& a_statement, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
+        bool upper_loop_found = m_inside_loop;
+        m_inside_loop = true;
+
+        std::shared_ptr<for_stmt> const & fr_stmt = std::static_pointer_cast<for_stmt>(a_statement);
+        std::shared_ptr<expr>& fr_iterable = fr_stmt -> get_iterable();
+        std::vector<std::shared_ptr<variable> >& fr_variables = fr_stmt -> get_variables();
+        block_stmt& fr_body = fr_stmt -> get_block();
+        std::shared_ptr<scope>& fr_scope = fr_stmt -> get_scope();
+        expression_checker expr_checker;
+        avalon_string avl_string;
+        type_instance& string_instance = avl_string.get_type_instance();
+        avalon_int avl_int;
+        type_instance& int_instance = avl_int.get_type_instance();
+
+        // we check the iterable before adding the loop variables so it cannot refer to them
+        type_instance iter_instance;
+        try {
+            iter_instance = expr_checker.check(fr_iterable, fr_scope, ns_name);
+        } catch(const invalid_expression& err) {
+            throw err;
+        }
+
+        // we deduce the type instance of each loop variable from the iterable
+        std::vector<type_instance> var_instances;
+        if(iter_instance.get_category() == LIST) {
+            var_instances.push_back(iter_instance.get_params()[0]);
+        }
+        else if(iter_instance.get_category() == MAP) {
+            var_instances.push_back(iter_instance.get_params()[0]);
+            var_instances.push_back(iter_instance.get_params()[1]);
+        }
+        else if(type_instance_strong_compare(iter_instance, string_instance)) {
+            var_instances.push_back(string_instance);
+        }
+        else if(type_instance_strong_compare(iter_instance, int_instance)) {
+            var_instances.push_back(int_instance);
+        }
+        else if(iter_instance.get_category() == TUPLE) {
+            std::vector<type_instance>& bounds = iter_instance.get_params();
+            if(bounds.size() < 2 || bounds.size() > 3)
+                throw invalid_statement(fr_stmt -> get_token(), "A range in a for loop is a tuple of two or three integers (start, end[, step]) but the given tuple has <" + std::to_string(bounds.size()) + "> elements.");
+            for(auto& bound : bounds) {
+                if(type_instance_strong_compare(bound, int_instance) == false)
+                    throw invalid_statement(fr_stmt -> get_token(), "A range in a for loop is a tuple of integers but the given tuple is of type instance <" + mangle_type_instance(iter_instance) + ">.");
+            }
+            var_instances.push_back(int_instance);
+        }
+        else {
+            throw invalid_statement(fr_stmt -> get_token(), "A for loop can only iterate over lists, maps, strings and integer ranges but the given expression is of type instance <" + mangle_type_instance(iter_instance) + ">.");
+        }
+
+        if(fr_variables.size() > var_instances.size())
+            throw invalid_statement(fr_stmt -> get_token(), "Only for loops over maps can declare two loop variables, one for the key and one for the value.");
+
+        // we add the loop variables to the scope of the loop
+        for(std::size_t i = 0; i < fr_variables.size(); i++) {
+            std::shared_ptr<variable>& var_decl = fr_variables[i];
+            var_decl -> is_public(false);
+            var_decl -> is_global(false);
+            var_decl -> is_used(true);
+            var_decl -> check_initializer(false);
+            var_decl -> set_type_instance(var_instances[i]);
+            try {
+                fr_scope -> add_variable("*", var_decl);
+            } catch(const symbol_already_declared& err) {
+                throw invalid_variable(var_decl -> get_token(), err.what());
+            } catch(const symbol_can_collide& err) {
+                throw invalid_variable(var_decl -> get_token(), err.what());
+            }
+
+            variable_checker v_checker;
+            try {
+                v_checker.check(var_decl, fr_scope, ns_name);
+            } catch(const invalid_variable& err) {
+                throw err;
+            }
+            var_decl -> is_temporary(true);
+        }
+
+        // we check the body of the for loop
+        this -> check(fr_body, fr_scope, ns_name);
+
+        // we only clear the inside loop flag if no other upper loop exists
+        if(upper_loop_found == false)
+            m_inside_loop = false;
+    }
+
     /**
      * check_if
      * given a statement, check if it is a valid if statement
@@ -92,6 +92,12 @@ namespace avalon {
          */
         void check_while(std::shared_ptr<stmt>& a_statement, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
 
+        /**
+         * check_for
+         * given a statement, check if it is a valid for statement
+         */
+        void check_for(std::shared_ptr<stmt>& a_statement, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
+
         /**
          * check_if
          * given a statement, check if it is a valid if statement
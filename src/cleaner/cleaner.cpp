@@ -119,9 +119,10 @@ cleaner::cleaner(gtable& gtab, error& error_handler) : m_error_handler(error_han
         std::vector<std::shared_ptr<decl> >& p_decls = prog.get_declarations();
         
         // set up the new program
+        // it keeps the scope the importer and the checker resolved: imported declarations are already in it
+        // and the checker recorded there every specialization the program calls from the programs it imports
         program new_prog;
-        std::shared_ptr<scope>& old_prog_scope = prog.get_scope();
-        std::shared_ptr<scope> new_prog_scope = std::make_shared<scope>(* old_prog_scope);
+        std::shared_ptr<scope>& new_prog_scope = prog.get_scope();
         new_prog.set_scope(new_prog_scope);
         new_prog.is_builtin(prog.is_builtin());
         fqn& old_prog_fqn = prog.get_fqn();
@@ -24,6 +24,7 @@
 
 #include <stdexcept>
 #include <iostream>
+#include <unordered_set>
 #include <memory>
 #include <vector>
 #include <string>
@@ -34,11 +35,15 @@
 #include "error/error.hpp"
 
 /* Program */
+#include "representer/ast/decl/import.hpp"
 #include "representer/symtable/gtable.hpp"
+#include "representer/ast/decl/decl.hpp"
+#include "representer/symtable/fqn.hpp"
 #include "representer/ast/program.hpp"
 
 /* Interpreter */
 #include "interpreter/interpreter.hpp"
+#include "interpreter/output_buffer.hpp"
 
 /* Cleaner */
 #include "cleaner/cleaner.hpp"
@@ -63,6 +68,8 @@
 #include "utils/exceptions/invalid_directory.hpp"
 #include "utils/exceptions/file_not_found.hpp"
 #include "utils/file_util.hpp"
+#include "utils/parse_util.hpp"
+#include "utils/stats.hpp"
 
 /* Compiler */
 #include "compiler/compiler.hpp"
@@ -99,6 +106,47 @@ namespace avalon {
         m_search_paths.push_back(p.string());
     }
 
+    /**
+     * add_default_search_paths
+     * adds the current directory, the directory of the source file and the avalon home directory to the search paths.
+     * the avalon home directory is ignored if it is empty.
+     */
+    void compiler::add_default_search_paths(const std::string& source_path, const std::string& avalon_home) {
+        add_default_search_paths(source_path, avalon_home, fs::current_path());
+    }
+
+    /**
+     * add_default_search_paths
+     * same as above but the source path and the current directory are taken relative to the given working directory
+     * instead of the one of the process, so a server can resolve the paths of a client without changing directory.
+     */
+    void compiler::add_default_search_paths(const std::string& source_path, const std::string& avalon_home, const fs::path& working_dir) {
+        // add the current directory to the search path
+        add_search_path(working_dir);
+
+        // we add the source path directory to the search path
+        // we leave it to later stages of the compiler to decide if the file is valid
+        fs::path s(source_path);
+        if(s.is_relative())
+            s = working_dir / s;
+        if(fs::exists(s) == true && fs::is_directory(s) == false) {
+            fs::path source_dir = s.parent_path();
+            try {
+                add_search_path(source_dir);
+            } catch(const invalid_directory& err) {
+            }
+        }
+
+        // add the avalon home directory to the search path - if it exists
+        if(avalon_home.empty() == false) {
+            fs::path p(avalon_home);
+            if(p.is_relative())
+                p = working_dir / p;
+            if(fs::exists(p) == true && fs::is_directory(p) == true)
+                add_search_path(p);
+        }
+    }
+
     /**
      * scan
      * calls the scanner to get the text to scan
@@ -266,47 +314,59 @@ namespace avalon {
         }
     }
 
+    /**
+     * preload
+     * parses the given source file and all the files it imports, directly or not, so they are in the parse cache.
+     * errors are ignored: they will be reported when the program is checked or interpreted.
+     */
+    void compiler::preload(const std::string& source_path) {
+        std::unordered_set<std::string> visited;
+        preload_util(source_path, visited);
+    }
+
+    /**
+     * preload_util
+     * parses the given source file then the files it imports, skipping those already visited
+     */
+    void compiler::preload_util(const std::string& source_path, std::unordered_set<std::string>& visited) {
+        if(visited.insert(source_path).second == false)
+            return;
+
+        program prog;
+        try {
+            prog = parse_util::parse(source_path, m_search_paths);
+        } catch(const std::runtime_error& err) {
+            return;
+        }
+
+        std::vector<std::shared_ptr<decl> >& decls = prog.get_declarations();
+        for(auto& decl : decls) {
+            if(decl -> is_import() == false)
+                continue;
+
+            std::shared_ptr<avalon::import> import_decl = std::static_pointer_cast<avalon::import>(decl);
+            fqn import_fqn = fqn::from_name(import_decl -> get_fqn_name());
+            preload_util(import_fqn.get_path(), visited);
+        }
+    }
+
     /**
      * check
      * calls the checker to validate the entire program
      */
     void compiler::check(const std::string& source_path) {
         error error_handler(source_path);
-        file_util futil(m_search_paths);
 
-        // make sure the file given exists and the absolute path to it
-        std::string source_abs_path;
-        try {
-            source_abs_path = futil.get_source_path(source_path);
-        } catch(file_not_found err) {
-            throw err;
-        }
-
-        // scan the file for content
-        scanner scr(source_abs_path);
-        std::string source;
+        // scan, tokenize and parse the file
+        program prog;
         try {
-            source = scr.scan();
+            prog = parse_util::parse(source_path, m_search_paths);
         } catch(file_not_found err) {
             error_handler.log(err.what());
             return;
-        }
-
-        // tokenize the file
-        lexer lxr(source_path, source, error_handler);
-        std::vector<std::shared_ptr<token> > tokens;
-        try {
-            tokens = lxr.lex();
         } catch(lex_error err) {
             err.show();
             return;
-        }
-
-        // parse the file
-        parser psr(tokens, source_path, error_handler);
-        program prog;
-        try {            
-            prog = psr.parse();
         } catch(parse_error err) {
             err.show();
             return;
@@ -316,7 +376,9 @@ namespace avalon {
         importer ipr(prog, m_search_paths, error_handler);
         gtable gtab;
         try {
+            phase_timer timer("import");
             gtab = ipr.import_all();
+            stats::set_programs(gtab.get_programs().size());
         } catch(import_error err) {
             err.show();
         } catch(parse_error err) {
@@ -330,6 +392,7 @@ namespace avalon {
         // check the program
         checker ckr(prog, gtab, source_path, error_handler);
         try {
+            phase_timer timer("check");
             ckr.check();
         } catch(check_error err) {
             err.show();
@@ -388,7 +451,9 @@ namespace avalon {
         importer ipr(prog, m_search_paths, error_handler);
         gtable gtab;
         try {
+            phase_timer timer("import");
             gtab = ipr.import_all();
+            stats::set_programs(gtab.get_programs().size());
         } catch(import_error err) {
             err.show();
         } catch(parse_error err) {
@@ -402,6 +467,7 @@ namespace avalon {
         // check the program
         checker ckr(prog, gtab, source_path, error_handler);
         try {
+            phase_timer timer("check");
             ckr.check();
         } catch(check_error err) {
             err.show();
@@ -410,6 +476,7 @@ namespace avalon {
         // clean all programs
         cleaner clr(gtab, error_handler);
         try {
+            phase_timer timer("clean");
             clr.clean();
         } catch(clean_error err) {
             err.show();
@@ -424,42 +491,17 @@ namespace avalon {
      */
     void compiler::interpret(const std::string& source_path, std::vector<std::string>& argumemts) {
         error error_handler(source_path);
-        file_util futil(m_search_paths);
 
-        // make sure the file given exists and the absolute path to it
-        std::string source_abs_path;
-        try {
-            source_abs_path = futil.get_source_path(source_path);
-        } catch(file_not_found err) {
-            error_handler.log(err.what());
-            return;
-        }
-
-        // scan the file for content
-        scanner scr(source_abs_path);
-        std::string source;
+        // scan, tokenize and parse the file
+        program prog;
         try {
-            source = scr.scan();
+            prog = parse_util::parse(source_path, m_search_paths);
         } catch(file_not_found err) {
             error_handler.log(err.what());
             return;
-        }
-
-        // tokenize the file
-        lexer lxr(source_path, source, error_handler);
-        std::vector<std::shared_ptr<token> > tokens;
-        try {
-            tokens = lxr.lex();
         } catch(lex_error err) {
             err.show();
             return;
-        }
-
-        // parse the file
-        parser psr(tokens, source_path, error_handler);
-        program prog;
-        try {            
-            prog = psr.parse();
         } catch(parse_error err) {
             err.show();
             return;
@@ -469,7 +511,9 @@ namespace avalon {
         importer ipr(prog, m_search_paths, error_handler);
         gtable gtab;
         try {
+            phase_timer timer("import");
             gtab = ipr.import_all();
+            stats::set_programs(gtab.get_programs().size());
         } catch(import_error err) {
             err.show();
         } catch(parse_error err) {
@@ -483,6 +527,7 @@ namespace avalon {
         // check the program
         checker ckr(prog, gtab, source_path, error_handler);
         try {
+            phase_timer timer("check");
             ckr.check();
         } catch(check_error err) {
             err.show();
@@ -492,6 +537,7 @@ namespace avalon {
         cleaner clr(gtab, error_handler);
         gtable new_gtab;
         try {
+            phase_timer timer("clean");
             new_gtab = clr.clean();
         } catch(clean_error err) {
             err.show();
@@ -500,8 +546,11 @@ namespace avalon {
         // interpret the main program
         interpreter itr(new_gtab, error_handler);
         try {
+            phase_timer timer("interpret");
             itr.interpret(argumemts);
+            output_buffer::flush();
         } catch(interpret_error err) {
+            output_buffer::flush();
             err.show();
         }
 
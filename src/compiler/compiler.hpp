@@ -25,10 +25,13 @@
 #ifndef AVALON_COMPILER_HPP_
 #define AVALON_COMPILER_HPP_
 
+#include <unordered_set>
 #include <memory>
 #include <vector>
 #include <string>
 
+#include <boost/filesystem.hpp>
+
 /* Error */
 #include "error/error.hpp"
 
@@ -59,6 +62,20 @@ namespace avalon {
         void add_search_path(const std::string& path);
         void add_search_path(const fs::path& p);
 
+        /**
+         * add_default_search_paths
+         * adds the current directory, the directory of the source file and the avalon home directory to the search paths.
+         * the avalon home directory is ignored if it is empty.
+         */
+        void add_default_search_paths(const std::string& source_path, const std::string& avalon_home);
+
+        /**
+         * add_default_search_paths
+         * same as above but the source path and the current directory are taken relative to the given working directory
+         * instead of the one of the process, so a server can resolve the paths of a client without changing directory.
+         */
+        void add_default_search_paths(const std::string& source_path, const std::string& avalon_home, const fs::path& working_dir);
+
         /**
          * scan
          * calls the scanner to get the text to scan
@@ -83,6 +100,13 @@ namespace avalon {
          */
         void import(const std::string& source_path);
 
+        /**
+         * preload
+         * parses the given source file and all the files it imports, directly or not, so they are in the parse cache.
+         * errors are ignored: they will be reported when the program is checked or interpreted.
+         */
+        void preload(const std::string& source_path);
+
         /**
          * check
          * calls the checker to validate the entire program
@@ -106,6 +130,12 @@ namespace avalon {
          * a vector of possible search paths
          */
         std::vector<std::string> m_search_paths;
+
+        /**
+         * preload_util
+         * parses the given source file then the files it imports, skipping those already visited
+         */
+        void preload_util(const std::string& source_path, std::unordered_set<std::string>& visited);
     };
 }
 
@@ -0,0 +1,465 @@
+/*
+ *  This file is part of the Avalon programming language
+ * 
+ *  Copyright (c) 2018 Ntwali Bashige Toussaint
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include <iostream>
+#include <cstring>
+#include <cstdint>
+#include <cstdlib>
+#include <cerrno>
+#include <vector>
+#include <string>
+
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <sys/un.h>
+#include <signal.h>
+#include <unistd.h>
+
+#include <boost/filesystem.hpp>
+
+/* Compiler */
+#include "compiler/compiler.hpp"
+#include "compiler/server.hpp"
+
+/* Interpreter */
+#include "interpreter/output_buffer.hpp"
+#include "interpreter/qprocessor.hpp"
+#include "interpreter/profiler.hpp"
+#include "interpreter/tracer.hpp"
+
+/* Utils */
+#include "utils/parse_util.hpp"
+#include "utils/file_util.hpp"
+#include "utils/stats.hpp"
+
+/* Exceptions */
+#include "compiler/exceptions/server_error.hpp"
+
+
+namespace avalon {
+/**
+ * make_address
+ * fills a unix socket address with the given path
+ */
+static sockaddr_un make_address(const std::string& socket_path) {
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if(socket_path.size() >= sizeof(address.sun_path))
+        throw server_error("The socket path <" + socket_path + "> is too long.");
+    std::strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1);
+    return address;
+}
+
+/**
+ * write_all
+ * writes the entire buffer to the given descriptor, returns false if that was not possible
+ */
+static bool write_all(int fd, const char * data, std::size_t size) {
+    while(size > 0) {
+        ssize_t written = ::write(fd, data, size);
+        if(written < 0 && errno == EINTR)
+            continue;
+        if(written <= 0)
+            return false;
+        data += written;
+        size -= written;
+    }
+    return true;
+}
+
+/**
+ * read_all
+ * fills the entire buffer from the given descriptor, returns false if that was not possible
+ */
+static bool read_all(int fd, char * data, std::size_t size) {
+    while(size > 0) {
+        ssize_t got = ::read(fd, data, size);
+        if(got < 0 && errno == EINTR)
+            continue;
+        if(got <= 0)
+            return false;
+        data += got;
+        size -= got;
+    }
+    return true;
+}
+
+/**
+ * close_received
+ * closes every descriptor that came with the given message
+ */
+static void close_received(msghdr& msg) {
+    for(cmsghdr * cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+        if(cmsg -> cmsg_level != SOL_SOCKET || cmsg -> cmsg_type != SCM_RIGHTS)
+            continue;
+
+        std::size_t count = (cmsg -> cmsg_len - CMSG_LEN(0)) / sizeof(int);
+        for(std::size_t i = 0; i < count; i++) {
+            int fd;
+            std::memcpy(&fd, CMSG_DATA(cmsg) + i * sizeof(int), sizeof(int));
+            ::close(fd);
+        }
+    }
+}
+
+    /*
+     * the largest request payload the server accepts, in bytes
+     */
+    const std::uint32_t server::max_request_size = 1024 * 1024;
+
+    /*
+     * how long the server waits for a client to send its request, in seconds
+     */
+    const int server::request_timeout = 5;
+
+    /**
+     * the constructor expects the path to the unix socket to listen on
+     */
+    server::server(const std::string& socket_path) : m_socket_path(socket_path) {
+    }
+
+    /**
+     * request_options
+     * by default, the program is run with none of the reports and with the default output buffer
+     */
+    server::request_options::request_options() : m_check_only(false), m_show_stats(false), m_stats_json(false), m_qstats(false), m_out_buffer_size(0), m_unbuffered(false) {
+    }
+
+    /**
+     * serve
+     * listens for requests forever.
+     * requests are accepted one at a time: the program and its imports are parsed by the server itself,
+     * the handler it forks then runs the program while the server goes on accepting the next request.
+     */
+    void server::serve() {
+        sockaddr_un address = make_address(m_socket_path);
+
+        int listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if(listener < 0)
+            throw server_error("Failed to create the server socket: " + std::string(std::strerror(errno)) + ".");
+
+        // a socket left behind by a previous server would prevent us from binding but anything else is not ours to remove
+        struct stat st;
+        if(::lstat(m_socket_path.c_str(), &st) == 0) {
+            if(S_ISSOCK(st.st_mode) == false) {
+                ::close(listener);
+                throw server_error("The socket path <" + m_socket_path + "> already exists and is not a socket.");
+            }
+            ::unlink(m_socket_path.c_str());
+        }
+        if(::bind(listener, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0 || ::listen(listener, 16) < 0) {
+            ::close(listener);
+            throw server_error("Failed to listen on <" + m_socket_path + ">: " + std::string(std::strerror(errno)) + ".");
+        }
+
+        // a client going away must not take the server down with it
+        ::signal(SIGPIPE, SIG_IGN);
+
+        // the handlers of finished requests are reaped automatically
+        ::signal(SIGCHLD, SIG_IGN);
+
+        // parsed programs are kept around from now on
+        parse_util::enable_cache(true);
+
+        std::cout << "Listening on <" << m_socket_path << ">." << std::endl;
+        while(true) {
+            int client = ::accept(listener, nullptr, nullptr);
+            if(client < 0) {
+                if(errno == EINTR)
+                    continue;
+                ::close(listener);
+                throw server_error("Failed to accept a request: " + std::string(std::strerror(errno)) + ".");
+            }
+
+            handle(client);
+            ::close(client);
+        }
+    }
+
+    /**
+     * handle
+     * reads a request from the given client, preloads the program then hands it over to a handler process
+     * that runs it in a worker and reports the worker's exit status to the client
+     */
+    void server::handle(int client) {
+        // a client that connects but never sends its request must not hold up the other clients
+        timeval timeout;
+        timeout.tv_sec = request_timeout;
+        timeout.tv_usec = 0;
+        ::setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+        // the request starts with its size and comes with the client standard input, output and error
+        std::uint32_t size = 0;
+        int fds[3] = {-1, -1, -1};
+        char control[CMSG_SPACE(sizeof(fds))];
+        iovec iov;
+        iov.iov_base = &size;
+        iov.iov_len = sizeof(size);
+        msghdr msg;
+        std::memset(&msg, 0, sizeof(msg));
+        msg.msg_iov = &iov;
+        msg.msg_iovlen = 1;
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+        if(::recvmsg(client, &msg, MSG_WAITALL) != sizeof(size)) {
+            if(msg.msg_controllen > 0)
+                close_received(msg);
+            return;
+        }
+
+        // a malformed request may still have come with descriptors, they must not pile up in the server
+        cmsghdr * cmsg = CMSG_FIRSTHDR(&msg);
+        if(cmsg == nullptr || cmsg -> cmsg_level != SOL_SOCKET || cmsg -> cmsg_type != SCM_RIGHTS || cmsg -> cmsg_len != CMSG_LEN(sizeof(fds)) || (msg.msg_flags & MSG_CTRUNC) != 0) {
+            close_received(msg);
+            return;
+        }
+        std::memcpy(fds, CMSG_DATA(cmsg), sizeof(fds));
+
+        // we refuse requests larger than we are willing to allocate
+        std::int32_t status = 1;
+        if(size > max_request_size) {
+            std::string message = "The request of " + std::to_string(size) + " bytes is larger than the maximum of " + std::to_string(max_request_size) + " bytes the server accepts.\n";
+            write_all(fds[2], message.data(), message.size());
+            for(int fd : fds)
+                ::close(fd);
+            write_all(client, reinterpret_cast<const char *>(&status), sizeof(status));
+            return;
+        }
+
+        // the rest of the request are null separated fields: the command, the working directory, the avalon home,
+        // the stats format, the qstats flag, the profile path, the trace path, the output buffering, the source path then the arguments
+        std::string payload(size, '\0');
+        std::vector<std::string> fields;
+        if(read_all(client, &payload[0], size)) {
+            std::string::size_type start = 0;
+            for(std::string::size_type i = 0; i < payload.size(); i++) {
+                if(payload[i] == '\0') {
+                    fields.push_back(payload.substr(start, i - start));
+                    start = i + 1;
+                }
+            }
+        }
+
+        pid_t handler = -1;
+        if(fields.size() >= 9) {
+            // files may have been added or removed since the last request so search paths are resolved afresh
+            file_util::clear_cache();
+
+            // we parse whatever changed since the last request before forking so the work benefits the requests to come.
+            // this is the only part of a request the server does itself so the next request waits for it to finish.
+            // paths are resolved relative to the directory of the client, the server itself never changes directory.
+            try {
+                compiler comp;
+                comp.add_default_search_paths(fields[8], fields[2], fields[1]);
+                comp.preload(fields[8]);
+            } catch(const std::runtime_error& err) {
+            }
+
+            // the handler waits for the worker so the server can go back to accepting requests right away
+            handler = ::fork();
+            if(handler == 0) {
+                ::signal(SIGCHLD, SIG_DFL);
+                pid_t pid = ::fork();
+                if(pid == 0) {
+                    ::close(client);
+                    run_worker(fields, fds[0], fds[1], fds[2]);
+                }
+
+                int wstatus = 0;
+                if(pid > 0 && ::waitpid(pid, &wstatus, 0) == pid)
+                    status = WIFEXITED(wstatus) ? WEXITSTATUS(wstatus) : 128 + WTERMSIG(wstatus);
+                write_all(client, reinterpret_cast<const char *>(&status), sizeof(status));
+                ::_exit(0);
+            }
+        }
+
+        for(int fd : fds)
+            ::close(fd);
+
+        // without a handler nobody else will answer the client
+        if(handler < 0)
+            write_all(client, reinterpret_cast<const char *>(&status), sizeof(status));
+    }
+
+    /**
+     * run_worker
+     * runs the requested program in the current process, which is expected to be a forked worker
+     */
+    void server::run_worker(std::vector<std::string>& fields, int in, int out, int err) {
+        ::dup2(in, STDIN_FILENO);
+        ::dup2(out, STDOUT_FILENO);
+        ::dup2(err, STDERR_FILENO);
+        ::close(in);
+        ::close(out);
+        ::close(err);
+
+        const std::string& command = fields[0];
+        const std::string& working_dir = fields[1];
+        const std::string& avalon_home = fields[2];
+        const std::string& stats_format = fields[3];
+        const std::string& profile_path = fields[5];
+        const std::string& trace_path = fields[6];
+        const std::string& out_buffer = fields[7];
+        const std::string& source_path = fields[8];
+        std::vector<std::string> arguments(fields.begin() + 9, fields.end());
+
+        // the worker is a process of its own so it can take on the directory of the client, files the program opens depend on it
+        if(::chdir(working_dir.c_str()) != 0) {
+            std::cerr << "Failed to change to the working directory <" << working_dir << ">: " << std::strerror(errno) << "." << std::endl;
+            ::_exit(1);
+        }
+
+        // honor the options the client was given
+        if(stats_format.empty() == false)
+            stats::enable();
+        if(fields[4] == "1")
+            qprocessor::enable_stats_report();
+        if(profile_path.empty() == false)
+            profiler::enable(profile_path);
+        if(trace_path.empty() == false && tracer::enable(trace_path) == false) {
+            std::cerr << "Failed to create the trace file <" << trace_path << ">." << std::endl;
+            ::_exit(1);
+        }
+        if(out_buffer == "unbuffered")
+            output_buffer::set_unbuffered();
+        else if(out_buffer.empty() == false)
+            output_buffer::set_capacity(std::stoul(out_buffer));
+
+        int status = 0;
+        try {
+            compiler comp;
+            comp.add_default_search_paths(source_path, avalon_home, working_dir);
+            if(command == "check")
+                comp.check(source_path);
+            else
+                comp.interpret(source_path, arguments);
+        } catch(const std::runtime_error& err) {
+            std::cerr << err.what() << std::endl;
+            status = 1;
+        }
+
+        if(stats_format.empty() == false)
+            stats::report(std::cerr, stats_format == "json");
+        if(profile_path.empty() == false)
+            profiler::report(std::cerr);
+        tracer::finish();
+
+        std::cout.flush();
+        std::cerr.flush();
+        ::_exit(status);
+    }
+
+    /**
+     * request
+     * connects to the server listening on the given socket and asks it to check or interpret the given program.
+     * returns the exit status of the worker that handled the request.
+     */
+    int server::request(const std::string& socket_path, const request_options& options, const std::string& source_path, std::vector<std::string>& arguments) {
+        sockaddr_un address = make_address(socket_path);
+
+        int conn = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if(conn < 0)
+            throw server_error("Failed to create the client socket: " + std::string(std::strerror(errno)) + ".");
+        if(::connect(conn, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0) {
+            ::close(conn);
+            throw server_error("Failed to connect to the server at <" + socket_path + ">: " + std::string(std::strerror(errno)) + ".");
+        }
+
+        // build the request
+        std::string payload;
+        payload += (options.m_check_only ? "check" : "run");
+        payload += '\0';
+        payload += boost::filesystem::current_path().string();
+        payload += '\0';
+        if(const char * avalon_home = std::getenv("AVALON_HOME"))
+            payload += avalon_home;
+        payload += '\0';
+        if(options.m_show_stats)
+            payload += (options.m_stats_json ? "json" : "text");
+        payload += '\0';
+        payload += (options.m_qstats ? "1" : "0");
+        payload += '\0';
+        payload += options.m_profile_path;
+        payload += '\0';
+        payload += options.m_trace_path;
+        payload += '\0';
+        if(options.m_unbuffered)
+            payload += "unbuffered";
+        else if(options.m_out_buffer_size > 0)
+            payload += std::to_string(options.m_out_buffer_size);
+        payload += '\0';
+        payload += source_path;
+        payload += '\0';
+        for(auto& argument : arguments) {
+            payload += argument;
+            payload += '\0';
+        }
+
+        // the server would refuse the request anyway
+        if(payload.size() > max_request_size) {
+            ::close(conn);
+            throw server_error("The request of " + std::to_string(payload.size()) + " bytes is larger than the maximum of " + std::to_string(max_request_size) + " bytes the server accepts.");
+        }
+
+        // send its size along with our standard input, output and error then the request itself
+        std::uint32_t size = payload.size();
+        int fds[3] = {STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO};
+        char control[CMSG_SPACE(sizeof(fds))];
+        std::memset(control, 0, sizeof(control));
+        iovec iov;
+        iov.iov_base = &size;
+        iov.iov_len = sizeof(size);
+        msghdr msg;
+        std::memset(&msg, 0, sizeof(msg));
+        msg.msg_iov = &iov;
+        msg.msg_iovlen = 1;
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+        cmsghdr * cmsg = CMSG_FIRSTHDR(&msg);
+        cmsg -> cmsg_level = SOL_SOCKET;
+        cmsg -> cmsg_type = SCM_RIGHTS;
+        cmsg -> cmsg_len = CMSG_LEN(sizeof(fds));
+        std::memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+
+        std::cout.flush();
+        if(::sendmsg(conn, &msg, 0) != sizeof(size) || write_all(conn, payload.data(), payload.size()) == false) {
+            ::close(conn);
+            throw server_error("Failed to send the request to the server at <" + socket_path + ">.");
+        }
+
+        // wait for the worker to finish
+        std::int32_t status = 1;
+        if(read_all(conn, reinterpret_cast<char *>(&status), sizeof(status)) == false) {
+            ::close(conn);
+            throw server_error("The server at <" + socket_path + "> did not answer.");
+        }
+
+        ::close(conn);
+        return status;
+    }
+}
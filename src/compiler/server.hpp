@@ -0,0 +1,140 @@
+/*
+ *  This file is part of the Avalon programming language
+ * 
+ *  Copyright (c) 2018 Ntwali Bashige Toussaint
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#ifndef AVALON_COMPILER_SERVER_HPP_
+#define AVALON_COMPILER_SERVER_HPP_
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <string>
+
+
+namespace avalon {
+    /**
+     * server
+     * keeps parsed programs resident in memory and runs programs on behalf of clients connecting over a unix socket.
+     * each request is run in a forked worker: the worker gets a private copy of the parsed programs it can check
+     * and interpret freely while the server itself only ever parses, so files that did not change are never parsed again.
+     * only parsing is saved: every worker imports, checks and cleans the program from scratch.
+     * the client hands over its standard input, output and error so the program behaves as if it was run directly.
+     */
+    class server {
+    public:
+        /**
+         * request_options
+         * the options given to the client that the worker running the program must honor
+         */
+        struct request_options {
+            request_options();
+
+            /*
+             * whether the program is only checked instead of being run
+             */
+            bool m_check_only;
+
+            /*
+             * whether a per-phase report is printed and whether it is printed as json
+             */
+            bool m_show_stats;
+            bool m_stats_json;
+
+            /*
+             * whether the quantum processor reports what it did
+             */
+            bool m_qstats;
+
+            /*
+             * where the profiler writes collapsed stacks, profiling is disabled if empty
+             */
+            std::string m_profile_path;
+
+            /*
+             * where the tracer writes its binary trace, tracing is disabled if empty
+             */
+            std::string m_trace_path;
+
+            /*
+             * how many bytes of program output are buffered, the default is used if zero
+             */
+            std::size_t m_out_buffer_size;
+
+            /*
+             * whether program output is written as soon as it is printed
+             */
+            bool m_unbuffered;
+        };
+
+        /**
+         * the constructor expects the path to the unix socket to listen on
+         */
+        server(const std::string& socket_path);
+
+        /**
+         * serve
+         * listens for requests forever.
+         * requests are accepted one at a time: the program and its imports are parsed by the server itself,
+         * the handler it forks then runs the program while the server goes on accepting the next request.
+         */
+        void serve();
+
+        /**
+         * request
+         * connects to the server listening on the given socket and asks it to check or interpret the given program.
+         * returns the exit status of the worker that handled the request.
+         */
+        static int request(const std::string& socket_path, const request_options& options, const std::string& source_path, std::vector<std::string>& arguments);
+
+    private:
+        /**
+         * handle
+         * reads a request from the given client, preloads the program then hands it over to a handler process
+         * that runs it in a worker and reports the worker's exit status to the client
+         */
+        void handle(int client);
+
+        /**
+         * run_worker
+         * runs the requested program in the current process, which is expected to be a forked worker
+         */
+        void run_worker(std::vector<std::string>& fields, int in, int out, int err);
+
+        /**
+         * the path to the unix socket we listen on
+         */
+        std::string m_socket_path;
+
+        /*
+         * the largest request payload the server accepts, in bytes
+         */
+        static const std::uint32_t max_request_size;
+
+        /*
+         * how long the server waits for a client to send its request, in seconds
+         */
+        static const int request_timeout;
+    };
+}
+
+#endif
@@ -25,6 +25,8 @@
 #ifndef AVALON_ERROR_HPP_
 #define AVALON_ERROR_HPP_
 
+#include <string>
+
 
 namespace avalon {
     class error {
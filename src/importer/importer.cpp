@@ -45,6 +45,8 @@
 #include "representer/builtins/lang/avalon_maybe.hpp"
 #include "representer/builtins/lang/avalon_float.hpp"
 #include "representer/builtins/lang/avalon_cgate.hpp"
+#include "representer/builtins/lang/avalon_list.hpp"
+#include "representer/builtins/lang/avalon_map.hpp"
 #include "representer/builtins/lang/avalon_gate.hpp"
 #include "representer/builtins/lang/avalon_void.hpp"
 #include "representer/builtins/lang/avalon_bool.hpp"
@@ -274,6 +276,21 @@ importer::importer(program& prog, std::vector<std::string>& search_paths, error&
         m_sorted_deps.push(int_prog.get_fqn().get_name());
         m_gtable.add_program(int_prog);
 
+        // list declarations
+        type_instance list_param_instance(type_param_a_tok, "*");
+        avalon_list avl_list(list_param_instance);
+        program& list_prog = avl_list.get_program();
+        m_sorted_deps.push(list_prog.get_fqn().get_name());
+        m_gtable.add_program(list_prog);
+
+        // map declarations
+        type_instance map_key_instance(type_param_a_tok, "*");
+        type_instance map_value_instance(type_param_b_tok, "*");
+        avalon_map avl_map(map_key_instance, map_value_instance);
+        program& map_prog = avl_map.get_program();
+        m_sorted_deps.push(map_prog.get_fqn().get_name());
+        m_gtable.add_program(map_prog);
+
         // bit declarations
         avalon_bit avl_bit;
         program& bit_prog = avl_bit.get_program();
@@ -521,6 +538,23 @@ importer::importer(program& prog, std::vector<std::string>& search_paths, error&
         std::shared_ptr<decl> final_int_import = int_import;
         to.add_declaration(final_int_import);
 
+        // list declarations
+        type_instance list_param_instance(type_param_a_tok, "*");
+        avalon_list avl_list(list_param_instance);
+        program& list_prog = avl_list.get_program();
+        std::shared_ptr<import> list_import = std::make_shared<import>(import_tok, list_prog.get_fqn().get_name());
+        std::shared_ptr<decl> final_list_import = list_import;
+        to.add_declaration(final_list_import);
+
+        // map declarations
+        type_instance map_key_instance(type_param_a_tok, "*");
+        type_instance map_value_instance(type_param_b_tok, "*");
+        avalon_map avl_map(map_key_instance, map_value_instance);
+        program& map_prog = avl_map.get_program();
+        std::shared_ptr<import> map_import = std::make_shared<import>(import_tok, map_prog.get_fqn().get_name());
+        std::shared_ptr<decl> final_map_import = map_import;
+        to.add_declaration(final_map_import);
+
         // string declarations
         avalon_string avl_string;
         program& string_prog = avl_string.get_program();
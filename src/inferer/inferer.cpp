@@ -88,7 +88,11 @@
 /* Lexer */
 #include "lexer/token.hpp"
 
+/* Utils */
+#include "utils/stats.hpp"
+
 /* Exceptions */
+#include "representer/exceptions/symbol_already_declared.hpp"
 #include "representer/exceptions/symbol_can_collide.hpp"
 #include "representer/exceptions/symbol_not_found.hpp"
 #include "checker/exceptions/invalid_expression.hpp"
@@ -467,6 +471,19 @@ static type_instance build_function(function& new_fun, const token& error_tok, c
     // add the specialization to the root function
     fun -> add_specialization(new_fun);
     fun -> is_used(true);
+    stats::count_specialization();
+
+    // the interpreter finds the specialization in the scope of the caller so we record it there while we know it,
+    // this way the scopes the cleaner copies already hold every specialization called from an imported program
+    std::shared_ptr<function>& specialization = fun -> get_specializations().at(new_fun.get_name());
+    const std::string& fun_ns_name = new_fun.get_namespace();
+    if(l_scope -> function_exists(fun_ns_name, specialization) == false) {
+        try {
+            l_scope -> add_function(fun_ns_name, specialization);
+        } catch(const symbol_already_declared& err) {
+        } catch(const symbol_can_collide& err) {
+        }
+    }
 
     // the return type of the function is the type instance of the expression
     type_instance& fun_instance = new_fun.get_return_type_instance();
@@ -481,6 +498,59 @@ static type_instance build_function(function& new_fun, const token& error_tok, c
     return fun_instance;
 }
 
+/**
+ * is_native_key
+ * returns true if map keys of the given type instance are hashed and compared by the interpreter without calling a __hash__ function
+ */
+static bool is_native_key(type_instance& key_instance) {
+    static std::vector<type_instance> native_instances = {
+        avalon_bool().get_type_instance(),
+        avalon_int().get_type_instance(),
+        avalon_float().get_type_instance(),
+        avalon_string().get_type_instance(),
+        avalon_bit().get_type_instance(),
+        avalon_bit2().get_type_instance(),
+        avalon_bit4().get_type_instance(),
+        avalon_bit8().get_type_instance()
+    };
+
+    for(auto& native_instance : native_instances)
+        if(type_instance_strong_compare(key_instance, native_instance))
+            return true;
+    return false;
+}
+
+/**
+ * find_key_comparator
+ * returns the name of the __eq__ function that compares map keys of the given custom type
+ * an empty name is returned if the type has no such function, in which case keys are the same key when their hashes are equal
+ */
+static std::string find_key_comparator(const token& error_tok, type_instance& key_instance, std::shared_ptr<scope>& l_scope) {
+    avalon_bool avl_bool;
+    type_instance bool_instance = avl_bool.get_type_instance();
+    std::string eq_name = "__eq__";
+    std::vector<type_instance> eq_instances { key_instance, key_instance };
+    std::vector<type_instance> eq_constraint_instances;
+    std::vector<token> eq_standins;
+
+    // only a missing __eq__ function makes us fall back to the hash, an invalid one is an error
+    try {
+        find_function(eq_name, eq_instances, bool_instance, l_scope, key_instance.get_namespace(), eq_standins);
+    } catch(const symbol_not_found& err) {
+        return "";
+    } catch(const invalid_type& err) {
+        throw invalid_expression(error_tok, "The __eq__ function for <" + mangle_type_instance(key_instance) + "> cannot be used to compare map keys. Details : " + std::string(err.what()));
+    }
+
+    function eq_fun(star_tok);
+    try {
+        build_function(eq_fun, error_tok, eq_name, eq_instances, bool_instance, eq_constraint_instances, eq_standins, l_scope, key_instance.get_namespace());
+    } catch(const invalid_expression& err) {
+        throw invalid_expression(err.get_token(), "The __eq__ function for <" + mangle_type_instance(key_instance) + "> cannot be used to compare map keys. Details : " + std::string(err.what()));
+    }
+    return eq_fun.get_name();
+}
+
 
 /**
  * the default constructor expects nothing
@@ -492,7 +562,7 @@ inferer::inferer() {
      * infer
      * given an expression, this function infers the type instance of said expression and returns it
      */
-    type_instance inferer::infer(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope> l_scope, const std::string& ns_name) {
+    type_instance inferer::infer(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         if(an_expression -> is_underscore_expression()) {
             return infer_underscore(an_expression);
         }
@@ -562,7 +632,7 @@ inferer::inferer() {
      * infer_reference
      * infers the type instance of a reference
      */
-    type_instance inferer::infer_reference(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope> l_scope, const std::string& ns_name) {
+    type_instance inferer::infer_reference(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         std::shared_ptr<reference_expression> const & ref_expr = std::static_pointer_cast<reference_expression>(an_expression);
         std::shared_ptr<expr>& val = ref_expr -> get_val();
 
@@ -750,7 +820,7 @@ inferer::inferer() {
      * infer_reference
      * infers the type instance of a dereference
      */
-    type_instance inferer::infer_dereference(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope> l_scope, const std::string& ns_name) {
+    type_instance inferer::infer_dereference(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         std::shared_ptr<dereference_expression> const & dref_expr = std::static_pointer_cast<dereference_expression>(an_expression);
         std::shared_ptr<variable>& var_decl = dref_expr -> get_variable();
         type_instance var_instance = var_decl -> get_type_instance();
@@ -820,7 +890,7 @@ inferer::inferer() {
      * infer_literal
      * infers the type instance of a literal
      */
-    type_instance inferer::infer_literal(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope> l_scope, const std::string& ns_name) {
+    type_instance inferer::infer_literal(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         std::shared_ptr<literal_expression> const & lit_expr = std::static_pointer_cast<literal_expression>(an_expression);
 
         // if the expression already has a type instance set, we return that
@@ -935,7 +1005,7 @@ inferer::inferer() {
      * infer_tuple
      * infers the type instance of a tuple
      */
-    type_instance inferer::infer_tuple(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope> l_scope, const std::string& ns_name) {
+    type_instance inferer::infer_tuple(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         std::shared_ptr<tuple_expression> const & tup_expr = std::static_pointer_cast<tuple_expression>(an_expression);
         
         // if the expression already has a type instance set, we return that
@@ -1004,7 +1074,7 @@ inferer::inferer() {
      * infer_list
      * infers the type instance of a list
      */
-    type_instance inferer::infer_list(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope> l_scope, const std::string& ns_name) {
+    type_instance inferer::infer_list(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         std::shared_ptr<list_expression> const & list_expr = std::static_pointer_cast<list_expression>(an_expression);
         
         // if the expression already has a type instance set, we return that
@@ -1087,7 +1157,7 @@ inferer::inferer() {
      * infer_map
      * infers the type instance of a map
      */
-    type_instance inferer::infer_map(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope> l_scope, const std::string& ns_name) {
+    type_instance inferer::infer_map(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         std::shared_ptr<map_expression> const & map_expr = std::static_pointer_cast<map_expression>(an_expression);
         
         // if the expression already has a type instance set, we return that
@@ -1123,6 +1193,26 @@ inferer::inferer() {
         // it can be a parser provided one or the generic type instance (signaling a lack of user provided type instance)
         std::vector<std::pair<std::shared_ptr<expr>, std::shared_ptr<expr> > >& elements = map_expr -> get_elements();
         if(elements.size() == 0) {
+            // an empty map can still be filled later so we need the hash function of its keys if they are of a custom type
+            if(has_parser_type_instance && map_expr -> get_callee().empty()) {
+                type_instance key_instance = parser_type_instance.get_params()[0];
+                if(is_native_key(key_instance) == false) {
+                    avalon_int avl_int;
+                    type_instance int_instance = avl_int.get_type_instance();
+                    function hash_fun(star_tok);
+                    std::string hash_name = "__hash__";
+                    std::vector<type_instance> hash_instances { key_instance };
+                    std::vector<type_instance> hash_constraint_instances;
+                    std::vector<token> hash_standins;
+                    try {
+                        build_function(hash_fun, parser_type_instance.get_token(), hash_name, hash_instances, int_instance, hash_constraint_instances, hash_standins, l_scope, key_instance.get_namespace());
+                        map_expr -> set_callee(hash_fun.get_name());
+                    } catch(const invalid_expression& err) {
+                        throw invalid_expression(err.get_token(), "There needs to be exactly one __hash__ function for <" + mangle_type_instance(key_instance) + ">. Details : " + std::string(err.what()));
+                    }
+                    map_expr -> set_comparator_callee(find_key_comparator(parser_type_instance.get_token(), key_instance, l_scope));
+                }
+            }
             return map_expr -> get_type_instance();
         }
 
@@ -1161,14 +1251,15 @@ inferer::inferer() {
             map_expr -> set_type_instance(inferred_type_instance, false);
         }
 
+        // keys of builtin types are hashed and compared by the interpreter directly
+        if(is_native_key(first_element_key_instance)) {
+            return final_instance;
+        }
+
         // the int type instance is the base type instance for hashing
         avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
-        // the equality comparator function returns a boolean
-        avalon_bool avl_bool;
-        type_instance bool_instance = avl_bool.get_type_instance();
-
         // deduce the hashing function
         std::string hash_name = "__hash__";
         const token& first_element_tok = first_element.first -> expr_token();
@@ -1187,15 +1278,8 @@ inferer::inferer() {
             throw invalid_expression(err.get_token(), "There needs to be exactly one __hash__ function for <" + mangle_type_instance(first_element_key_instance) + ">. Details : " + std::string(err.what()));
         }
 
-        // deduce the hash comparator function (which is the int equality comparator function)
-        function eq_fun(star_tok);
-        std::string eq_name = "__eq__";
-        token eq_tok(first_element_tok.get_type(), eq_name, first_element_tok.get_line(), first_element_tok.get_column(), first_element_tok.get_source_path());
-        std::vector<type_instance> eq_instances { int_instance, int_instance };
-        std::vector<type_instance> eq_constraint_instances;
-        std::vector<token> eq_standins;
-        build_function(eq_fun, eq_tok, eq_name, eq_instances, bool_instance, eq_constraint_instances, eq_standins, l_scope, "*");
-        map_expr -> set_comparator_callee(eq_fun.get_name());
+        // keys with equal hashes are told apart by the __eq__ function of their type if it has one
+        map_expr -> set_comparator_callee(find_key_comparator(first_element_tok, first_element_key_instance, l_scope));
 
         return final_instance;
     }
@@ -1204,7 +1288,7 @@ inferer::inferer() {
      * infer_call
      * infers the type instance of a call expression
      */
-    type_instance inferer::infer_call(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope> l_scope, const std::string& ns_name) {
+    type_instance inferer::infer_call(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         std::shared_ptr<call_expression> const & call_expr = std::static_pointer_cast<call_expression>(an_expression);
         
         if(call_expr -> get_expression_type() == DEFAULT_CONSTRUCTOR_EXPR) {
@@ -1223,7 +1307,7 @@ inferer::inferer() {
      * infer_default_constructor
      * infers the type instance of a default constructor expression
      */
-    type_instance inferer::infer_default_constructor(std::shared_ptr<call_expression> const & call_expr, std::shared_ptr<scope> l_scope, const std::string& ns_name) {
+    type_instance inferer::infer_default_constructor(std::shared_ptr<call_expression> const & call_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         const std::string& sub_ns_name = call_expr -> get_namespace();
 
         // if the expression already has a type instance, we return it
@@ -1314,7 +1398,7 @@ inferer::inferer() {
      * infer_record_constructor
      * infers the type instance of a record constructor expression
      */
-    type_instance inferer::infer_record_constructor(std::shared_ptr<call_expression> const & call_expr, std::shared_ptr<scope> l_scope, const std::string& ns_name) {
+    type_instance inferer::infer_record_constructor(std::shared_ptr<call_expression> const & call_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         const std::string& sub_ns_name = call_expr -> get_namespace();
 
         // if the expression already has a type instance, we return it
@@ -1405,7 +1489,7 @@ inferer::inferer() {
      * infer_function_call
      * infers the type instance of a function call expression
      */
-    type_instance inferer::infer_function_call(function& new_fun, std::shared_ptr<call_expression> const & call_expr, std::shared_ptr<scope> l_scope, const std::string& ns_name) {
+    type_instance inferer::infer_function_call(function& new_fun, std::shared_ptr<call_expression> const & call_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         const std::string& sub_ns_name = call_expr -> get_namespace();
 
         // we get all the data we can get from the call expression
@@ -1432,7 +1516,7 @@ inferer::inferer() {
      * infer_identifier
      * infers the type instance of an identifier expression
      */
-    type_instance inferer::infer_identifier(std::shared_ptr<expr> & an_expression, std::shared_ptr<scope> l_scope, const std::string& ns_name) {
+    type_instance inferer::infer_identifier(std::shared_ptr<expr> & an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         std::shared_ptr<identifier_expression> const & id_expr = std::static_pointer_cast<identifier_expression>(an_expression);
         
         if(id_expr -> get_expression_type() == VAR_EXPR) {
@@ -1447,7 +1531,7 @@ inferer::inferer() {
      * infer_variable
      * infers the type instance of a variable expression
      */
-    type_instance inferer::infer_variable(std::shared_ptr<identifier_expression> const & id_expr, std::shared_ptr<scope> l_scope, const std::string& ns_name) {
+    type_instance inferer::infer_variable(std::shared_ptr<identifier_expression> const & id_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         const std::string& sub_ns_name = id_expr -> get_namespace();
 
         // if the expression already has a type instance, we return it
@@ -1505,7 +1589,7 @@ inferer::inferer() {
      * infer_constructor
      * infers the type instance of an identifier constructor expression
      */
-    type_instance inferer::infer_constructor(std::shared_ptr<identifier_expression> const & id_expr, std::shared_ptr<scope> l_scope, const std::string& ns_name) {
+    type_instance inferer::infer_constructor(std::shared_ptr<identifier_expression> const & id_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         const std::string& sub_ns_name = id_expr -> get_namespace();
 
         // if the expression already has a type instance, we return it
@@ -1575,7 +1659,7 @@ inferer::inferer() {
      * infer_grouping
      * infers the type instance of a grouped expressino
      */
-    type_instance inferer::infer_grouping(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope> l_scope, const std::string& ns_name) {
+    type_instance inferer::infer_grouping(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         std::shared_ptr<grouped_expression> const & group_expr = std::static_pointer_cast<grouped_expression>(an_expression);
 
         // if the expression already has a type instance, we return it
@@ -1593,13 +1677,13 @@ inferer::inferer() {
      * infer_cast
      * infers the type instance of a cast expression
      */
-    type_instance inferer::infer_cast(std::shared_ptr<expr> & an_expression, std::shared_ptr<scope> l_scope, const std::string& ns_name) {
+    type_instance inferer::infer_cast(std::shared_ptr<expr> & an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         std::shared_ptr<cast_expression> const & cast_expr = std::static_pointer_cast<cast_expression>(an_expression);
         function cast_fun(star_tok);
         return infer_cast(cast_fun, cast_expr, l_scope, ns_name);
     }
 
-    type_instance inferer::infer_cast(function& cast_fun, std::shared_ptr<cast_expression> const & cast_expr, std::shared_ptr<scope> l_scope, const std::string& ns_name) {
+    type_instance inferer::infer_cast(function& cast_fun, std::shared_ptr<cast_expression> const & cast_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         type_instance& cast_instance = cast_expr -> get_cast_type_instance();
         std::shared_ptr<expr>& value = cast_expr -> get_val();
         type_instance value_instance = infer(value, l_scope, ns_name);
@@ -1621,7 +1705,7 @@ inferer::inferer() {
      * infer_unary
      * infers the type instance of a unary expression
      */
-    type_instance inferer::infer_unary(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope> l_scope, const std::string& ns_name) {
+    type_instance inferer::infer_unary(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         std::shared_ptr<unary_expression> const & unary_expr = std::static_pointer_cast<unary_expression>(an_expression);
         function unary_fun(star_tok);
         type_instance instance = infer_unary(unary_fun, unary_expr, l_scope, ns_name);
@@ -1629,7 +1713,7 @@ inferer::inferer() {
         return instance;
     }
 
-    type_instance inferer::infer_unary(function& unary_fun, std::shared_ptr<unary_expression> const & unary_expr, std::shared_ptr<scope> l_scope, const std::string& ns_name) {
+    type_instance inferer::infer_unary(function& unary_fun, std::shared_ptr<unary_expression> const & unary_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         std::string fun_name = "";
         std::shared_ptr<expr>& value = unary_expr -> get_val();
 
@@ -1669,7 +1753,7 @@ inferer::inferer() {
      * infer_binary
      * infers the type instance of a binary expression
      */
-    type_instance inferer::infer_binary(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope> l_scope, const std::string& ns_name) {
+    type_instance inferer::infer_binary(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         std::shared_ptr<binary_expression> const & binary_expr = std::static_pointer_cast<binary_expression>(an_expression);
         function binary_fun(star_tok);
         type_instance instance = infer_binary(binary_fun, binary_expr, l_scope, ns_name);
@@ -1681,7 +1765,7 @@ inferer::inferer() {
      * infer_binary
      * infers the type instance of a binary expression
      */
-    type_instance inferer::infer_binary(function& binary_fun, std::shared_ptr<binary_expression> const & binary_expr, std::shared_ptr<scope> l_scope, const std::string& ns_name) {
+    type_instance inferer::infer_binary(function& binary_fun, std::shared_ptr<binary_expression> const & binary_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         binary_expression_type expr_type = binary_expr -> get_expression_type();
 
         // work on operations that decay into functions
@@ -1727,7 +1811,7 @@ inferer::inferer() {
      * infer_functional_binary
      * infers the type instance of a binary expression that immediately decays into a function call
      */
-    type_instance inferer::infer_functional_binary(binary_expression_type& expr_type, function& binary_fun, std::shared_ptr<binary_expression> const & binary_expr, std::shared_ptr<scope> l_scope, const std::string& ns_name) {
+    type_instance inferer::infer_functional_binary(binary_expression_type& expr_type, function& binary_fun, std::shared_ptr<binary_expression> const & binary_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         std::string fun_name = "";
         std::shared_ptr<expr>& lval = binary_expr -> get_lval();
         std::shared_ptr<expr>& rval = binary_expr -> get_rval();
@@ -1816,7 +1900,7 @@ inferer::inferer() {
      * infer_is_binary
      * infers the type instance of the IS and IS NOT expressions
      */
-    type_instance inferer::infer_is_binary(std::shared_ptr<binary_expression> const & binary_expr, std::shared_ptr<scope> l_scope, const std::string& ns_name) {
+    type_instance inferer::infer_is_binary(std::shared_ptr<binary_expression> const & binary_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         avalon_bool avl_bool;
         return avl_bool.get_type_instance();
     }
@@ -1825,7 +1909,7 @@ inferer::inferer() {
      * infer_getattr_binary
      * infers the type instance of a binary expression arising from the dot operator
      */
-    type_instance inferer::infer_dot_binary(std::shared_ptr<binary_expression> const & binary_expr, std::shared_ptr<scope> l_scope, const std::string& ns_name) {
+    type_instance inferer::infer_dot_binary(std::shared_ptr<binary_expression> const & binary_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         std::shared_ptr<expr>& lval = binary_expr -> get_lval();
         std::shared_ptr<expr>& rval = binary_expr -> get_rval();
         const std::string& name = lval -> expr_token().get_lexeme();
@@ -1848,7 +1932,7 @@ inferer::inferer() {
      * infer_subscript_binary
      * infers the type instance of a binary expression arising from the subscript operator
      */
-    type_instance inferer::infer_subscript_binary(std::shared_ptr<binary_expression> const & binary_expr, std::shared_ptr<scope> l_scope, const std::string& ns_name) {
+    type_instance inferer::infer_subscript_binary(std::shared_ptr<binary_expression> const & binary_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         std::shared_ptr<expr>& lval = binary_expr -> get_lval();
         std::shared_ptr<expr>& rval = binary_expr -> get_rval();
         const std::string& name = lval -> expr_token().get_lexeme();        
@@ -1950,7 +2034,8 @@ inferer::inferer() {
         std::shared_ptr<expr>& var_value = var_decl -> get_value();
 
         // if the lval contains a named tuple
-        if(var_value -> is_tuple_expression()) {
+        // function parameters have no value until the function is called
+        if(var_value != nullptr && var_value -> is_tuple_expression()) {
             return infer_tuple_attribute(var_value, rval, l_scope, ns_name);
         }
         else {
@@ -1973,9 +2058,15 @@ inferer::inferer() {
 
     type_instance inferer::infer_custom_attribute(std::shared_ptr<expr>& lval, std::shared_ptr<expr>& rval, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         type_instance lval_instance = infer(lval, l_scope, ns_name);
-
-        // we build the function call expression for __getattr__ from which the type instance will be infered
         token rval_tok = rval -> expr_token();
+
+        // if the attribute is a field of the record the lval holds, its type instance is that of the field
+        std::size_t field_index = 0;
+        type_instance field_instance;
+        if(get_record_field(lval_instance, rval_tok, field_index, field_instance))
+            return field_instance;
+
+        // otherwise we build the function call expression for __getattr__ from which the type instance will be infered
         std::string call_name = "__getattr_" + rval_tok.get_lexeme() + "__";
         token call_tok(rval_tok.get_type(), call_name, rval_tok.get_line(), rval_tok.get_column(), rval_tok.get_source_path());
         std::shared_ptr<call_expression> getattr_expr = std::make_shared<call_expression>(call_tok);
@@ -2054,7 +2145,7 @@ inferer::inferer() {
      * infer_match
      * infers the type instance of a match expression
      */
-    type_instance inferer::infer_match(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope> l_scope, const std::string& ns_name) {
+    type_instance inferer::infer_match(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         avalon_bool avl_bool;
         return avl_bool.get_type_instance();
     }
@@ -2063,7 +2154,7 @@ inferer::inferer() {
      * infer_conditional
      * infers the type instance of a conditional expression
      */
-    type_instance inferer::infer_conditional(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope> l_scope, const std::string& ns_name) {
+    type_instance inferer::infer_conditional(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         std::shared_ptr<conditional_expression> const & cond_expr = std::static_pointer_cast<conditional_expression>(an_expression);
         std::shared_ptr<expr>& if_expression = cond_expr -> get_if_expression();
 
@@ -2074,7 +2165,7 @@ inferer::inferer() {
      * infer_assignment
      * infers the type instance of an assigment expression
      */
-    type_instance inferer::infer_assignment(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope> l_scope, const std::string& ns_name) {
+    type_instance inferer::infer_assignment(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         std::shared_ptr<assignment_expression> const & assign_expr = std::static_pointer_cast<assignment_expression>(an_expression);
         std::shared_ptr<expr>& lval = assign_expr -> get_lval();
         return infer(lval, l_scope, ns_name);
@@ -51,79 +51,79 @@ namespace avalon {
          * infer
          * given an expression, this function infers the type instance of said expression and returns it
          */
-        type_instance infer(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope> l_scope, const std::string& ns_name);
+        type_instance infer(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
 
         /**
          * infer_default_constructor
          * infers the type instance of a default constructor expression
          */
-        type_instance infer_default_constructor(std::shared_ptr<call_expression> const & call_expr, std::shared_ptr<scope> l_scope, const std::string& ns_name);
+        type_instance infer_default_constructor(std::shared_ptr<call_expression> const & call_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
 
         /**
          * infer_record_constructor
          * infers the type instance of a record constructor expression
          */
-        type_instance infer_record_constructor(std::shared_ptr<call_expression> const & call_expr, std::shared_ptr<scope> l_scope, const std::string& ns_name);
+        type_instance infer_record_constructor(std::shared_ptr<call_expression> const & call_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
 
         /**
          * infer_function_call
          * infers the type instance of a function call expression
          */
-        type_instance infer_function_call(function& new_fun, std::shared_ptr<call_expression> const & call_expr, std::shared_ptr<scope> l_scope, const std::string& ns_name);
+        type_instance infer_function_call(function& new_fun, std::shared_ptr<call_expression> const & call_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
 
         /**
          * infer_variable
          * infers the type instance of a variable expression
          */
-        type_instance infer_variable(std::shared_ptr<identifier_expression> const & id_expr, std::shared_ptr<scope> l_scope, const std::string& ns_name);
+        type_instance infer_variable(std::shared_ptr<identifier_expression> const & id_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
 
         /**
          * infer_constructor
          * infers the type instance of an identifier constructor expression
          */
-        type_instance infer_constructor(std::shared_ptr<identifier_expression> const & id_expr, std::shared_ptr<scope> l_scope, const std::string& ns_name);
+        type_instance infer_constructor(std::shared_ptr<identifier_expression> const & id_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
 
         /**
          * infer_cast
          * infers the type instance of a cast expression
          */
-        type_instance infer_cast(function& cast_fun, std::shared_ptr<cast_expression> const & cast_expr, std::shared_ptr<scope> l_scope, const std::string& ns_name);
+        type_instance infer_cast(function& cast_fun, std::shared_ptr<cast_expression> const & cast_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
 
         /**
          * infer_unary
          * infers the type instance of a unary expression
          */
-        type_instance infer_unary(function& unary_fun, std::shared_ptr<unary_expression> const & unary_expr, std::shared_ptr<scope> l_scope, const std::string& ns_name);
+        type_instance infer_unary(function& unary_fun, std::shared_ptr<unary_expression> const & unary_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
 
         /**
          * infer_unary
          * infers the type instance of a binary expression
          */
-        type_instance infer_binary(function& binary_fun, std::shared_ptr<binary_expression> const & binary_expr, std::shared_ptr<scope> l_scope, const std::string& ns_name);
+        type_instance infer_binary(function& binary_fun, std::shared_ptr<binary_expression> const & binary_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
 
         /**
          * infer_functional_binary
          * infers the type instance of a binary expression that immediately decays into a function call
          */
-        type_instance infer_functional_binary(binary_expression_type& expr_type, function& binary_fun, std::shared_ptr<binary_expression> const & binary_expr, std::shared_ptr<scope> l_scope, const std::string& ns_name);
+        type_instance infer_functional_binary(binary_expression_type& expr_type, function& binary_fun, std::shared_ptr<binary_expression> const & binary_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
 
         /**
          * infer_is_binary
          * infers the type instance of the IS and IS NOT expressions
          */
-        type_instance infer_is_binary(std::shared_ptr<binary_expression> const & binary_expr, std::shared_ptr<scope> l_scope, const std::string& ns_name);
+        type_instance infer_is_binary(std::shared_ptr<binary_expression> const & binary_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
 
         /**
          * infer_getattr_binary
          * infers the type instance of a binary expression arising from the dot operator
          */
-        type_instance infer_dot_binary(std::shared_ptr<binary_expression> const & binary_expr, std::shared_ptr<scope> l_scope, const std::string& ns_name);
+        type_instance infer_dot_binary(std::shared_ptr<binary_expression> const & binary_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
 
         /**
          * infer_subscript_binary
          * infers the type instance of a binary expression arising from the subscript operator
          */
-        type_instance infer_subscript_binary(std::shared_ptr<binary_expression> const & binary_expr, std::shared_ptr<scope> l_scope, const std::string& ns_name);
+        type_instance infer_subscript_binary(std::shared_ptr<binary_expression> const & binary_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
 
         type_instance infer_namespace_binary(const std::string& sub_ns_name, std::shared_ptr<expr>& rval, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
         type_instance infer_variable_binary(std::shared_ptr<expr>& lval, std::shared_ptr<expr>& rval, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
@@ -147,7 +147,7 @@ namespace avalon {
          * infer_reference
          * infers the type instance of a reference
          */
-        type_instance infer_reference(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope> l_scope, const std::string& ns_name);
+        type_instance infer_reference(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
         type_instance infer_reference_variable(std::shared_ptr<expr>& rval, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
         type_instance infer_reference_binary(std::shared_ptr<binary_expression> const & bin_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name, const std::string& sub_ns_name);
         type_instance infer_reference_attribute(std::shared_ptr<binary_expression> const & bin_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name, const std::string& sub_ns_name);
@@ -161,7 +161,7 @@ namespace avalon {
          * infer_reference
          * infers the type instance of a dereference
          */
-        type_instance infer_dereference(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope> l_scope, const std::string& ns_name);
+        type_instance infer_dereference(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
         type_instance infer_dereference_variable(type_instance& var_instance);
         type_instance infer_dereference_binary(std::shared_ptr<binary_expression> const & bin_expr);
 
@@ -169,79 +169,79 @@ namespace avalon {
          * infer_literal
          * infers the type instance of a literal
          */
-        type_instance infer_literal(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope> l_scope, const std::string& ns_name);
+        type_instance infer_literal(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
 
         /**
          * infer_tuple
          * infers the type instance of a tuple
          */
-        type_instance infer_tuple(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope> l_scope, const std::string& ns_name);
+        type_instance infer_tuple(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
 
         /**
          * infer_list
          * infers the type instance of a list
          */
-        type_instance infer_list(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope> l_scope, const std::string& ns_name);
+        type_instance infer_list(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
 
         /**
          * infer_map
          * infers the type instance of a map
          */
-        type_instance infer_map(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope> l_scope, const std::string& ns_name);
+        type_instance infer_map(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
 
         /**
          * infer_call
          * infers the type instance of a call expression
          */
-        type_instance infer_call(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope> l_scope, const std::string& ns_name);
+        type_instance infer_call(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
 
         /**
          * infer_identifier
          * infers the type instance of an identifier expression
          */
-        type_instance infer_identifier(std::shared_ptr<expr> & an_expression, std::shared_ptr<scope> l_scope, const std::string& ns_name);
+        type_instance infer_identifier(std::shared_ptr<expr> & an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
 
         /**
          * infer_grouping
          * infers the type instance of a grouped expression
          */
-        type_instance infer_grouping(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope> l_scope, const std::string& ns_name);
+        type_instance infer_grouping(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
 
         /**
          * infer_cast
          * infers the type instance of a cast expression
          */
-        type_instance infer_cast(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope> l_scope, const std::string& ns_name);
+        type_instance infer_cast(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
 
         /**
          * infer_unary
          * infers the type instance of a unary expression
          */
-        type_instance infer_unary(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope> l_scope, const std::string& ns_name);
+        type_instance infer_unary(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
 
         /**
          * infer_binary
          * infers the type instance of a binary expression
          */
-        type_instance infer_binary(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope> l_scope, const std::string& ns_name);
+        type_instance infer_binary(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
 
         /**
          * infer_match
          * infers the type instance of a match expression
          */
-        type_instance infer_match(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope> l_scope, const std::string& ns_name);
+        type_instance infer_match(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
 
         /**
          * infer_conditional
          * infers the type instance of a conditional expression
          */
-        type_instance infer_conditional(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope> l_scope, const std::string& ns_name);
+        type_instance infer_conditional(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
 
         /**
          * infer_assignment
          * infers the type instance of an assigment expression
          */
-        type_instance infer_assignment(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope> l_scope, const std::string& ns_name);
+        type_instance infer_assignment(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
     };
 }
 
@@ -47,9 +47,10 @@
 
 namespace avalon {
     /**
-     * the constructor expects nothing
+     * the constructor expects the quantum processor quantum functions run on and the hasher map functions use for keys of custom types.
+     * the table of implementations is built once so a single instance should serve every builtin call.
      */
-    avalon_function::avalon_function(std::shared_ptr<function>& function_decl, std::shared_ptr<qprocessor>& qproc) : m_function_decl(function_decl), m_qproc(qproc) {
+    avalon_function::avalon_function(std::shared_ptr<qprocessor>& qproc, map_hasher& hasher) : m_qproc(qproc) {
         /* boolean functions */
         and_implementation avl_and_implementation;
         or_implementation avl_or_implementation;
@@ -69,6 +70,14 @@ namespace avalon {
         print_implementation avl_print_implementation;
         println_implementation avl_println_implementation;
         readln_implementation avl_readln_implementation;
+        fopen_implementation avl_fopen_implementation;
+        fsize_implementation avl_fsize_implementation;
+        fread_implementation avl_fread_implementation;
+        ftell_implementation avl_ftell_implementation;
+        freadln_implementation avl_freadln_implementation;
+        flines_implementation avl_flines_implementation;
+        fclose_implementation avl_fclose_implementation;
+        fresolve_implementation avl_fresolve_implementation;
 
         /* casting functions */
         cast_implementation avl_cast_implementation(m_qproc);
@@ -93,14 +102,32 @@ namespace avalon {
         bor_implementation avl_bor_implementation;
         xor_implementation avl_xor_implementation;
         bnot_implementation avl_bnot_implementation;
+        popcount_implementation avl_popcount_implementation;
 
         /* quantum functions */
         apply_implementation avl_apply_implementation(m_qproc);
         measure_implementation avl_measure_implementation(m_qproc);
+        qstats_implementation avl_qstats_implementation(m_qproc);
 
         /* getters functions */
         refitem_implementation avl_refitem_implementation;
 
+        /* list functions */
+        append_implementation avl_append_implementation;
+        pop_implementation avl_pop_implementation;
+        set_implementation avl_set_implementation;
+        reserve_implementation avl_reserve_implementation;
+        len_implementation avl_len_implementation;
+        slice_implementation avl_slice_implementation;
+
+        /* map functions */
+        insert_implementation avl_insert_implementation(hasher);
+        update_implementation avl_update_implementation(hasher);
+        remove_implementation avl_remove_implementation(hasher);
+        contains_implementation avl_contains_implementation(hasher);
+        keys_implementation avl_keys_implementation;
+        values_implementation avl_values_implementation;
+
         m_implementations = {
             /* boolean functions */
             {"__and__", std::make_shared<and_implementation>(avl_and_implementation)},
@@ -121,6 +148,14 @@ namespace avalon {
             {"__print__", std::make_shared<print_implementation>(avl_print_implementation)},
             {"__println__", std::make_shared<println_implementation>(avl_println_implementation)},
             {"__readln__", std::make_shared<readln_implementation>(avl_readln_implementation)},
+            {"__fopen__", std::make_shared<fopen_implementation>(avl_fopen_implementation)},
+            {"__fsize__", std::make_shared<fsize_implementation>(avl_fsize_implementation)},
+            {"__fread__", std::make_shared<fread_implementation>(avl_fread_implementation)},
+            {"__ftell__", std::make_shared<ftell_implementation>(avl_ftell_implementation)},
+            {"__freadln__", std::make_shared<freadln_implementation>(avl_freadln_implementation)},
+            {"__flines__", std::make_shared<flines_implementation>(avl_flines_implementation)},
+            {"__fclose__", std::make_shared<fclose_implementation>(avl_fclose_implementation)},
+            {"__fresolve__", std::make_shared<fresolve_implementation>(avl_fresolve_implementation)},
 
             /* casting functions */
             {"__cast__", std::make_shared<cast_implementation>(avl_cast_implementation)},
@@ -145,22 +180,40 @@ namespace avalon {
             {"__bor__", std::make_shared<bor_implementation>(avl_bor_implementation)},
             {"__xor__", std::make_shared<xor_implementation>(avl_xor_implementation)},
             {"__bnot__", std::make_shared<bnot_implementation>(avl_bnot_implementation)},
+            {"popcount", std::make_shared<popcount_implementation>(avl_popcount_implementation)},
 
             /* quantum functions */
             {"apply", std::make_shared<apply_implementation>(avl_apply_implementation)},
             {"measure", std::make_shared<measure_implementation>(avl_measure_implementation)},
+            {"qstats", std::make_shared<qstats_implementation>(avl_qstats_implementation)},
 
             /* getter functions */
             {"__refitem__", std::make_shared<refitem_implementation>(avl_refitem_implementation)},
+
+            /* list functions */
+            {"append", std::make_shared<append_implementation>(avl_append_implementation)},
+            {"pop", std::make_shared<pop_implementation>(avl_pop_implementation)},
+            {"set", std::make_shared<set_implementation>(avl_set_implementation)},
+            {"reserve", std::make_shared<reserve_implementation>(avl_reserve_implementation)},
+            {"len", std::make_shared<len_implementation>(avl_len_implementation)},
+            {"slice", std::make_shared<slice_implementation>(avl_slice_implementation)},
+
+            /* map functions */
+            {"insert", std::make_shared<insert_implementation>(avl_insert_implementation)},
+            {"update", std::make_shared<update_implementation>(avl_update_implementation)},
+            {"remove", std::make_shared<remove_implementation>(avl_remove_implementation)},
+            {"contains", std::make_shared<contains_implementation>(avl_contains_implementation)},
+            {"keys", std::make_shared<keys_implementation>(avl_keys_implementation)},
+            {"values", std::make_shared<values_implementation>(avl_values_implementation)},
         };
     }
 
     /**
      * run
-     * given the function arguments find the appropritate implementation and run the function
+     * given the function and its arguments find the appropritate implementation and run the function
      */
-    std::shared_ptr<expr> avalon_function::run(std::vector<std::shared_ptr<expr> >& arguments) {
-        const std::string& name = m_function_decl -> get_old_name();
+    std::shared_ptr<expr> avalon_function::run(std::shared_ptr<function>& function_decl, std::vector<std::shared_ptr<expr> >& arguments) {
+        const std::string& name = function_decl -> get_old_name();
         try {
             std::shared_ptr<function_implementation>& implementation = m_implementations.at(name);
             return (* implementation)(arguments);
@@ -169,8 +222,8 @@ namespace avalon {
         }
     }
 
-    std::shared_ptr<expr> avalon_function::run(std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance) {
-        const std::string& name = m_function_decl -> get_old_name();
+    std::shared_ptr<expr> avalon_function::run(std::shared_ptr<function>& function_decl, std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance) {
+        const std::string& name = function_decl -> get_old_name();
         try {
             std::shared_ptr<function_implementation>& implementation = m_implementations.at(name);
             return (* implementation)(arguments, ret_instance);
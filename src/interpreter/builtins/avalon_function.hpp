@@ -37,29 +37,26 @@
 #include "interpreter/qprocessor.hpp"
 
 #include "interpreter/builtins/function_implementation.hpp"
+#include "interpreter/builtins/lang/avalon_map.hpp"
 
 
 namespace avalon {
     class avalon_function {
     public:
         /**
-         * the constructor expects nothing
+         * the constructor expects the quantum processor quantum functions run on and the hasher map functions use for keys of custom types.
+         * the table of implementations is built once so a single instance should serve every builtin call.
          */
-        avalon_function(std::shared_ptr<function>& function_decl, std::shared_ptr<qprocessor>& qproc);
+        avalon_function(std::shared_ptr<qprocessor>& qproc, map_hasher& hasher);
 
         /**
          * run
-         * given the function arguments (and return type instance if available) find the appropritate implementation and run the function
+         * given the function and its arguments (and return type instance if available) find the appropritate implementation and run the function
          */
-        std::shared_ptr<expr> run(std::vector<std::shared_ptr<expr> >& arguments);
-        std::shared_ptr<expr> run(std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance);
+        std::shared_ptr<expr> run(std::shared_ptr<function>& function_decl, std::vector<std::shared_ptr<expr> >& arguments);
+        std::shared_ptr<expr> run(std::shared_ptr<function>& function_decl, std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance);
 
     private:
-        /*
-         * the function being currently run
-         */
-        std::shared_ptr<function>& m_function_decl;
-
         /*
          * the quantum processor
          */
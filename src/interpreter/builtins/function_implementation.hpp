@@ -37,6 +37,8 @@
 #include "interpreter/builtins/lang/avalon_comparison.hpp"
 #include "interpreter/builtins/lang/avalon_getters.hpp"
 #include "interpreter/builtins/lang/avalon_quantum.hpp"
+#include "interpreter/builtins/lang/avalon_list.hpp"
+#include "interpreter/builtins/lang/avalon_map.hpp"
 #include "interpreter/builtins/lang/avalon_logic.hpp"
 #include "interpreter/builtins/lang/avalon_bool.hpp"
 #include "interpreter/builtins/lang/avalon_cast.hpp"
@@ -254,6 +256,118 @@ namespace avalon {
         }
     };
 
+    /**
+     * fopen_implementation
+     * implements the builtin __fopen__ function
+     */
+    struct fopen_implementation : function_implementation {
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments) {
+            return avl_fopen(arguments);
+        }
+
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance) {
+            return avl_fopen(arguments);
+        }
+    };
+
+    /**
+     * fsize_implementation
+     * implements the builtin __fsize__ function
+     */
+    struct fsize_implementation : function_implementation {
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments) {
+            return avl_fsize(arguments);
+        }
+
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance) {
+            return avl_fsize(arguments);
+        }
+    };
+
+    /**
+     * fread_implementation
+     * implements the builtin __fread__ function
+     */
+    struct fread_implementation : function_implementation {
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments) {
+            return avl_fread(arguments);
+        }
+
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance) {
+            return avl_fread(arguments);
+        }
+    };
+
+    /**
+     * ftell_implementation
+     * implements the builtin __ftell__ function
+     */
+    struct ftell_implementation : function_implementation {
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments) {
+            return avl_ftell(arguments);
+        }
+
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance) {
+            return avl_ftell(arguments);
+        }
+    };
+
+    /**
+     * freadln_implementation
+     * implements the builtin __freadln__ function
+     */
+    struct freadln_implementation : function_implementation {
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments) {
+            return avl_freadln(arguments);
+        }
+
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance) {
+            return avl_freadln(arguments);
+        }
+    };
+
+    /**
+     * flines_implementation
+     * implements the builtin __flines__ function
+     */
+    struct flines_implementation : function_implementation {
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments) {
+            return avl_flines(arguments);
+        }
+
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance) {
+            return avl_flines(arguments);
+        }
+    };
+
+    /**
+     * fclose_implementation
+     * implements the builtin __fclose__ function
+     */
+    struct fclose_implementation : function_implementation {
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments) {
+            return avl_fclose(arguments);
+        }
+
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance) {
+            return avl_fclose(arguments);
+        }
+    };
+
+    /**
+     * fresolve_implementation
+     * implements the builtin __fresolve__ function
+     */
+    struct fresolve_implementation : function_implementation {
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments) {
+            return avl_fresolve(arguments);
+        }
+
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance) {
+            return avl_fresolve(arguments);
+        }
+    };
+
     /**
      * cast_implementation
      * implements the builtin __cast__ function
@@ -490,6 +604,20 @@ namespace avalon {
         }
     };
 
+    /**
+     * popcount_implementation
+     * implements the builtin popcount function
+     */
+    struct popcount_implementation : function_implementation {
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments) {
+            return avl_popcount(arguments);
+        }
+
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance) {
+            return avl_popcount(arguments);
+        }
+    };
+
     /**
      * apply_implementation
      * implements the builtin apply function
@@ -538,6 +666,30 @@ namespace avalon {
         std::shared_ptr<qprocessor> m_qproc;
     };
 
+    /**
+     * qstats_implementation
+     * implements the builtin qstats function
+     */
+    struct qstats_implementation : function_implementation {
+    public:
+        qstats_implementation(std::shared_ptr<qprocessor>& qproc) : m_qproc(qproc) {
+        }
+
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments) {
+            return avl_qstats(m_qproc, arguments);
+        }
+
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance) {
+            return avl_qstats(m_qproc, arguments);
+        }
+
+    private:
+        /*
+         * the quantum processor whose counters we return
+         */
+        std::shared_ptr<qprocessor> m_qproc;
+    };
+
 
 
     /**
@@ -553,6 +705,217 @@ namespace avalon {
             return avl_refitem(arguments);
         }
     };
+
+    /**
+     * append_implementation
+     * implements the builtin append function
+     */
+    struct append_implementation : function_implementation {
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments) {
+            return list_append(arguments);
+        }
+
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance) {
+            return list_append(arguments);
+        }
+    };
+
+    /**
+     * pop_implementation
+     * implements the builtin pop function
+     */
+    struct pop_implementation : function_implementation {
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments) {
+            return list_pop(arguments);
+        }
+
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance) {
+            return list_pop(arguments);
+        }
+    };
+
+    /**
+     * set_implementation
+     * implements the builtin set function
+     */
+    struct set_implementation : function_implementation {
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments) {
+            return list_set(arguments);
+        }
+
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance) {
+            return list_set(arguments);
+        }
+    };
+
+    /**
+     * reserve_implementation
+     * implements the builtin reserve function
+     */
+    struct reserve_implementation : function_implementation {
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments) {
+            return list_reserve(arguments);
+        }
+
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance) {
+            return list_reserve(arguments);
+        }
+    };
+
+    /**
+     * len_implementation
+     * implements the builtin len function
+     */
+    struct len_implementation : function_implementation {
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments) {
+            // len is declared for both lists and maps
+            if(arguments.size() == 1 && arguments[0] -> is_map_expression())
+                return map_len(arguments);
+            return list_len(arguments);
+        }
+
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance) {
+            return (* this)(arguments);
+        }
+    };
+
+    /**
+     * slice_implementation
+     * implements the builtin slice function
+     */
+    struct slice_implementation : function_implementation {
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments) {
+            return list_slice(arguments);
+        }
+
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance) {
+            return list_slice(arguments);
+        }
+    };
+
+    /**
+     * insert_implementation
+     * implements the builtin insert function
+     */
+    struct insert_implementation : function_implementation {
+    public:
+        insert_implementation(map_hasher& hasher) : m_hasher(hasher) {
+        }
+
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments) {
+            return map_insert(m_hasher, arguments);
+        }
+
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance) {
+            return map_insert(m_hasher, arguments);
+        }
+
+    private:
+        /*
+         * hashes keys of custom types
+         */
+        map_hasher& m_hasher;
+    };
+
+    /**
+     * update_implementation
+     * implements the builtin update function
+     */
+    struct update_implementation : function_implementation {
+    public:
+        update_implementation(map_hasher& hasher) : m_hasher(hasher) {
+        }
+
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments) {
+            return map_update(m_hasher, arguments);
+        }
+
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance) {
+            return map_update(m_hasher, arguments);
+        }
+
+    private:
+        /*
+         * hashes keys of custom types
+         */
+        map_hasher& m_hasher;
+    };
+
+    /**
+     * remove_implementation
+     * implements the builtin remove function
+     */
+    struct remove_implementation : function_implementation {
+    public:
+        remove_implementation(map_hasher& hasher) : m_hasher(hasher) {
+        }
+
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments) {
+            return map_remove(m_hasher, arguments);
+        }
+
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance) {
+            return map_remove(m_hasher, arguments);
+        }
+
+    private:
+        /*
+         * hashes keys of custom types
+         */
+        map_hasher& m_hasher;
+    };
+
+    /**
+     * contains_implementation
+     * implements the builtin contains function
+     */
+    struct contains_implementation : function_implementation {
+    public:
+        contains_implementation(map_hasher& hasher) : m_hasher(hasher) {
+        }
+
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments) {
+            return map_contains(m_hasher, arguments);
+        }
+
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance) {
+            return map_contains(m_hasher, arguments);
+        }
+
+    private:
+        /*
+         * hashes keys of custom types
+         */
+        map_hasher& m_hasher;
+    };
+
+    /**
+     * keys_implementation
+     * implements the builtin keys function
+     */
+    struct keys_implementation : function_implementation {
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments) {
+            return map_keys(arguments);
+        }
+
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance) {
+            return map_keys(arguments);
+        }
+    };
+
+    /**
+     * values_implementation
+     * implements the builtin values function
+     */
+    struct values_implementation : function_implementation {
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments) {
+            return map_values(arguments);
+        }
+
+        virtual std::shared_ptr<expr> operator()(std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance) {
+            return map_values(arguments);
+        }
+    };
 }
 
 #endif
@@ -24,11 +24,20 @@
 
 
 #include <iostream>
-#include <cstdio>
+#include <cstddef>
+#include <cstdint>
+#include <csignal>
+#include <cerrno>
+#include <atomic>
 #include <memory>
 #include <vector>
 #include <string>
 
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
 /* Lexer */
 #include "lexer/token.hpp"
 
@@ -37,29 +46,317 @@
 #include "representer/ast/decl/type.hpp"
 /* Expressions */
 #include "representer/ast/expr/literal_expression.hpp"
+#include "representer/ast/expr/list_expression.hpp"
 #include "representer/ast/expr/expr.hpp"
 
 /* Builtins */
 #include "representer/builtins/lang/avalon_string.hpp"
+#include "representer/builtins/lang/avalon_list.hpp"
 #include "representer/builtins/lang/avalon_int.hpp"
 
 /* Builtin functions */
 #include "interpreter/builtins/io/avalon_io.hpp"
 
+/* Output buffer */
+#include "interpreter/output_buffer.hpp"
+
+/* Utilities */
+#include "utils/shared_string.hpp"
+
 /* Exceptions */
 #include "interpreter/exceptions/invalid_call.hpp"
 
 
 namespace avalon {
+/**
+ * open_file
+ * a file opened by __fopen__, its contents are mapped in memory for as long as a string refers to them
+ */
+struct open_file {
+    bool m_open;
+    shared_string m_contents;
+    std::size_t m_position;     // where __freadln__ reads the next line from
+    long long int m_generation; // how many times the slot was closed, part of the handle so stale handles are caught
+};
+
+/*
+ * the most files that can be open at once, __fopen__ fails once they are all in use
+ */
+static const std::size_t max_open_files = 4096;
+
+/**
+ * open_files
+ * returns the table of files opened by the program.
+ * the handle of a file encodes both its slot in the table and the generation of the slot
+ * so a handle kept after its file was closed cannot read the file that reuses the slot.
+ */
+static std::vector<open_file>& open_files() {
+    static std::vector<open_file> files;
+    return files;
+}
+
+/**
+ * free_slots
+ * returns the slots of closed files, reused before the table grows
+ */
+static std::vector<std::size_t>& free_slots() {
+    static std::vector<std::size_t> slots;
+    return slots;
+}
+
+/*
+ * files smaller than this are copied instead of being mapped
+ */
+static const std::size_t map_threshold = 256 * 1024;
+
+/*
+ * the most mappings that can be alive at once, files are copied once they are all in use
+ */
+static const std::size_t max_mappings = 1024;
+
+/**
+ * mapping
+ * a range of memory a file is mapped at, the SIGBUS handler reads them so they are lock free
+ */
+struct mapping {
+    std::atomic<std::uintptr_t> m_start;
+    std::atomic<std::size_t> m_size;
+};
+
+static mapping mappings[max_mappings];
+static struct sigaction previous_sigbus;
+
+/**
+ * on_sigbus
+ * reading a mapped file past its end raises SIGBUS, which happens when another process truncates the file.
+ * if the fault is inside one of our mappings, the page is replaced by a page of zeroes so the read goes on
+ * and the program sees zeroes where the lost contents were. other faults are left to the previous handler.
+ */
+static void on_sigbus(int sig, siginfo_t * info, void * context) {
+    std::uintptr_t address = reinterpret_cast<std::uintptr_t>(info -> si_addr);
+    for(std::size_t i = 0; i < max_mappings; i++) {
+        std::uintptr_t start = mappings[i].m_start.load();
+        if(start == 0 || address < start || address - start >= mappings[i].m_size.load())
+            continue;
+
+        std::uintptr_t page_size = ::sysconf(_SC_PAGESIZE);
+        void * page = reinterpret_cast<void *>(address & ~(page_size - 1));
+        if(::mmap(page, page_size, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0) != MAP_FAILED)
+            return;
+        break;
+    }
+
+    // the fault is not ours, returning with the previous handler installed raises it again
+    ::sigaction(SIGBUS, &previous_sigbus, nullptr);
+}
+
+/**
+ * add_mapping
+ * records the given mapping so truncating its file doesn't crash the program.
+ * returns false if too many mappings are alive.
+ */
+static bool add_mapping(void * addr, std::size_t size) {
+    static bool handler_installed = false;
+    if(handler_installed == false) {
+        struct sigaction action;
+        action.sa_sigaction = on_sigbus;
+        action.sa_flags = SA_SIGINFO;
+        sigemptyset(&action.sa_mask);
+        if(::sigaction(SIGBUS, &action, &previous_sigbus) < 0)
+            return false;
+        handler_installed = true;
+    }
+
+    for(std::size_t i = 0; i < max_mappings; i++) {
+        if(mappings[i].m_start.load() != 0)
+            continue;
+        mappings[i].m_size.store(size);
+        mappings[i].m_start.store(reinterpret_cast<std::uintptr_t>(addr));
+        return true;
+    }
+    return false;
+}
+
+/**
+ * remove_mapping
+ * forgets the given mapping before it is unmapped
+ */
+static void remove_mapping(const void * addr) {
+    for(std::size_t i = 0; i < max_mappings; i++) {
+        if(mappings[i].m_start.load() == reinterpret_cast<std::uintptr_t>(addr)) {
+            mappings[i].m_start.store(0);
+            return;
+        }
+    }
+}
+
+/**
+ * copy_file
+ * reads the file behind the given descriptor into a string and sets contents to it
+ */
+static void copy_file(int fd, std::size_t size, shared_string& contents) {
+    std::string copy(size, '\0');
+    std::size_t got = 0;
+    while(got < size) {
+        ssize_t count = ::read(fd, &copy[got], size - got);
+        if(count < 0 && errno == EINTR)
+            continue;
+        if(count <= 0)
+            break;
+        got += count;
+    }
+    copy.resize(got);
+    contents = shared_string(copy);
+}
+
+/**
+ * map_file
+ * maps the file at the given path in memory and sets contents to a view over it.
+ * small files are copied since mapping them saves little.
+ * if a mapped file is truncated while it is mapped, its lost contents read as zeroes.
+ * returns false if the file cannot be read.
+ */
+static bool map_file(const std::string& path, shared_string& contents) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if(fd < 0)
+        return false;
+
+    struct stat st;
+    if(::fstat(fd, &st) < 0 || S_ISREG(st.st_mode) == false) {
+        ::close(fd);
+        return false;
+    }
+
+    // empty files cannot be mapped but there is nothing to read from them anyway
+    std::size_t size = st.st_size;
+    if(size == 0) {
+        ::close(fd);
+        contents = shared_string();
+        return true;
+    }
+
+    if(size < map_threshold) {
+        copy_file(fd, size, contents);
+        ::close(fd);
+        return true;
+    }
+
+    void * addr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if(addr == MAP_FAILED) {
+        ::close(fd);
+        return false;
+    }
+
+    // without the SIGBUS guard a truncation would crash the program so we copy the file instead
+    if(add_mapping(addr, size) == false) {
+        ::munmap(addr, size);
+        copy_file(fd, size, contents);
+        ::close(fd);
+        return true;
+    }
+    ::close(fd);
+
+    // files are mostly read front to back so we let the kernel read ahead
+    ::madvise(addr, size, MADV_SEQUENTIAL);
+    std::shared_ptr<const char> data(static_cast<const char *>(addr), [size](const char * ptr) {
+        remove_mapping(ptr);
+        ::munmap(const_cast<char *>(ptr), size);
+    });
+    contents = shared_string(data, size);
+    return true;
+}
+
+/**
+ * get_file
+ * returns the open file whose handle is the integer argument at the given position, or a null pointer if no such file is open
+ */
+static open_file * get_file(std::vector<std::shared_ptr<expr> >& arguments, std::size_t position, const std::string& fun_name) {
+    std::shared_ptr<expr>& arg = arguments[position];
+    if(arg -> is_literal_expression() == false)
+        throw invalid_call("[compiler error] the builtin " + fun_name + " function expects its file handle to be an integer literal.");
+
+    long long int handle = std::static_pointer_cast<literal_expression>(arg) -> get_int_value();
+    if(handle < 0)
+        return nullptr;
+
+    std::vector<open_file>& files = open_files();
+    std::size_t slot = static_cast<std::size_t>(handle) % max_open_files;
+    long long int generation = handle / max_open_files;
+    if(slot >= files.size() || files[slot].m_open == false || files[slot].m_generation != generation)
+        return nullptr;
+    return & files[slot];
+}
+
+/*
+ * the path of the program being run, relative paths given to __fresolve__ are resolved against its directory
+ */
+static std::string& program_path() {
+    static std::string path;
+    return path;
+}
+
+/**
+ * get_int_argument
+ * returns the integer held by the argument at the given position
+ */
+static long long int get_int_argument(std::vector<std::shared_ptr<expr> >& arguments, std::size_t position, const std::string& fun_name) {
+    std::shared_ptr<expr>& arg = arguments[position];
+    if(arg -> is_literal_expression() == false)
+        throw invalid_call("[compiler error] the builtin " + fun_name + " function expects its arguments to be integer literals.");
+    return std::static_pointer_cast<literal_expression>(arg) -> get_int_value();
+}
+
+/**
+ * make_int
+ * creates a new integer literal holding the given value
+ */
+static std::shared_ptr<expr> make_int(long long int value) {
+    static avalon_int avl_int;
+    type_instance int_instance = avl_int.get_type_instance();
+    std::shared_ptr<literal_expression> ret_expr = std::make_shared<literal_expression>(builtin_token(INTEGER), value);
+    ret_expr -> set_type_instance(int_instance);
+    return ret_expr;
+}
+
+/**
+ * make_string
+ * creates a new string literal holding the given string
+ */
+static std::shared_ptr<expr> make_string(const shared_string& str) {
+    static avalon_string avl_string;
+    type_instance string_instance = avl_string.get_type_instance();
+    std::shared_ptr<literal_expression> ret_expr = std::make_shared<literal_expression>(builtin_token(STRING), str);
+    ret_expr -> set_type_instance(string_instance);
+    return ret_expr;
+}
+
+/**
+ * next_line
+ * returns the line of contents that starts at the given position without its line ending
+ * and sets next to the position of the line that follows it.
+ */
+static shared_string next_line(const shared_string& contents, std::size_t start, std::size_t& next) {
+    std::size_t end = contents.find('\n', start);
+    next = end + 1;
+    if(end > start && contents.at(end - 1) == '\r')
+        end--;
+    return contents.substr(start, end - start);
+}
+
+/**
+ * chars_written
+ * returns a new integer literal containing the given number of characters written.
+ * the caller may modify the literal it gets so it is never shared between calls.
+ */
+static std::shared_ptr<expr> chars_written(std::size_t count) {
+    return make_int(count);
+}
+
     /**
      * avl_print
      * prints a string to standard output and returns the number of characters written
      */
     std::shared_ptr<expr> avl_print(std::vector<std::shared_ptr<expr> >& arguments) {
-        // int type
-        avalon_int avl_int;
-        type_instance int_instance = avl_int.get_type_instance();
-
         // make sure we got only one argument
         if(arguments.size() != 1)
             throw invalid_call("[compiler error] the builtin __print__ function expects only one argument.");
@@ -71,19 +368,13 @@ namespace avalon {
 
         // get the string inside the literal
         std::shared_ptr<literal_expression> const & string_lit = std::static_pointer_cast<literal_expression>(arg);
-        std::string string_val = string_lit -> get_string_value();
+        const shared_string& string_val = string_lit -> get_shared_string_value();
 
         // print the string
-        int chars_buffered = printf("%s", string_val.c_str());
-
-        // we initialize a literal expression that it to contain the number of characters written
-        std::string ret_str = std::to_string(chars_buffered);
-        token ret_tok(INTEGER, ret_str, 0, 0, "__bil__");
-        std::shared_ptr<literal_expression> ret_expr = std::make_shared<literal_expression>(ret_tok, INTEGER_EXPR, ret_str);
-        ret_expr -> set_type_instance(int_instance);
-        std::shared_ptr<expr> final_expr = ret_expr;
+        std::size_t chars_buffered = output_buffer::write(string_val);
 
-        return final_expr;
+        // we return a literal expression that contains the number of characters written
+        return chars_written(chars_buffered);
     }
 
     /**
@@ -91,10 +382,6 @@ namespace avalon {
      * prints a string followed by a new line to standard output and returns the number of characters written
      */
     std::shared_ptr<expr> avl_println(std::vector<std::shared_ptr<expr> >& arguments) {
-        // int type
-        avalon_int avl_int;
-        type_instance int_instance = avl_int.get_type_instance();
-
         // make sure we got only one argument
         if(arguments.size() != 1)
             throw invalid_call("[compiler error] the builtin __println__ function expects only one argument.");
@@ -106,19 +393,15 @@ namespace avalon {
 
         // get the string inside the literal
         std::shared_ptr<literal_expression> const & string_lit = std::static_pointer_cast<literal_expression>(arg);
-        std::string string_val = string_lit -> get_string_value();
+        const shared_string& string_val = string_lit -> get_shared_string_value();
 
         // print the string
-        int chars_buffered = printf("%s\n", string_val.c_str());
-
-        // we initialize a literal expression that it to contain the number of characters written
-        std::string ret_str = std::to_string(chars_buffered);
-        token ret_tok(INTEGER, ret_str, 0, 0, "__bil__");
-        std::shared_ptr<literal_expression> ret_expr = std::make_shared<literal_expression>(ret_tok, INTEGER_EXPR, ret_str);
-        ret_expr -> set_type_instance(int_instance);
-        std::shared_ptr<expr> final_expr = ret_expr;
+        std::size_t chars_buffered = output_buffer::write(string_val);
+        output_buffer::put('\n');
+        chars_buffered += 1;
 
-        return final_expr;
+        // we return a literal expression that contains the number of characters written
+        return chars_written(chars_buffered);
     }
 
     /**
@@ -126,8 +409,11 @@ namespace avalon {
      * reads a string followed by a new line from the standard input
      */
     std::shared_ptr<expr> avl_readln(std::vector<std::shared_ptr<expr> >& arguments) {
+        // whatever was printed before, usually a prompt, must be seen before we wait for input
+        output_buffer::flush();
+
         // string type
-        avalon_string avl_string;
+        static avalon_string avl_string;
         type_instance string_instance = avl_string.get_type_instance();
 
         // make sure we got no arguments
@@ -136,8 +422,7 @@ namespace avalon {
 
         // read the string and return it
         for(std::string input; std::getline(std::cin, input);) {
-            token ret_tok(STRING, input, 0, 0, "__bil__");
-            std::shared_ptr<literal_expression> ret_expr = std::make_shared<literal_expression>(ret_tok, STRING_EXPR, input);
+            std::shared_ptr<literal_expression> ret_expr = std::make_shared<literal_expression>(builtin_token(STRING), STRING_EXPR, input);
             ret_expr -> set_type_instance(string_instance);
             std::shared_ptr<expr> final_expr = ret_expr;
             return final_expr;
@@ -145,4 +430,189 @@ namespace avalon {
 
         return nullptr;
     }
+
+    /**
+     * avl_fopen
+     * maps the file at the given path in memory and returns its handle, or -1 if the file cannot be read
+     */
+    std::shared_ptr<expr> avl_fopen(std::vector<std::shared_ptr<expr> >& arguments) {
+        // make sure we got only one argument
+        if(arguments.size() != 1)
+            throw invalid_call("[compiler error] the builtin __fopen__ function expects only one argument.");
+
+        // make sure the argument is a string literal
+        std::shared_ptr<expr>& arg = arguments[0];
+        if(arg -> is_literal_expression() == false)
+            throw invalid_call("[compiler error] the builtin __fopen__ function expects its argument to be a string literal.");
+        const std::string& path = std::static_pointer_cast<literal_expression>(arg) -> get_string_value();
+
+        shared_string contents;
+        if(map_file(path, contents) == false)
+            return make_int(-1);
+
+        // slots of closed files are reused, their generation tells the new handle from the stale ones
+        std::vector<open_file>& files = open_files();
+        std::vector<std::size_t>& slots = free_slots();
+        std::size_t slot = files.size();
+        if(slots.empty() == false) {
+            slot = slots.back();
+            slots.pop_back();
+        }
+        else if(files.size() < max_open_files) {
+            files.push_back(open_file());
+            files[slot].m_generation = 0;
+        }
+        else {
+            return make_int(-1);
+        }
+
+        files[slot].m_open = true;
+        files[slot].m_contents = contents;
+        files[slot].m_position = 0;
+        return make_int(files[slot].m_generation * max_open_files + slot);
+    }
+
+    /**
+     * avl_fsize
+     * returns the size in bytes of the file with the given handle, or -1 if the file is not open
+     */
+    std::shared_ptr<expr> avl_fsize(std::vector<std::shared_ptr<expr> >& arguments) {
+        // make sure we got only one argument
+        if(arguments.size() != 1)
+            throw invalid_call("[compiler error] the builtin __fsize__ function expects only one argument.");
+
+        open_file * file = get_file(arguments, 0, "__fsize__");
+        if(file == nullptr)
+            return make_int(-1);
+        return make_int(file -> m_contents.length());
+    }
+
+    /**
+     * avl_fread
+     * returns at most count bytes from the file with the given handle starting at the given offset.
+     * the string is a view over the mapped file so nothing is copied.
+     */
+    std::shared_ptr<expr> avl_fread(std::vector<std::shared_ptr<expr> >& arguments) {
+        // make sure we got three arguments
+        if(arguments.size() != 3)
+            throw invalid_call("[compiler error] the builtin __fread__ function expects exactly three arguments.");
+
+        open_file * file = get_file(arguments, 0, "__fread__");
+        long long int offset = get_int_argument(arguments, 1, "__fread__");
+        long long int count = get_int_argument(arguments, 2, "__fread__");
+        if(file == nullptr || offset < 0 || count <= 0)
+            return make_string(shared_string());
+        return make_string(file -> m_contents.substr(offset, count));
+    }
+
+    /**
+     * avl_ftell
+     * returns the position of the next line __freadln__ will read from the file with the given handle, or -1 if the file is not open
+     */
+    std::shared_ptr<expr> avl_ftell(std::vector<std::shared_ptr<expr> >& arguments) {
+        // make sure we got only one argument
+        if(arguments.size() != 1)
+            throw invalid_call("[compiler error] the builtin __ftell__ function expects only one argument.");
+
+        open_file * file = get_file(arguments, 0, "__ftell__");
+        if(file == nullptr)
+            return make_int(-1);
+        return make_int(file -> m_position);
+    }
+
+    /**
+     * avl_freadln
+     * returns the next line of the file with the given handle without its line ending and moves past it.
+     * only the line returned is created so files of any size can be read line by line.
+     */
+    std::shared_ptr<expr> avl_freadln(std::vector<std::shared_ptr<expr> >& arguments) {
+        // make sure we got only one argument
+        if(arguments.size() != 1)
+            throw invalid_call("[compiler error] the builtin __freadln__ function expects only one argument.");
+
+        open_file * file = get_file(arguments, 0, "__freadln__");
+        if(file == nullptr || file -> m_position >= file -> m_contents.length())
+            return make_string(shared_string());
+        return make_string(next_line(file -> m_contents, file -> m_position, file -> m_position));
+    }
+
+    /**
+     * avl_flines
+     * returns the lines of the file with the given handle without their line endings.
+     * every line is a view over the mapped file so no text is copied, but the list holds every line at once;
+     * use __freadln__ to go over a large file one line at a time.
+     */
+    std::shared_ptr<expr> avl_flines(std::vector<std::shared_ptr<expr> >& arguments) {
+        static avalon_string avl_string;
+        type_instance string_instance = avl_string.get_type_instance();
+        avalon_list avl_list(string_instance);
+        type_instance list_instance = avl_list.get_type_instance();
+
+        // make sure we got only one argument
+        if(arguments.size() != 1)
+            throw invalid_call("[compiler error] the builtin __flines__ function expects only one argument.");
+
+        std::shared_ptr<list_expression> lines = std::make_shared<list_expression>(builtin_token(STRING));
+        lines -> set_type_instance(list_instance);
+
+        open_file * file = get_file(arguments, 0, "__flines__");
+        if(file == nullptr)
+            return lines;
+
+        const shared_string& contents = file -> m_contents;
+        std::size_t length = contents.length();
+        for(std::size_t start = 0; start < length;)
+            lines -> add_element(make_string(next_line(contents, start, start)));
+        return lines;
+    }
+
+    /**
+     * avl_fclose
+     * closes the file with the given handle, strings read from it remain valid
+     */
+    std::shared_ptr<expr> avl_fclose(std::vector<std::shared_ptr<expr> >& arguments) {
+        // make sure we got only one argument
+        if(arguments.size() != 1)
+            throw invalid_call("[compiler error] the builtin __fclose__ function expects only one argument.");
+
+        open_file * file = get_file(arguments, 0, "__fclose__");
+        if(file != nullptr) {
+            file -> m_open = false;
+            file -> m_contents = shared_string();
+            file -> m_generation++;
+            free_slots().push_back(file - & open_files()[0]);
+        }
+        return nullptr;
+    }
+
+    /**
+     * set_program_path
+     * remembers the path of the program being run so __fresolve__ can resolve paths against its directory
+     */
+    void set_program_path(const std::string& path) {
+        program_path() = path;
+    }
+
+    /**
+     * avl_fresolve
+     * returns the given path relative to the directory of the program being run.
+     * absolute paths are returned as they are.
+     */
+    std::shared_ptr<expr> avl_fresolve(std::vector<std::shared_ptr<expr> >& arguments) {
+        // make sure we got only one argument
+        if(arguments.size() != 1)
+            throw invalid_call("[compiler error] the builtin __fresolve__ function expects only one argument.");
+
+        // make sure the argument is a string literal
+        std::shared_ptr<expr>& arg = arguments[0];
+        if(arg -> is_literal_expression() == false)
+            throw invalid_call("[compiler error] the builtin __fresolve__ function expects its argument to be a string literal.");
+        const std::string& path = std::static_pointer_cast<literal_expression>(arg) -> get_string_value();
+
+        const std::string& prog_path = program_path();
+        std::size_t separator = prog_path.find_last_of('/');
+        if(path.empty() || path[0] == '/' || separator == std::string::npos)
+            return make_string(shared_string(path));
+        return make_string(shared_string(prog_path.substr(0, separator + 1) + path));
+    }
 }
@@ -27,6 +27,7 @@
 
 #include <memory>
 #include <vector>
+#include <string>
 
 /* AST */
 #include "representer/ast/expr/expr.hpp"
@@ -50,6 +51,65 @@ namespace avalon {
      * reads a string followed by a new line from the standard input
      */
     std::shared_ptr<expr> avl_readln(std::vector<std::shared_ptr<expr> >& arguments);
+
+    /**
+     * avl_fopen
+     * maps the file at the given path in memory and returns its handle, or -1 if the file cannot be read
+     */
+    std::shared_ptr<expr> avl_fopen(std::vector<std::shared_ptr<expr> >& arguments);
+
+    /**
+     * avl_fsize
+     * returns the size in bytes of the file with the given handle, or -1 if the file is not open
+     */
+    std::shared_ptr<expr> avl_fsize(std::vector<std::shared_ptr<expr> >& arguments);
+
+    /**
+     * avl_fread
+     * returns at most count bytes from the file with the given handle starting at the given offset.
+     * the string is a view over the mapped file so nothing is copied.
+     */
+    std::shared_ptr<expr> avl_fread(std::vector<std::shared_ptr<expr> >& arguments);
+
+    /**
+     * avl_ftell
+     * returns the position of the next line __freadln__ will read from the file with the given handle, or -1 if the file is not open
+     */
+    std::shared_ptr<expr> avl_ftell(std::vector<std::shared_ptr<expr> >& arguments);
+
+    /**
+     * avl_freadln
+     * returns the next line of the file with the given handle without its line ending and moves past it.
+     * only the line returned is created so files of any size can be read line by line.
+     */
+    std::shared_ptr<expr> avl_freadln(std::vector<std::shared_ptr<expr> >& arguments);
+
+    /**
+     * avl_flines
+     * returns the lines of the file with the given handle without their line endings.
+     * every line is a view over the mapped file so no text is copied, but the list holds every line at once;
+     * use __freadln__ to go over a large file one line at a time.
+     */
+    std::shared_ptr<expr> avl_flines(std::vector<std::shared_ptr<expr> >& arguments);
+
+    /**
+     * avl_fclose
+     * closes the file with the given handle, strings read from it remain valid
+     */
+    std::shared_ptr<expr> avl_fclose(std::vector<std::shared_ptr<expr> >& arguments);
+
+    /**
+     * set_program_path
+     * remembers the path of the program being run so __fresolve__ can resolve paths against its directory
+     */
+    void set_program_path(const std::string& path);
+
+    /**
+     * avl_fresolve
+     * returns the given path relative to the directory of the program being run.
+     * absolute paths are returned as they are.
+     */
+    std::shared_ptr<expr> avl_fresolve(std::vector<std::shared_ptr<expr> >& arguments);
 }
 
 #endif
@@ -59,11 +59,11 @@ namespace avalon {
      */
     std::shared_ptr<expr> avl_pos(std::vector<std::shared_ptr<expr> >& arguments) {
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
         // float type
-        avalon_float avl_float;
+        static avalon_float avl_float;
         type_instance float_instance = avl_float.get_type_instance();
 
         // make sure we got only one argument
@@ -97,15 +97,15 @@ namespace avalon {
      */
     std::shared_ptr<expr> avl_neg(std::vector<std::shared_ptr<expr> >& arguments) {
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
         // float type
-        avalon_float avl_float;
+        static avalon_float avl_float;
         type_instance float_instance = avl_float.get_type_instance();
 
         // string type
-        avalon_string avl_string;
+        static avalon_string avl_string;
         type_instance string_instance = avl_string.get_type_instance();
 
         // make sure we got only one argument
@@ -142,15 +142,15 @@ namespace avalon {
      */
     std::shared_ptr<expr> avl_add(std::vector<std::shared_ptr<expr> >& arguments) {
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
         // float type
-        avalon_float avl_float;
+        static avalon_float avl_float;
         type_instance float_instance = avl_float.get_type_instance();
 
         // string type
-        avalon_string avl_string;
+        static avalon_string avl_string;
         type_instance string_instance = avl_string.get_type_instance();
 
         // make sure we got only two arguments
@@ -193,11 +193,11 @@ namespace avalon {
      */
     std::shared_ptr<expr> avl_sub(std::vector<std::shared_ptr<expr> >& arguments) {
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
         // float type
-        avalon_float avl_float;
+        static avalon_float avl_float;
         type_instance float_instance = avl_float.get_type_instance();
 
         // make sure we got only two arguments
@@ -237,11 +237,11 @@ namespace avalon {
      */
     std::shared_ptr<expr> avl_mul(std::vector<std::shared_ptr<expr> >& arguments) {
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
         // float type
-        avalon_float avl_float;
+        static avalon_float avl_float;
         type_instance float_instance = avl_float.get_type_instance();
 
         // make sure we got only two arguments
@@ -281,11 +281,11 @@ namespace avalon {
      */
     std::shared_ptr<expr> avl_div(std::vector<std::shared_ptr<expr> >& arguments) {
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
         // float type
-        avalon_float avl_float;
+        static avalon_float avl_float;
         type_instance float_instance = avl_float.get_type_instance();
 
         // make sure we got only two arguments
@@ -325,7 +325,7 @@ namespace avalon {
      */
     std::shared_ptr<expr> avl_mod(std::vector<std::shared_ptr<expr> >& arguments) {
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
         // make sure we got only two arguments
@@ -362,7 +362,7 @@ namespace avalon {
      */
     std::shared_ptr<expr> avl_pow(std::vector<std::shared_ptr<expr> >& arguments) {
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
         // make sure we got only two arguments
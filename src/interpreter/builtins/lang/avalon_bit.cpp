@@ -22,10 +22,11 @@
  *  SOFTWARE.
  */
 
-
+#include <cstddef>
 #include <memory>
 #include <vector>
-#include <bitset>
+#include <utility>
+#include <string>
 
 /* Lexer */
 #include "lexer/token.hpp"
@@ -44,59 +45,94 @@
 #include "representer/builtins/lang/avalon_bool.hpp"
 #include "representer/builtins/lang/avalon_int.hpp"
 #include "representer/builtins/lang/avalon_bit.hpp"
+#include "representer/builtins/lang/avalon_bit2.hpp"
+#include "representer/builtins/lang/avalon_bit4.hpp"
+#include "representer/builtins/lang/avalon_bit8.hpp"
 
 /* Builtin functions */
 #include "interpreter/builtins/lang/avalon_bit.hpp"
+#include "interpreter/builtins/lang/avalon_bool.hpp"
+
+/* Utilities */
+#include "utils/bit_vector.hpp"
 
 /* Exceptions */
 #include "interpreter/exceptions/invalid_call.hpp"
 
 
 namespace avalon {
-    /**
-     * bit_and
-     * computes the bitwise and of two bit expressions
-     */
-    std::shared_ptr<expr> bit_and(std::vector<std::shared_ptr<expr> >& arguments) {
-        // bit type
-        avalon_bit avl_bit;
-        type_instance bit_instance = avl_bit.get_type_instance();
+/**
+ * get_bits_argument
+ * returns the argument at the given position after making sure it is a bits literal
+ */
+static std::shared_ptr<literal_expression> get_bits_argument(std::vector<std::shared_ptr<expr> >& arguments, std::size_t position, const std::string& fun_name) {
+    std::shared_ptr<expr>& arg = arguments[position];
+    if(arg -> is_literal_expression() == false)
+        throw invalid_call("[compiler error] the bitwise " + fun_name + " function expects its arguments to be bits.");
 
-        // make sure we got only two arguments
-        if(arguments.size() != 2)
-            throw invalid_call("[compiler error] the bitwise __band__ function expects only two arguments.");
+    std::shared_ptr<literal_expression> arg_lit = std::static_pointer_cast<literal_expression>(arg);
+    if(bit_width(arg_lit -> get_type_instance()) == 0)
+        throw invalid_call("[compiler error] the bitwise " + fun_name + " function expects its arguments to be bits.");
 
-        // make sure each argument is a literal expression
-        std::shared_ptr<expr>& arg_one = arguments[0];
-        std::shared_ptr<expr>& arg_two = arguments[1];
-        if(arg_one -> is_literal_expression() == false || arg_two -> is_literal_expression() == false)
-            throw invalid_call("[compiler error] the bitwise __band__ function expects both its arguments to be bits.");
+    return arg_lit;
+}
 
-        // get the literal expressions
-        std::shared_ptr<literal_expression> const & arg_one_lit = std::static_pointer_cast<literal_expression>(arg_one);
-        std::shared_ptr<literal_expression> const & arg_two_lit = std::static_pointer_cast<literal_expression>(arg_two);
+/**
+ * get_bits_arguments
+ * returns both arguments of a binary function after making sure they are bits literals of the same width
+ */
+static std::pair<std::shared_ptr<literal_expression>, std::shared_ptr<literal_expression> > get_bits_arguments(std::vector<std::shared_ptr<expr> >& arguments, const std::string& fun_name) {
+    // make sure we got only two arguments
+    if(arguments.size() != 2)
+        throw invalid_call("[compiler error] the bitwise " + fun_name + " function expects only two arguments.");
 
-        // double check the type instance
-        type_instance& arg_one_instance = arg_one_lit -> get_type_instance();
-        if(type_instance_strong_compare(arg_one_instance, bit_instance) == false)
-            throw invalid_call("[compiler error] the bitwise __band__ function expects its argument to be bits.");
+    std::shared_ptr<literal_expression> arg_one_lit = get_bits_argument(arguments, 0, fun_name);
+    std::shared_ptr<literal_expression> arg_two_lit = get_bits_argument(arguments, 1, fun_name);
+    if(type_instance_strong_compare(arg_one_lit -> get_type_instance(), arg_two_lit -> get_type_instance()) == false)
+        throw invalid_call("[compiler error] the bitwise " + fun_name + " function expects both its arguments to have the same width.");
 
-        type_instance& arg_two_instance = arg_two_lit -> get_type_instance();
-        if(type_instance_strong_compare(arg_two_instance, bit_instance) == false)
-            throw invalid_call("[compiler error] the bitwise __band__ function expects its argument to be bits.");
+    return std::make_pair(arg_one_lit, arg_two_lit);
+}
 
-        // and both arguments
-        std::bitset<1> arg_one_val = arg_one_lit -> get_bit_value();
-        std::bitset<1> arg_two_val = arg_two_lit -> get_bit_value();
-        std::bitset<1> res_val = arg_one_val & arg_two_val;
-        std::string res_str = res_val.to_string();
+/**
+ * make_bits
+ * creates a new bits literal holding the given bits
+ */
+static std::shared_ptr<expr> make_bits(const bit_vector& bits, type_instance& instance) {
+    std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(builtin_token(BITS), bits);
+    res_lit -> set_type_instance(instance);
+    return res_lit;
+}
 
-        // create new literal with the new bitstring
-        token lit_tok(BITS, res_str, 0, 0, "__bil__");
-        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(lit_tok, BIT_EXPR, res_str);
-        res_lit -> set_type_instance(bit_instance);
+    /**
+     * bit_width
+     * returns the number of bits held by values of the given type instance or zero if it is not a bits type instance
+     */
+    std::size_t bit_width(type_instance& instance) {
+        static avalon_bit avl_bit;
+        static avalon_bit2 avl_bit2;
+        static avalon_bit4 avl_bit4;
+        static avalon_bit8 avl_bit8;
+
+        if(type_instance_strong_compare(instance, avl_bit.get_type_instance()))
+            return 1;
+        else if(type_instance_strong_compare(instance, avl_bit2.get_type_instance()))
+            return 2;
+        else if(type_instance_strong_compare(instance, avl_bit4.get_type_instance()))
+            return 4;
+        else if(type_instance_strong_compare(instance, avl_bit8.get_type_instance()))
+            return 8;
+        else
+            return 0;
+    }
 
-        return res_lit;
+    /**
+     * bit_and
+     * computes the bitwise and of two bit expressions
+     */
+    std::shared_ptr<expr> bit_and(std::vector<std::shared_ptr<expr> >& arguments) {
+        std::pair<std::shared_ptr<literal_expression>, std::shared_ptr<literal_expression> > args = get_bits_arguments(arguments, "__band__");
+        return make_bits(args.first -> get_bits_value() & args.second -> get_bits_value(), args.first -> get_type_instance());
     }
 
     /**
@@ -104,45 +140,8 @@ namespace avalon {
      * computes the bitwise or of two bit expressions
      */
     std::shared_ptr<expr> bit_or(std::vector<std::shared_ptr<expr> >& arguments) {
-        // bit type
-        avalon_bit avl_bit;
-        type_instance bit_instance = avl_bit.get_type_instance();
-
-        // make sure we got only two arguments
-        if(arguments.size() != 2)
-            throw invalid_call("[compiler error] the bitwise __bor__ function expects only two arguments.");
-
-        // make sure each argument is a literal expression
-        std::shared_ptr<expr>& arg_one = arguments[0];
-        std::shared_ptr<expr>& arg_two = arguments[1];
-        if(arg_one -> is_literal_expression() == false || arg_two -> is_literal_expression() == false)
-            throw invalid_call("[compiler error] the bitwise __bor__ function expects both its arguments to be bits.");
-
-        // get the literal expressions
-        std::shared_ptr<literal_expression> const & arg_one_lit = std::static_pointer_cast<literal_expression>(arg_one);
-        std::shared_ptr<literal_expression> const & arg_two_lit = std::static_pointer_cast<literal_expression>(arg_two);
-
-        // double check the type instance
-        type_instance& arg_one_instance = arg_one_lit -> get_type_instance();
-        if(type_instance_strong_compare(arg_one_instance, bit_instance) == false)
-            throw invalid_call("[compiler error] the bitwise __bor__ function expects its argument to be bits.");
-
-        type_instance& arg_two_instance = arg_two_lit -> get_type_instance();
-        if(type_instance_strong_compare(arg_two_instance, bit_instance) == false)
-            throw invalid_call("[compiler error] the bitwise __bor__ function expects its argument to be bits.");
-
-        // or both arguments
-        std::bitset<1> arg_one_val = arg_one_lit -> get_bit_value();
-        std::bitset<1> arg_two_val = arg_two_lit -> get_bit_value();
-        std::bitset<1> res_val = arg_one_val | arg_two_val;
-        std::string res_str = res_val.to_string();
-
-        // create new literal with the new bitstring
-        token lit_tok(BITS, res_str, 0, 0, "__bil__");
-        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(lit_tok, BIT_EXPR, res_str);
-        res_lit -> set_type_instance(bit_instance);
-
-        return res_lit;
+        std::pair<std::shared_ptr<literal_expression>, std::shared_ptr<literal_expression> > args = get_bits_arguments(arguments, "__bor__");
+        return make_bits(args.first -> get_bits_value() | args.second -> get_bits_value(), args.first -> get_type_instance());
     }
 
     /**
@@ -150,45 +149,8 @@ namespace avalon {
      * computes the bitwise xor of two bit expressions
      */
     std::shared_ptr<expr> bit_xor(std::vector<std::shared_ptr<expr> >& arguments) {
-        // bit type
-        avalon_bit avl_bit;
-        type_instance bit_instance = avl_bit.get_type_instance();
-
-        // make sure we got only two arguments
-        if(arguments.size() != 2)
-            throw invalid_call("[compiler error] the bitwise __xor__ function expects only two arguments.");
-
-        // make sure each argument is a literal expression
-        std::shared_ptr<expr>& arg_one = arguments[0];
-        std::shared_ptr<expr>& arg_two = arguments[1];
-        if(arg_one -> is_literal_expression() == false || arg_two -> is_literal_expression() == false)
-            throw invalid_call("[compiler error] the bitwise __xor__ function expects both its arguments to be bits.");
-
-        // get the literal expressions
-        std::shared_ptr<literal_expression> const & arg_one_lit = std::static_pointer_cast<literal_expression>(arg_one);
-        std::shared_ptr<literal_expression> const & arg_two_lit = std::static_pointer_cast<literal_expression>(arg_two);
-
-        // double check the type instance
-        type_instance& arg_one_instance = arg_one_lit -> get_type_instance();
-        if(type_instance_strong_compare(arg_one_instance, bit_instance) == false)
-            throw invalid_call("[compiler error] the bitwise __xor__ function expects its argument to be bits.");
-
-        type_instance& arg_two_instance = arg_two_lit -> get_type_instance();
-        if(type_instance_strong_compare(arg_two_instance, bit_instance) == false)
-            throw invalid_call("[compiler error] the bitwise __xor__ function expects its argument to be bits.");
-
-        // xor both arguments
-        std::bitset<1> arg_one_val = arg_one_lit -> get_bit_value();
-        std::bitset<1> arg_two_val = arg_two_lit -> get_bit_value();
-        std::bitset<1> res_val = arg_one_val ^ arg_two_val;
-        std::string res_str = res_val.to_string();
-
-        // create new literal with the new bitstring
-        token lit_tok(BITS, res_str, 0, 0, "__bil__");
-        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(lit_tok, BIT_EXPR, res_str);
-        res_lit -> set_type_instance(bit_instance);
-
-        return res_lit;
+        std::pair<std::shared_ptr<literal_expression>, std::shared_ptr<literal_expression> > args = get_bits_arguments(arguments, "__xor__");
+        return make_bits(args.first -> get_bits_value() ^ args.second -> get_bits_value(), args.first -> get_type_instance());
     }
 
     /**
@@ -196,38 +158,12 @@ namespace avalon {
      * computes the bitwise not of a single bit expressions
      */
     std::shared_ptr<expr> bit_not(std::vector<std::shared_ptr<expr> >& arguments) {
-        // bit type
-        avalon_bit avl_bit;
-        type_instance bit_instance = avl_bit.get_type_instance();
-
         // make sure we got only one argument
         if(arguments.size() != 1)
             throw invalid_call("[compiler error] the bitwise __bnot__ function expects only one argument.");
 
-        // make sure each argument is an literal expression
-        std::shared_ptr<expr>& arg = arguments[0];
-        if(arg -> is_literal_expression() == false)
-            throw invalid_call("[compiler error] the bitwise __bnot__ function expects its argument to be bits.");
-
-        // get the literal expressions
-        std::shared_ptr<literal_expression> const & arg_lit = std::static_pointer_cast<literal_expression>(arg);
-
-        // double check the type instance
-        type_instance& arg_instance = arg_lit -> get_type_instance();
-        if(type_instance_strong_compare(arg_instance, bit_instance) == false)
-            throw invalid_call("[compiler error] the bitwise __bnot__ function expects its argument to be bits.");
-
-        // negate the value held inside the literal
-        std::bitset<1> arg_val = arg_lit -> get_bit_value();
-        std::bitset<1> res_val = ~arg_val;
-        std::string res_str = res_val.to_string();
-
-        // create new literal with the new bitstring
-        token lit_tok(BITS, res_str, 0, 0, "__bil__");
-        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(lit_tok, BIT_EXPR, res_str);
-        res_lit -> set_type_instance(bit_instance);
-
-        return res_lit;
+        std::shared_ptr<literal_expression> arg_lit = get_bits_argument(arguments, 0, "__bnot__");
+        return make_bits(~ arg_lit -> get_bits_value(), arg_lit -> get_type_instance());
     }
 
     /**
@@ -236,7 +172,7 @@ namespace avalon {
      */
     std::shared_ptr<expr> bit_cast(std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance) {
         // string type
-        avalon_string avl_string;
+        static avalon_string avl_string;
         type_instance string_instance = avl_string.get_type_instance();
 
         if(type_instance_strong_compare(ret_instance, string_instance)) {
@@ -252,36 +188,28 @@ namespace avalon {
      * returns a bit representation of a string
      */
     std::shared_ptr<expr> bit_string(std::vector<std::shared_ptr<expr> >& arguments) {
-        // bit type
-        avalon_bit avl_bit;
-        type_instance bit_instance = avl_bit.get_type_instance();
-
         // string type
-        avalon_string avl_string;
+        static avalon_string avl_string;
         type_instance string_instance = avl_string.get_type_instance();
 
         // make sure we got only one argument
         if(arguments.size() != 1)
             throw invalid_call("[compiler error] the bit <string> function expects only one argument.");
 
-        // make sure each argument is an literal expression
-        std::shared_ptr<expr>& arg = arguments[0];
-        if(arg -> is_literal_expression() == false)
-            throw invalid_call("[compiler error] the bit <string> function expects its argument to bebits.");
+        std::shared_ptr<literal_expression> arg_lit = get_bits_argument(arguments, 0, "<string>");
+        const bit_vector& arg_val = arg_lit -> get_bits_value();
+
+        // we put a separator between every group of four bits, counting from the least significant bit
+        std::size_t bits_count = arg_val.size();
+        std::string bit_str = "0b";
+        bit_str.reserve(2 + bits_count + bits_count / 4);
+        for(std::size_t i = bits_count; i > 0; i--) {
+            bit_str.push_back(arg_val.test(i - 1) ? '1' : '0');
+            if(i > 1 && (i - 1) % 4 == 0)
+                bit_str.push_back('\'');
+        }
 
-        // get the literal expressions
-        std::shared_ptr<literal_expression> const & arg_lit = std::static_pointer_cast<literal_expression>(arg);
-
-        // double check the type instance
-        type_instance& arg_instance = arg_lit -> get_type_instance();
-        if(type_instance_strong_compare(arg_instance, bit_instance) == false)
-            throw invalid_call("[compiler error] the bit <string> function expects its argument to be bits.");
-
-        // create new literal with the new integer
-        std::bitset<1> arg_val = arg_lit -> get_bit_value();
-        std::string bit_str = "0b" + arg_val.to_string();
-        token lit_tok(STRING, bit_str, 0, 0, "__bil__");
-        std::shared_ptr<literal_expression> string_lit = std::make_shared<literal_expression>(lit_tok, STRING_EXPR, bit_str);
+        std::shared_ptr<literal_expression> string_lit = std::make_shared<literal_expression>(builtin_token(STRING), STRING_EXPR, bit_str);
         string_lit -> set_type_instance(string_instance);
         return string_lit;
     }
@@ -291,59 +219,37 @@ namespace avalon {
      * returns a bit indicating whether its arguments are equal
      */
     std::shared_ptr<expr> bit_eq(std::vector<std::shared_ptr<expr> >& arguments) {
-        // bit type
-        avalon_bit avl_bit;
-        type_instance bit_instance = avl_bit.get_type_instance();
-
-        // bool type
-        avalon_bool avl_bool;
-        type_instance bool_instance = avl_bool.get_type_instance();
-
-        // true expression
-        std::shared_ptr<identifier_expression> true_expr = std::make_shared<identifier_expression>(true_cons_tok);
-        true_expr -> set_type_instance(bool_instance);
-        true_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        std::shared_ptr<expr> true_final_expr = true_expr;
-
-        // false expression
-        std::shared_ptr<identifier_expression> false_expr = std::make_shared<identifier_expression>(false_cons_tok);
-        false_expr -> set_type_instance(bool_instance);
-        false_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        std::shared_ptr<expr> false_final_expr = false_expr;
-
-        // make sure we got only two arguments
-        if(arguments.size() != 2)
-            throw invalid_call("[compiler error] the bitwise __eq__ function expects only two arguments.");
-
-        // make sure each argument is an literal expression
-        std::shared_ptr<expr>& arg_one = arguments[0];        
-        if(arg_one -> is_literal_expression() == false)
-            throw invalid_call("[compiler error] the bitwise __eq__ function expects its arguments to be bits.");
+        std::pair<std::shared_ptr<literal_expression>, std::shared_ptr<literal_expression> > args = get_bits_arguments(arguments, "__eq__");
+        return bool_value(args.first -> get_bits_value() == args.second -> get_bits_value());
+    }
 
-        std::shared_ptr<expr>& arg_two = arguments[1];
-        if(arg_two -> is_literal_expression() == false)
-            throw invalid_call("[compiler error] the bitwise __eq__ function expects its arguments to be bits.");
+    /**
+     * bit_ne
+     * returns a bit indicating whether its arguments are not equal
+     */
+    std::shared_ptr<expr> bit_ne(std::vector<std::shared_ptr<expr> >& arguments) {
+        std::pair<std::shared_ptr<literal_expression>, std::shared_ptr<literal_expression> > args = get_bits_arguments(arguments, "__ne__");
+        return bool_value(args.first -> get_bits_value() != args.second -> get_bits_value());
+    }
 
-        // get the literal expressions
-        std::shared_ptr<literal_expression> const & arg_one_lit = std::static_pointer_cast<literal_expression>(arg_one);
-        std::shared_ptr<literal_expression> const & arg_two_lit = std::static_pointer_cast<literal_expression>(arg_two);
+    /**
+     * bit_popcount
+     * returns the number of bits set
+     */
+    std::shared_ptr<expr> bit_popcount(std::vector<std::shared_ptr<expr> >& arguments) {
+        // int type
+        static avalon_int avl_int;
+        type_instance int_instance = avl_int.get_type_instance();
 
-        // double check the type instance
-        type_instance& arg_one_instance = arg_one_lit -> get_type_instance();
-        if(type_instance_strong_compare(arg_one_instance, bit_instance) == false)
-            throw invalid_call("[compiler error] the bitwise __eq__ function expects its argument to be bits.");
+        // make sure we got only one argument
+        if(arguments.size() != 1)
+            throw invalid_call("[compiler error] the bitwise popcount function expects only one argument.");
 
-        type_instance& arg_two_instance = arg_two_lit -> get_type_instance();
-        if(type_instance_strong_compare(arg_two_instance, bit_instance) == false)
-            throw invalid_call("[compiler error] the bitwise __eq__ function expects its argument to be bits.");
-
-        // compare both arguments
-        std::bitset<1> arg_one_val = arg_one_lit -> get_bit_value();
-        std::bitset<1> arg_two_val = arg_two_lit -> get_bit_value();
-        if(arg_one_val == arg_two_val)
-            return true_final_expr;
-        else
-            return false_final_expr;
+        std::shared_ptr<literal_expression> arg_lit = get_bits_argument(arguments, 0, "popcount");
+        std::string count_str = std::to_string(arg_lit -> get_bits_value().count());
+        std::shared_ptr<literal_expression> int_lit = std::make_shared<literal_expression>(builtin_token(INTEGER), INTEGER_EXPR, count_str);
+        int_lit -> set_type_instance(int_instance);
+        return int_lit;
     }
 
     /**
@@ -351,12 +257,8 @@ namespace avalon {
      * returns the effective index where to find the requested bit
      */
     std::shared_ptr<expr> bit_refitem(std::vector<std::shared_ptr<expr> >& arguments) {
-        // bit type
-        avalon_bit avl_bit;
-        type_instance bit_instance = avl_bit.get_type_instance();
-
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
         // make sure we got exactly two arguments
@@ -378,9 +280,9 @@ namespace avalon {
         std::shared_ptr<literal_expression> const & arg_two_lit = std::static_pointer_cast<literal_expression>(arg_two);
 
         // double check the type instances
-        type_instance& arg_one_instance = arg_one_lit -> get_type_instance();
-        if(type_instance_strong_compare(arg_one_instance, bit_instance) == false)
-            throw invalid_call("[compiler error] the bit __refitem__ function expects its first argument to be an bit.");
+        std::size_t width = bit_width(arg_one_lit -> get_type_instance());
+        if(width == 0)
+            throw invalid_call("[compiler error] the bit __refitem__ function expects its first argument to be bits.");
 
         // make sure the second argument is an integer
         type_instance& arg_two_instance = arg_two_lit -> get_type_instance();
@@ -394,9 +296,9 @@ namespace avalon {
 
         std::size_t index = (std::size_t) user_index;
 
-        // if the index is not 0, then the checker did not do its job properly
-        if(index != 0)
-            throw invalid_call("[compiler error] trying to access a bit using index different from 0.");
+        // if the index is not within the bits, the checker failed
+        if(index >= width)
+            throw invalid_call("[compiler error] trying to access a bit using an index not between 0 and " + std::to_string(width - 1) + " on bits of width " + std::to_string(width) + ".");
 
         // we return the reference holding the integer index
         token gen_tok(MUL, "*", 0, 0, "__dummy__");
@@ -25,6 +25,7 @@
 #ifndef AVALON_INTERPRETER_BUILTINS_LANG_BIT_HPP_
 #define AVALON_INTERPRETER_BUILTINS_LANG_BIT_HPP_
 
+#include <cstddef>
 #include <memory>
 #include <vector>
 
@@ -34,6 +35,16 @@
 
 
 namespace avalon {
+    /*
+     * the functions below work on bits of any width, both arguments of binary functions must have the same width
+     */
+
+    /**
+     * bit_width
+     * returns the number of bits held by values of the given type instance or zero if it is not a bits type instance
+     */
+    std::size_t bit_width(type_instance& instance);
+
     /**
      * bit_and
      * computes the bitwise and of two bit expressions
@@ -82,6 +93,12 @@ namespace avalon {
      */
     std::shared_ptr<expr> bit_ne(std::vector<std::shared_ptr<expr> >& arguments);
 
+    /**
+     * bit_popcount
+     * returns the number of bits set
+     */
+    std::shared_ptr<expr> bit_popcount(std::vector<std::shared_ptr<expr> >& arguments);
+
     /**
      * bit_refitem
      * returns the effective index where to find the requested bit
@@ -49,26 +49,39 @@
 
 
 namespace avalon {
+    /**
+     * bool_value
+     * returns the shared boolean constructor expression for the given value.
+     * booleans are never modified once built so the same two expressions serve every caller.
+     */
+    std::shared_ptr<expr> bool_value(bool value) {
+        static std::shared_ptr<expr> true_expr = nullptr;
+        static std::shared_ptr<expr> false_expr = nullptr;
+        if(true_expr == nullptr) {
+            static avalon_bool avl_bool;
+            type_instance bool_instance = avl_bool.get_type_instance();
+
+            std::shared_ptr<identifier_expression> true_id = std::make_shared<identifier_expression>(true_cons_tok);
+            true_id -> set_type_instance(bool_instance);
+            true_id -> set_expression_type(CONSTRUCTOR_EXPR);
+            true_expr = true_id;
+
+            std::shared_ptr<identifier_expression> false_id = std::make_shared<identifier_expression>(false_cons_tok);
+            false_id -> set_type_instance(bool_instance);
+            false_id -> set_expression_type(CONSTRUCTOR_EXPR);
+            false_expr = false_id;
+        }
+        return value ? true_expr : false_expr;
+    }
+
     /**
      * bool_and
      * computes the boolean and of two boolean expressions
      */
     std::shared_ptr<expr> bool_and(std::vector<std::shared_ptr<expr> >& arguments) {
-        // bool type
-        avalon_bool avl_bool;
-        type_instance bool_instance = avl_bool.get_type_instance();
-
-        // true expression
-        std::shared_ptr<identifier_expression> true_expr = std::make_shared<identifier_expression>(true_cons_tok);
-        true_expr -> set_type_instance(bool_instance);
-        true_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        std::shared_ptr<expr> true_final_expr = true_expr;
-
-        // false expression
-        std::shared_ptr<identifier_expression> false_expr = std::make_shared<identifier_expression>(false_cons_tok);
-        false_expr -> set_type_instance(bool_instance);
-        false_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        std::shared_ptr<expr> false_final_expr = false_expr;
+        // true and false expressions
+        std::shared_ptr<expr> true_final_expr = bool_value(true);
+        std::shared_ptr<expr> false_final_expr = bool_value(false);
 
         // make sure we got only two arguments
         if(arguments.size() != 2)
@@ -96,21 +109,9 @@ namespace avalon {
      * computes the boolean or of two boolean expressions
      */
     std::shared_ptr<expr> bool_or(std::vector<std::shared_ptr<expr> >& arguments) {
-        // bool type
-        avalon_bool avl_bool;
-        type_instance bool_instance = avl_bool.get_type_instance();
-
-        // true expression
-        std::shared_ptr<identifier_expression> true_expr = std::make_shared<identifier_expression>(true_cons_tok);
-        true_expr -> set_type_instance(bool_instance);
-        true_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        std::shared_ptr<expr> true_final_expr = true_expr;
-
-        // false expression
-        std::shared_ptr<identifier_expression> false_expr = std::make_shared<identifier_expression>(false_cons_tok);
-        false_expr -> set_type_instance(bool_instance);
-        false_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        std::shared_ptr<expr> false_final_expr = false_expr;
+        // true and false expressions
+        std::shared_ptr<expr> true_final_expr = bool_value(true);
+        std::shared_ptr<expr> false_final_expr = bool_value(false);
 
         // make sure we got only two arguments
         if(arguments.size() != 2)
@@ -138,21 +139,9 @@ namespace avalon {
      * computes the boolean not of a single boolean expressions
      */
     std::shared_ptr<expr> bool_not(std::vector<std::shared_ptr<expr> >& arguments) {
-        // bool type
-        avalon_bool avl_bool;
-        type_instance bool_instance = avl_bool.get_type_instance();
-
-        // true expression
-        std::shared_ptr<identifier_expression> true_expr = std::make_shared<identifier_expression>(true_cons_tok);
-        true_expr -> set_type_instance(bool_instance);
-        true_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        std::shared_ptr<expr> true_final_expr = true_expr;
-
-        // false expression
-        std::shared_ptr<identifier_expression> false_expr = std::make_shared<identifier_expression>(false_cons_tok);
-        false_expr -> set_type_instance(bool_instance);
-        false_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        std::shared_ptr<expr> false_final_expr = false_expr;
+        // true and false expressions
+        std::shared_ptr<expr> true_final_expr = bool_value(true);
+        std::shared_ptr<expr> false_final_expr = bool_value(false);
 
         // make sure we got only one argument
         if(arguments.size() != 1)
@@ -179,7 +168,7 @@ namespace avalon {
      */
     std::shared_ptr<expr> bool_cast(std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance) {
         // string type
-        avalon_string avl_string;
+        static avalon_string avl_string;
         type_instance string_instance = avl_string.get_type_instance();
 
         if(type_instance_strong_compare(ret_instance, string_instance)) {
@@ -195,12 +184,8 @@ namespace avalon {
      * returns a boolean representation of a string
      */
     std::shared_ptr<expr> bool_string(std::vector<std::shared_ptr<expr> >& arguments) {
-        // bool type
-        avalon_bool avl_bool;
-        type_instance bool_instance = avl_bool.get_type_instance();
-
         // string type
-        avalon_string avl_string;
+        static avalon_string avl_string;
         type_instance string_instance = avl_string.get_type_instance();
 
         // string true expression
@@ -237,21 +222,9 @@ namespace avalon {
      * returns a boolean indicating whether its arguments are equal
      */
     std::shared_ptr<expr> bool_eq(std::vector<std::shared_ptr<expr> >& arguments) {
-        // bool type
-        avalon_bool avl_bool;
-        type_instance bool_instance = avl_bool.get_type_instance();
-
-        // true expression
-        std::shared_ptr<identifier_expression> true_expr = std::make_shared<identifier_expression>(true_cons_tok);
-        true_expr -> set_type_instance(bool_instance);
-        true_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        std::shared_ptr<expr> true_final_expr = true_expr;
-
-        // false expression
-        std::shared_ptr<identifier_expression> false_expr = std::make_shared<identifier_expression>(false_cons_tok);
-        false_expr -> set_type_instance(bool_instance);
-        false_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        std::shared_ptr<expr> false_final_expr = false_expr;
+        // true and false expressions
+        std::shared_ptr<expr> true_final_expr = bool_value(true);
+        std::shared_ptr<expr> false_final_expr = bool_value(false);
 
         // make sure we got only two arguments
         if(arguments.size() != 2)
@@ -282,21 +255,9 @@ namespace avalon {
      * returns a boolean indicating whether its arguments are not equal
      */
     std::shared_ptr<expr> bool_ne(std::vector<std::shared_ptr<expr> >& arguments) {
-        // bool type
-        avalon_bool avl_bool;
-        type_instance bool_instance = avl_bool.get_type_instance();
-
-        // true expression
-        std::shared_ptr<identifier_expression> true_expr = std::make_shared<identifier_expression>(true_cons_tok);
-        true_expr -> set_type_instance(bool_instance);
-        true_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        std::shared_ptr<expr> true_final_expr = true_expr;
-
-        // false expression
-        std::shared_ptr<identifier_expression> false_expr = std::make_shared<identifier_expression>(false_cons_tok);
-        false_expr -> set_type_instance(bool_instance);
-        false_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        std::shared_ptr<expr> false_final_expr = false_expr;
+        // true and false expressions
+        std::shared_ptr<expr> true_final_expr = bool_value(true);
+        std::shared_ptr<expr> false_final_expr = bool_value(false);
 
         // make sure we got only two arguments
         if(arguments.size() != 2)
@@ -34,6 +34,12 @@
 
 
 namespace avalon {
+    /**
+     * bool_value
+     * returns the shared boolean constructor expression for the given value
+     */
+    std::shared_ptr<expr> bool_value(bool value);
+
     /**
      * bool_and
      * computes the boolean and of two boolean expressions
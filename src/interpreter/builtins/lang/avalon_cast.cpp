@@ -44,20 +44,13 @@
 #include "representer/builtins/lang/avalon_qubit.hpp"
 #include "representer/builtins/lang/avalon_float.hpp"
 #include "representer/builtins/lang/avalon_bool.hpp"
-#include "representer/builtins/lang/avalon_bit2.hpp"
-#include "representer/builtins/lang/avalon_bit4.hpp"
-#include "representer/builtins/lang/avalon_bit8.hpp"
 #include "representer/builtins/lang/avalon_int.hpp"
-#include "representer/builtins/lang/avalon_bit.hpp"
 
 /* Builtin functions */
 #include "interpreter/builtins/lang/avalon_string.hpp"
 #include "interpreter/builtins/lang/avalon_qubit.hpp"
 #include "interpreter/builtins/lang/avalon_float.hpp"
 #include "interpreter/builtins/lang/avalon_bool.hpp"
-#include "interpreter/builtins/lang/avalon_bit2.hpp"
-#include "interpreter/builtins/lang/avalon_bit4.hpp"
-#include "interpreter/builtins/lang/avalon_bit8.hpp"
 #include "interpreter/builtins/lang/avalon_int.hpp"
 #include "interpreter/builtins/lang/avalon_bit.hpp"
 
@@ -75,27 +68,23 @@ namespace avalon {
      */
     std::shared_ptr<expr> avl_cast(std::shared_ptr<qprocessor>& qproc, std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance) {
         // bool type
-        avalon_bool avl_bool;
+        static avalon_bool avl_bool;
         type_instance bool_instance = avl_bool.get_type_instance();
 
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
         // float type
-        avalon_float avl_float;
+        static avalon_float avl_float;
         type_instance float_instance = avl_float.get_type_instance();
 
-        // bit type
-        avalon_bit avl_bit;
-        type_instance bit_instance = avl_bit.get_type_instance();
-
         // qubit type
-        avalon_qubit avl_qubit;
+        static avalon_qubit avl_qubit;
         type_instance qubit_instance = avl_qubit.get_type_instance();
 
         // string type
-        avalon_string avl_string;
+        static avalon_string avl_string;
         type_instance string_instance = avl_string.get_type_instance();
 
         // make sure we got only one argument
@@ -126,7 +115,7 @@ namespace avalon {
             else if(type_instance_strong_compare(arg_instance, float_instance)) {
                 return float_cast(arguments, ret_instance);
             }
-            else if(type_instance_strong_compare(arg_instance, bit_instance)) {
+            else if(bit_width(arg_instance) != 0) {
                 return bit_cast(arguments, ret_instance);
             }
             else if(type_instance_strong_compare(arg_instance, string_instance)) {
@@ -159,7 +148,7 @@ namespace avalon {
      */
     std::shared_ptr<expr> avl_bool_cast(std::vector<std::shared_ptr<expr> >& arguments) {
         // string type
-        avalon_string avl_string;
+        static avalon_string avl_string;
         type_instance string_instance = avl_string.get_type_instance();
 
         // make sure we got only one argument
@@ -189,7 +178,7 @@ namespace avalon {
      */
     std::shared_ptr<expr> avl_int_cast(std::vector<std::shared_ptr<expr> >& arguments) {
         // string type
-        avalon_string avl_string;
+        static avalon_string avl_string;
         type_instance string_instance = avl_string.get_type_instance();
 
         // make sure we got only one argument
@@ -219,11 +208,11 @@ namespace avalon {
      */
     std::shared_ptr<expr> avl_float_cast(std::vector<std::shared_ptr<expr> >& arguments) {
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
         // string type
-        avalon_string avl_string;
+        static avalon_string avl_string;
         type_instance string_instance = avl_string.get_type_instance();
 
         // make sure we got only one argument
@@ -259,33 +248,17 @@ namespace avalon {
      */
     std::shared_ptr<expr> avl_string_cast(std::vector<std::shared_ptr<expr> >& arguments) {
         // bool type
-        avalon_bool avl_bool;
+        static avalon_bool avl_bool;
         type_instance bool_instance = avl_bool.get_type_instance();
 
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
         // float type
-        avalon_float avl_float;
+        static avalon_float avl_float;
         type_instance float_instance = avl_float.get_type_instance();
 
-        // bit type
-        avalon_bit avl_bit;
-        type_instance bit_instance = avl_bit.get_type_instance();
-
-        // bit2 type
-        avalon_bit2 avl_bit2;
-        type_instance bit2_instance = avl_bit2.get_type_instance();
-
-        // bit4 type
-        avalon_bit4 avl_bit4;
-        type_instance bit4_instance = avl_bit4.get_type_instance();
-
-        // bit8 type
-        avalon_bit8 avl_bit8;
-        type_instance bit8_instance = avl_bit8.get_type_instance();
-
         // make sure we got only one argument
         if(arguments.size() != 1)
             throw invalid_call("[compiler error] the <string> function expects only one argument.");
@@ -313,18 +286,9 @@ namespace avalon {
             if(type_instance_strong_compare(arg_instance, float_instance)) {
                 return float_string(arguments);
             }
-            if(type_instance_strong_compare(arg_instance, bit_instance)) {
+            if(bit_width(arg_instance) != 0) {
                 return bit_string(arguments);
             }
-            if(type_instance_strong_compare(arg_instance, bit2_instance)) {
-                return bit2_string(arguments);
-            }
-            if(type_instance_strong_compare(arg_instance, bit4_instance)) {
-                return bit4_string(arguments);
-            }
-            if(type_instance_strong_compare(arg_instance, bit8_instance)) {
-                return bit8_string(arguments);
-            }
             else {
                 throw invalid_call("[compiler error] unexpected call to the <string> function using arguments of unsupported type instances");
             }
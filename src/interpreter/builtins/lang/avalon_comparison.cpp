@@ -41,7 +41,6 @@
 /* Builtins */
 #include "representer/builtins/lang/avalon_bool.hpp"
 #include "representer/builtins/lang/avalon_int.hpp"
-#include "representer/builtins/lang/avalon_bit.hpp"
 
 /* Builtin functions */
 #include "interpreter/builtins/lang/avalon_comparison.hpp"
@@ -60,17 +59,13 @@ namespace avalon {
      */
     std::shared_ptr<expr> avl_eq(std::vector<std::shared_ptr<expr> >& arguments) {
         // bool type
-        avalon_bool avl_bool;
+        static avalon_bool avl_bool;
         type_instance bool_instance = avl_bool.get_type_instance();
 
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
-        // bit type
-        avalon_bit avl_bit;
-        type_instance bit_instance = avl_bit.get_type_instance();
-
         // make sure we got only two arguments
         if(arguments.size() != 2)
             throw invalid_call("[compiler error] the builtin __eq__ function expects only two arguments.");
@@ -104,7 +99,7 @@ namespace avalon {
             if(type_instance_strong_compare(arg_one_instance, int_instance) && type_instance_strong_compare(arg_two_instance, int_instance)) {
                 return int_eq(arguments);
             }
-            else if(type_instance_strong_compare(arg_one_instance, bit_instance) && type_instance_strong_compare(arg_two_instance, bit_instance)) {
+            else if(bit_width(arg_one_instance) != 0 && bit_width(arg_two_instance) != 0) {
                 return bit_eq(arguments);
             }
             else {
@@ -122,17 +117,13 @@ namespace avalon {
      */
     std::shared_ptr<expr> avl_ne(std::vector<std::shared_ptr<expr> >& arguments) {
         // bool type
-        avalon_bool avl_bool;
+        static avalon_bool avl_bool;
         type_instance bool_instance = avl_bool.get_type_instance();
 
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
-        // bit type
-        avalon_bit avl_bit;
-        type_instance bit_instance = avl_bit.get_type_instance();
-
         // make sure we got only two arguments
         if(arguments.size() != 2)
             throw invalid_call("[compiler error] the builtin __ne__ function expects only two arguments.");
@@ -166,8 +157,8 @@ namespace avalon {
             if(type_instance_strong_compare(arg_one_instance, int_instance) && type_instance_strong_compare(arg_two_instance, int_instance)) {
                 return int_ne(arguments);
             }
-            else if(type_instance_strong_compare(arg_one_instance, bit_instance) && type_instance_strong_compare(arg_two_instance, bit_instance)) {
-                return bit_eq(arguments);
+            else if(bit_width(arg_one_instance) != 0 && bit_width(arg_two_instance) != 0) {
+                return bit_ne(arguments);
             }
             else {
                 throw invalid_call("[compiler error] unexpected call to builtin function __ne__ using arguments of unsupported type instances");
@@ -184,7 +175,7 @@ namespace avalon {
      */
     std::shared_ptr<expr> avl_gt(std::vector<std::shared_ptr<expr> >& arguments) {
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
         // make sure we got only two arguments
@@ -223,7 +214,7 @@ namespace avalon {
      */
     std::shared_ptr<expr> avl_ge(std::vector<std::shared_ptr<expr> >& arguments) {
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
         // make sure we got only two arguments
@@ -262,7 +253,7 @@ namespace avalon {
      */
     std::shared_ptr<expr> avl_lt(std::vector<std::shared_ptr<expr> >& arguments) {
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
         // make sure we got only two arguments
@@ -301,7 +292,7 @@ namespace avalon {
      */
     std::shared_ptr<expr> avl_le(std::vector<std::shared_ptr<expr> >& arguments) {
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
         // make sure we got only two arguments
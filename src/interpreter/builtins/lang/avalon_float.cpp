@@ -57,7 +57,7 @@ namespace avalon {
      */
     std::shared_ptr<expr> float_pos(std::vector<std::shared_ptr<expr> >& arguments) {
         // float type
-        avalon_float avl_float;
+        static avalon_float avl_float;
         type_instance float_instance = avl_float.get_type_instance();
 
         // make sure we got only one argument
@@ -86,7 +86,7 @@ namespace avalon {
      */
     std::shared_ptr<expr> float_neg(std::vector<std::shared_ptr<expr> >& arguments) {
         // float type
-        avalon_float avl_float;
+        static avalon_float avl_float;
         type_instance float_instance = avl_float.get_type_instance();
 
         // make sure we got only one argument
@@ -115,8 +115,7 @@ namespace avalon {
         std::string res_str = sstr.str();
 
         // create new literal with the new floating point number
-        token lit_tok(FLOATING_POINT, res_str, 0, 0, "__bil__");
-        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(lit_tok, FLOATING_POINT_EXPR, res_str);
+        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(builtin_token(FLOATING_POINT), FLOATING_POINT_EXPR, res_str);
         res_lit -> set_type_instance(float_instance);
 
         return res_lit;
@@ -128,7 +127,7 @@ namespace avalon {
      */
     std::shared_ptr<expr> float_add(std::vector<std::shared_ptr<expr> >& arguments) {
         // float type
-        avalon_float avl_float;
+        static avalon_float avl_float;
         type_instance float_instance = avl_float.get_type_instance();
 
         // make sure we got only two arguments
@@ -167,8 +166,7 @@ namespace avalon {
         std::string res_str = sstr.str();
 
         // create new literal with the new floating point number
-        token lit_tok(FLOATING_POINT, res_str, 0, 0, "__bil__");
-        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(lit_tok, FLOATING_POINT_EXPR, res_str);
+        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(builtin_token(FLOATING_POINT), FLOATING_POINT_EXPR, res_str);
         res_lit -> set_type_instance(float_instance);
 
         return res_lit;
@@ -180,7 +178,7 @@ namespace avalon {
      */
     std::shared_ptr<expr> float_sub(std::vector<std::shared_ptr<expr> >& arguments) {
         // float type
-        avalon_float avl_float;
+        static avalon_float avl_float;
         type_instance float_instance = avl_float.get_type_instance();
 
         // make sure we got only two arguments
@@ -219,8 +217,7 @@ namespace avalon {
         std::string res_str = sstr.str();
 
         // create new literal with the new floating point number
-        token lit_tok(FLOATING_POINT, res_str, 0, 0, "__bil__");
-        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(lit_tok, FLOATING_POINT_EXPR, res_str);
+        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(builtin_token(FLOATING_POINT), FLOATING_POINT_EXPR, res_str);
         res_lit -> set_type_instance(float_instance);
 
         return res_lit;
@@ -232,7 +229,7 @@ namespace avalon {
      */
     std::shared_ptr<expr> float_mul(std::vector<std::shared_ptr<expr> >& arguments) {
         // float type
-        avalon_float avl_float;
+        static avalon_float avl_float;
         type_instance float_instance = avl_float.get_type_instance();
 
         // make sure we got only two arguments
@@ -271,8 +268,7 @@ namespace avalon {
         std::string res_str = sstr.str();
 
         // create new literal with the new floating point number
-        token lit_tok(FLOATING_POINT, res_str, 0, 0, "__bil__");
-        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(lit_tok, FLOATING_POINT_EXPR, res_str);
+        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(builtin_token(FLOATING_POINT), FLOATING_POINT_EXPR, res_str);
         res_lit -> set_type_instance(float_instance);
 
         return res_lit;
@@ -284,7 +280,7 @@ namespace avalon {
      */
     std::shared_ptr<expr> float_div(std::vector<std::shared_ptr<expr> >& arguments) {
         // float type
-        avalon_float avl_float;
+        static avalon_float avl_float;
         type_instance float_instance = avl_float.get_type_instance();
 
         // make sure we got only two arguments
@@ -328,8 +324,7 @@ namespace avalon {
         std::string res_str = sstr.str();
 
         // create new literal with the new floating point number
-        token lit_tok(FLOATING_POINT, res_str, 0, 0, "__bil__");
-        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(lit_tok, FLOATING_POINT_EXPR, res_str);
+        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(builtin_token(FLOATING_POINT), FLOATING_POINT_EXPR, res_str);
         res_lit -> set_type_instance(float_instance);
         std::shared_ptr<expr> final_expr = res_lit;
 
@@ -342,7 +337,7 @@ namespace avalon {
      */
     std::shared_ptr<expr> float_cast(std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance) {
         // string type
-        avalon_string avl_string;
+        static avalon_string avl_string;
         type_instance string_instance = avl_string.get_type_instance();
 
         if(type_instance_strong_compare(ret_instance, string_instance)) {
@@ -359,11 +354,11 @@ namespace avalon {
      */
     std::shared_ptr<expr> float_string(std::vector<std::shared_ptr<expr> >& arguments) {
         // float type
-        avalon_float avl_float;
+        static avalon_float avl_float;
         type_instance float_instance = avl_float.get_type_instance();
 
         // string type
-        avalon_string avl_string;
+        static avalon_string avl_string;
         type_instance string_instance = avl_string.get_type_instance();
 
         // make sure we got only one argument
@@ -391,8 +386,7 @@ namespace avalon {
         std::string float_str = sstr.str();
         if(float_str.find('.') == std::string::npos)
             float_str += ".0";
-        token lit_tok(FLOATING_POINT, float_str, 0, 0, "__bil__");
-        std::shared_ptr<literal_expression> float_lit = std::make_shared<literal_expression>(lit_tok, STRING_EXPR, float_str);
+        std::shared_ptr<literal_expression> float_lit = std::make_shared<literal_expression>(builtin_token(FLOATING_POINT), STRING_EXPR, float_str);
         float_lit -> set_type_instance(string_instance);
 
         return float_lit;
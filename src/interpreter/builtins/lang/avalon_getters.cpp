@@ -37,17 +37,10 @@
 
 /* Builtin programs */
 #include "representer/builtins/lang/avalon_string.hpp"
-#include "representer/builtins/lang/avalon_bit8.hpp"
-#include "representer/builtins/lang/avalon_bit4.hpp"
-#include "representer/builtins/lang/avalon_bit2.hpp"
-#include "representer/builtins/lang/avalon_bit.hpp"
 
 /* Builtin functions */
 #include "interpreter/builtins/lang/avalon_getters.hpp"
 #include "interpreter/builtins/lang/avalon_string.hpp"
-#include "interpreter/builtins/lang/avalon_bit8.hpp"
-#include "interpreter/builtins/lang/avalon_bit4.hpp"
-#include "interpreter/builtins/lang/avalon_bit2.hpp"
 #include "interpreter/builtins/lang/avalon_bit.hpp"
 
 /* Exceptions */
@@ -61,25 +54,9 @@ namespace avalon {
      */
     std::shared_ptr<expr> avl_refitem(std::vector<std::shared_ptr<expr> >& arguments) {
         // string type
-        avalon_string avl_string;
+        static avalon_string avl_string;
         type_instance string_instance = avl_string.get_type_instance();
 
-        // bit type
-        avalon_bit avl_bit;
-        type_instance bit_instance = avl_bit.get_type_instance();
-
-        // bit2 type
-        avalon_bit2 avl_bit2;
-        type_instance bit2_instance = avl_bit2.get_type_instance();
-
-        // bit4 type
-        avalon_bit4 avl_bit4;
-        type_instance bit4_instance = avl_bit4.get_type_instance();
-
-        // bit8 type
-        avalon_bit8 avl_bit8;
-        type_instance bit8_instance = avl_bit8.get_type_instance();
-
         // make sure we got only two arguments
         if(arguments.size() != 2)
             throw invalid_call("[compiler error] the builtin __refitem__ function expects only two arguments.");
@@ -93,18 +70,9 @@ namespace avalon {
             if(type_instance_strong_compare(arg_one_instance, string_instance)) {
                 return string_refitem(arguments);
             }
-            else if(type_instance_strong_compare(arg_one_instance, bit_instance)) {
+            else if(bit_width(arg_one_instance) != 0) {
                 return bit_refitem(arguments);
             }
-            else if(type_instance_strong_compare(arg_one_instance, bit2_instance)) {
-                return bit2_refitem(arguments);
-            }
-            else if(type_instance_strong_compare(arg_one_instance, bit4_instance)) {
-                return bit4_refitem(arguments);
-            }
-            else if(type_instance_strong_compare(arg_one_instance, bit8_instance)) {
-                return bit8_refitem(arguments);
-            }
             else {
                 throw invalid_call("[compiler error] unexpected call to builtin function __refitem__ using arguments of unsupported type instances");
             }
@@ -53,7 +53,7 @@ namespace avalon {
      */
     std::shared_ptr<expr> avl_hash(std::vector<std::shared_ptr<expr> >& arguments) {
         // string type
-        avalon_string avl_string;
+        static avalon_string avl_string;
         type_instance string_instance = avl_string.get_type_instance();
 
         // make sure we got only one argument
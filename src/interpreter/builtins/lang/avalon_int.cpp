@@ -49,6 +49,7 @@
 
 /* Builtin functions */
 #include "interpreter/builtins/lang/avalon_int.hpp"
+#include "interpreter/builtins/lang/avalon_bool.hpp"
 
 /* Exceptions */
 #include "interpreter/exceptions/invalid_call.hpp"
@@ -61,7 +62,7 @@ namespace avalon {
      */
     std::shared_ptr<expr> int_pos(std::vector<std::shared_ptr<expr> >& arguments) {
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
         // make sure we got only one argument
@@ -90,7 +91,7 @@ namespace avalon {
      */
     std::shared_ptr<expr> int_neg(std::vector<std::shared_ptr<expr> >& arguments) {
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
         // make sure we got only one argument
@@ -116,8 +117,7 @@ namespace avalon {
         std::string res_str = std::to_string(res_val);
 
         // create new literal with the new integer
-        token lit_tok(INTEGER, res_str, 0, 0, "__bil__");
-        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(lit_tok, INTEGER_EXPR, res_str);
+        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(builtin_token(INTEGER), INTEGER_EXPR, res_str);
         res_lit -> set_type_instance(int_instance);
 
         return res_lit;
@@ -129,7 +129,7 @@ namespace avalon {
      */
     std::shared_ptr<expr> int_add(std::vector<std::shared_ptr<expr> >& arguments) {
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
         // make sure we got only two arguments
@@ -165,8 +165,7 @@ namespace avalon {
         std::string res_str = std::to_string(res_val);
 
         // create new literal with the new integer
-        token lit_tok(INTEGER, res_str, 0, 0, "__bil__");
-        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(lit_tok, INTEGER_EXPR, res_str);
+        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(builtin_token(INTEGER), INTEGER_EXPR, res_str);
         res_lit -> set_type_instance(int_instance);
 
         return res_lit;
@@ -178,7 +177,7 @@ namespace avalon {
      */
     std::shared_ptr<expr> int_sub(std::vector<std::shared_ptr<expr> >& arguments) {
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
         // make sure we got only two arguments
@@ -214,8 +213,7 @@ namespace avalon {
         std::string res_str = std::to_string(res_val);
 
         // create new literal with the new integer
-        token lit_tok(INTEGER, res_str, 0, 0, "__bil__");
-        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(lit_tok, INTEGER_EXPR, res_str);
+        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(builtin_token(INTEGER), INTEGER_EXPR, res_str);
         res_lit -> set_type_instance(int_instance);
 
         return res_lit;
@@ -227,7 +225,7 @@ namespace avalon {
      */
     std::shared_ptr<expr> int_mul(std::vector<std::shared_ptr<expr> >& arguments) {
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
         // make sure we got only two arguments
@@ -263,8 +261,7 @@ namespace avalon {
         std::string res_str = std::to_string(res_val);
 
         // create new literal with the new integer
-        token lit_tok(INTEGER, res_str, 0, 0, "__bil__");
-        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(lit_tok, INTEGER_EXPR, res_str);
+        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(builtin_token(INTEGER), INTEGER_EXPR, res_str);
         res_lit -> set_type_instance(int_instance);
 
         return res_lit;
@@ -276,11 +273,11 @@ namespace avalon {
      */
     std::shared_ptr<expr> int_div(std::vector<std::shared_ptr<expr> >& arguments) {
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
         // maybe type
-        avalon_maybe avl_maybe;
+        static avalon_maybe avl_maybe;
         type_instance maybe_instance = avl_maybe.get_type_instance(int_instance);
 
         // make sure we got only two arguments
@@ -323,8 +320,7 @@ namespace avalon {
         else {
             long long int res_val = arg_one_val / arg_two_val;
             std::string res_str = std::to_string(res_val);
-            token lit_tok(INTEGER, res_str, 0, 0, "__bil__");
-            std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(lit_tok, INTEGER_EXPR, res_str);
+            std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(builtin_token(INTEGER), INTEGER_EXPR, res_str);
             res_lit -> set_type_instance(int_instance);
             std::shared_ptr<expr> res_lit_expr = res_lit;
 
@@ -343,7 +339,7 @@ namespace avalon {
      */
     std::shared_ptr<expr> int_mod(std::vector<std::shared_ptr<expr> >& arguments) {
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
         // make sure we got only two arguments
@@ -379,8 +375,7 @@ namespace avalon {
         std::string res_str = std::to_string(res_val);
 
         // create new literal with the new integer
-        token lit_tok(INTEGER, res_str, 0, 0, "__bil__");
-        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(lit_tok, INTEGER_EXPR, res_str);
+        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(builtin_token(INTEGER), INTEGER_EXPR, res_str);
         res_lit -> set_type_instance(int_instance);
 
         return res_lit;
@@ -392,7 +387,7 @@ namespace avalon {
      */
     std::shared_ptr<expr> int_pow(std::vector<std::shared_ptr<expr> >& arguments) {
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
         // make sure we got only two arguments
@@ -428,8 +423,7 @@ namespace avalon {
         std::string res_str = std::to_string(res_val);
 
         // create new literal with the new integer
-        token lit_tok(INTEGER, res_str, 0, 0, "__bil__");
-        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(lit_tok, INTEGER_EXPR, res_str);
+        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(builtin_token(INTEGER), INTEGER_EXPR, res_str);
         res_lit -> set_type_instance(int_instance);
 
         return res_lit;
@@ -441,11 +435,11 @@ namespace avalon {
      */
     std::shared_ptr<expr> int_cast(std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance) {
         // string type
-        avalon_string avl_string;
+        static avalon_string avl_string;
         type_instance string_instance = avl_string.get_type_instance();
 
         // float type
-        avalon_float avl_float;
+        static avalon_float avl_float;
         type_instance float_instance = avl_float.get_type_instance();
 
         if(type_instance_strong_compare(ret_instance, string_instance)) {
@@ -465,11 +459,11 @@ namespace avalon {
      */
     std::shared_ptr<expr> int_string(std::vector<std::shared_ptr<expr> >& arguments) {
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
         // string type
-        avalon_string avl_string;
+        static avalon_string avl_string;
         type_instance string_instance = avl_string.get_type_instance();
 
         // make sure we got only one argument
@@ -492,8 +486,7 @@ namespace avalon {
         // create new literal with the new integer
         long long int arg_val = arg_lit -> get_int_value();
         std::string int_str = std::to_string(arg_val);
-        token lit_tok(STRING, int_str, 0, 0, "__bil__");
-        std::shared_ptr<literal_expression> string_lit = std::make_shared<literal_expression>(lit_tok, STRING_EXPR, int_str);
+        std::shared_ptr<literal_expression> string_lit = std::make_shared<literal_expression>(builtin_token(STRING), STRING_EXPR, int_str);
         string_lit -> set_type_instance(string_instance);
         return string_lit;
     }
@@ -504,11 +497,11 @@ namespace avalon {
      */
     std::shared_ptr<expr> int_float(std::vector<std::shared_ptr<expr> >& arguments) {
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
         // float type
-        avalon_float avl_float;
+        static avalon_float avl_float;
         type_instance float_instance = avl_float.get_type_instance();
 
         // make sure we got only one argument
@@ -532,8 +525,7 @@ namespace avalon {
         long long int arg_val = arg_lit -> get_int_value();
         float int_float = (float) arg_val;
         std::string float_str = std::to_string(int_float);
-        token lit_tok(FLOATING_POINT, float_str, 0, 0, "__bil__");
-        std::shared_ptr<literal_expression> float_lit = std::make_shared<literal_expression>(lit_tok, FLOATING_POINT_EXPR, float_str);
+        std::shared_ptr<literal_expression> float_lit = std::make_shared<literal_expression>(builtin_token(FLOATING_POINT), FLOATING_POINT_EXPR, float_str);
         float_lit -> set_type_instance(float_instance);
         return float_lit;
     }
@@ -544,24 +536,12 @@ namespace avalon {
      */
     std::shared_ptr<expr> int_eq(std::vector<std::shared_ptr<expr> >& arguments) {
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
-        // bool type
-        avalon_bool avl_bool;
-        type_instance bool_instance = avl_bool.get_type_instance();
-
-        // true expression
-        std::shared_ptr<identifier_expression> true_expr = std::make_shared<identifier_expression>(true_cons_tok);
-        true_expr -> set_type_instance(bool_instance);
-        true_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        std::shared_ptr<expr> true_final_expr = true_expr;
-
-        // false expression
-        std::shared_ptr<identifier_expression> false_expr = std::make_shared<identifier_expression>(false_cons_tok);
-        false_expr -> set_type_instance(bool_instance);
-        false_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        std::shared_ptr<expr> false_final_expr = false_expr;
+        // true and false expressions
+        std::shared_ptr<expr> true_final_expr = bool_value(true);
+        std::shared_ptr<expr> false_final_expr = bool_value(false);
 
         // make sure we got only two arguments
         if(arguments.size() != 2)
@@ -604,24 +584,12 @@ namespace avalon {
      */
     std::shared_ptr<expr> int_ne(std::vector<std::shared_ptr<expr> >& arguments) {
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
-        // bool type
-        avalon_bool avl_bool;
-        type_instance bool_instance = avl_bool.get_type_instance();
-
-        // true expression
-        std::shared_ptr<identifier_expression> true_expr = std::make_shared<identifier_expression>(true_cons_tok);
-        true_expr -> set_type_instance(bool_instance);
-        true_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        std::shared_ptr<expr> true_final_expr = true_expr;
-
-        // false expression
-        std::shared_ptr<identifier_expression> false_expr = std::make_shared<identifier_expression>(false_cons_tok);
-        false_expr -> set_type_instance(bool_instance);
-        false_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        std::shared_ptr<expr> false_final_expr = false_expr;
+        // true and false expressions
+        std::shared_ptr<expr> true_final_expr = bool_value(true);
+        std::shared_ptr<expr> false_final_expr = bool_value(false);
 
         // make sure we got only two arguments
         if(arguments.size() != 2)
@@ -664,24 +632,12 @@ namespace avalon {
      */
     std::shared_ptr<expr> int_gt(std::vector<std::shared_ptr<expr> >& arguments) {
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
-        // bool type
-        avalon_bool avl_bool;
-        type_instance bool_instance = avl_bool.get_type_instance();
-
-        // true expression
-        std::shared_ptr<identifier_expression> true_expr = std::make_shared<identifier_expression>(true_cons_tok);
-        true_expr -> set_type_instance(bool_instance);
-        true_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        std::shared_ptr<expr> true_final_expr = true_expr;
-
-        // false expression
-        std::shared_ptr<identifier_expression> false_expr = std::make_shared<identifier_expression>(false_cons_tok);
-        false_expr -> set_type_instance(bool_instance);
-        false_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        std::shared_ptr<expr> false_final_expr = false_expr;
+        // true and false expressions
+        std::shared_ptr<expr> true_final_expr = bool_value(true);
+        std::shared_ptr<expr> false_final_expr = bool_value(false);
 
         // make sure we got only two arguments
         if(arguments.size() != 2)
@@ -724,24 +680,12 @@ namespace avalon {
      */
     std::shared_ptr<expr> int_ge(std::vector<std::shared_ptr<expr> >& arguments) {
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
-        // bool type
-        avalon_bool avl_bool;
-        type_instance bool_instance = avl_bool.get_type_instance();
-
-        // true expression
-        std::shared_ptr<identifier_expression> true_expr = std::make_shared<identifier_expression>(true_cons_tok);
-        true_expr -> set_type_instance(bool_instance);
-        true_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        std::shared_ptr<expr> true_final_expr = true_expr;
-
-        // false expression
-        std::shared_ptr<identifier_expression> false_expr = std::make_shared<identifier_expression>(false_cons_tok);
-        false_expr -> set_type_instance(bool_instance);
-        false_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        std::shared_ptr<expr> false_final_expr = false_expr;
+        // true and false expressions
+        std::shared_ptr<expr> true_final_expr = bool_value(true);
+        std::shared_ptr<expr> false_final_expr = bool_value(false);
 
         // make sure we got only two arguments
         if(arguments.size() != 2)
@@ -784,24 +728,12 @@ namespace avalon {
      */
     std::shared_ptr<expr> int_lt(std::vector<std::shared_ptr<expr> >& arguments) {
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
-        // bool type
-        avalon_bool avl_bool;
-        type_instance bool_instance = avl_bool.get_type_instance();
-
-        // true expression
-        std::shared_ptr<identifier_expression> true_expr = std::make_shared<identifier_expression>(true_cons_tok);
-        true_expr -> set_type_instance(bool_instance);
-        true_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        std::shared_ptr<expr> true_final_expr = true_expr;
-
-        // false expression
-        std::shared_ptr<identifier_expression> false_expr = std::make_shared<identifier_expression>(false_cons_tok);
-        false_expr -> set_type_instance(bool_instance);
-        false_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        std::shared_ptr<expr> false_final_expr = false_expr;
+        // true and false expressions
+        std::shared_ptr<expr> true_final_expr = bool_value(true);
+        std::shared_ptr<expr> false_final_expr = bool_value(false);
 
         // make sure we got only two arguments
         if(arguments.size() != 2)
@@ -844,24 +776,12 @@ namespace avalon {
      */
     std::shared_ptr<expr> int_le(std::vector<std::shared_ptr<expr> >& arguments) {
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
-        // bool type
-        avalon_bool avl_bool;
-        type_instance bool_instance = avl_bool.get_type_instance();
-
-        // true expression
-        std::shared_ptr<identifier_expression> true_expr = std::make_shared<identifier_expression>(true_cons_tok);
-        true_expr -> set_type_instance(bool_instance);
-        true_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        std::shared_ptr<expr> true_final_expr = true_expr;
-
-        // false expression
-        std::shared_ptr<identifier_expression> false_expr = std::make_shared<identifier_expression>(false_cons_tok);
-        false_expr -> set_type_instance(bool_instance);
-        false_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        std::shared_ptr<expr> false_final_expr = false_expr;
+        // true and false expressions
+        std::shared_ptr<expr> true_final_expr = bool_value(true);
+        std::shared_ptr<expr> false_final_expr = bool_value(false);
 
         // make sure we got only two arguments
         if(arguments.size() != 2)
@@ -0,0 +1,263 @@
+/*
+ *  This file is part of the Avalon programming language
+ * 
+ *  Copyright (c) 2018 Ntwali Bashige Toussaint
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <string>
+
+/* Lexer */
+#include "lexer/token_type.hpp"
+#include "lexer/token.hpp"
+
+/* AST */
+/* Declarations */
+#include "representer/ast/decl/variable.hpp"
+#include "representer/ast/decl/type.hpp"
+/* Expressions */
+#include "representer/ast/expr/identifier_expression.hpp"
+#include "representer/ast/expr/reference_expression.hpp"
+#include "representer/ast/expr/literal_expression.hpp"
+#include "representer/ast/expr/call_expression.hpp"
+#include "representer/ast/expr/list_expression.hpp"
+#include "representer/ast/expr/expr.hpp"
+
+/* Builtins */
+#include "representer/builtins/lang/avalon_maybe.hpp"
+#include "representer/builtins/lang/avalon_int.hpp"
+
+/* Builtin functions */
+#include "interpreter/builtins/lang/avalon_list.hpp"
+#include "interpreter/builtins/lang/avalon_bool.hpp"
+
+/* Exceptions */
+#include "interpreter/exceptions/invalid_call.hpp"
+
+
+namespace avalon {
+/**
+ * get_list
+ * returns the list expression held by the given argument, making sure it is indeed a list
+ */
+static std::shared_ptr<list_expression> get_list(std::shared_ptr<expr>& arg, const std::string& fun_name) {
+    if(arg -> is_list_expression() == false)
+        throw invalid_call("[compiler error] the list <" + fun_name + "> function expects its first argument to be a list.");
+
+    return std::static_pointer_cast<list_expression>(arg);
+}
+
+/**
+ * get_writable_list
+ * given a reference to a list variable, returns the list held by that variable so it can be modified in place.
+ * lists are shared between variables when they are copied (var b = a) so if anyone else holds the list,
+ * we first give the variable its own copy of the list (copy-on-write) so the change is not visible to the other holders.
+ */
+static std::shared_ptr<list_expression> get_writable_list(std::shared_ptr<expr>& arg, const std::string& fun_name) {
+    if(arg -> is_reference_expression() == false)
+        throw invalid_call("[compiler error] the list <" + fun_name + "> function expects its first argument to be a reference to a list.");
+
+    std::shared_ptr<reference_expression> const & ref_expr = std::static_pointer_cast<reference_expression>(arg);
+    if(ref_expr -> get_expression_type() != REF_VAR_EXPR || ref_expr -> get_variable() == nullptr)
+        throw invalid_call("[compiler error] the list <" + fun_name + "> function expects its first argument to be a reference to a list variable.");
+
+    std::shared_ptr<variable>& ref_var = ref_expr -> get_variable();
+    std::shared_ptr<expr>& var_expr = ref_var -> get_value();
+    if(var_expr == nullptr || var_expr -> is_list_expression() == false)
+        throw invalid_call("[compiler error] the list <" + fun_name + "> function expects its first argument to be a reference to a list.");
+
+    // the variable is the only holder of the list, we can modify it directly
+    if(var_expr.use_count() == 1)
+        return std::static_pointer_cast<list_expression>(var_expr);
+
+    // someone else holds the list, we copy the elements (not the elements themselves as they are never modified) into a new list
+    std::shared_ptr<list_expression> const & shared_list = std::static_pointer_cast<list_expression>(var_expr);
+    token list_tok = shared_list -> get_token();
+    std::shared_ptr<list_expression> own_list = std::make_shared<list_expression>(list_tok);
+    own_list -> set_type_instance(shared_list -> get_type_instance());
+    own_list -> get_elements() = shared_list -> get_elements();
+    std::shared_ptr<expr> own_expr = own_list;
+    ref_var -> set_value(own_expr);
+    return own_list;
+}
+
+/**
+ * get_index
+ * returns the integer held by the given argument
+ */
+static long long int get_index(std::shared_ptr<expr>& arg, const std::string& fun_name) {
+    if(arg -> is_literal_expression() == false)
+        throw invalid_call("[compiler error] the list <" + fun_name + "> function expects an integer index.");
+
+    std::shared_ptr<literal_expression> const & arg_lit = std::static_pointer_cast<literal_expression>(arg);
+    if(arg_lit -> get_expression_type() != INTEGER_EXPR)
+        throw invalid_call("[compiler error] the list <" + fun_name + "> function expects an integer index.");
+
+    return arg_lit -> get_int_value();
+}
+
+    /**
+     * list_append
+     * appends an element at the end of the referenced list
+     */
+    std::shared_ptr<expr> list_append(std::vector<std::shared_ptr<expr> >& arguments) {
+        // make sure we got only two arguments
+        if(arguments.size() != 2)
+            throw invalid_call("[compiler error] the list <append> function expects only two arguments.");
+
+        // the elements live in a std::vector so appending is amortized O(1)
+        std::shared_ptr<list_expression> list_expr = get_writable_list(arguments[0], "append");
+        list_expr -> add_element(arguments[1]);
+
+        // DONE.
+        return nullptr;
+    }
+
+    /**
+     * list_pop
+     * removes the last element of the referenced list and returns it wrapped in a maybe
+     */
+    std::shared_ptr<expr> list_pop(std::vector<std::shared_ptr<expr> >& arguments) {
+        // make sure we got only one argument
+        if(arguments.size() != 1)
+            throw invalid_call("[compiler error] the list <pop> function expects only one argument.");
+
+        std::shared_ptr<list_expression> list_expr = get_writable_list(arguments[0], "pop");
+        std::vector<std::shared_ptr<expr> >& elements = list_expr -> get_elements();
+
+        // the maybe type instance is built from the list element type instance
+        static avalon_maybe avl_maybe;
+        type_instance& list_instance = list_expr -> get_type_instance();
+        type_instance maybe_instance = list_instance.get_params().size() == 1 ? avl_maybe.get_type_instance(list_instance.get_params()[0]) : avl_maybe.get_type_instance();
+
+        // an empty list gives None
+        if(elements.empty()) {
+            std::shared_ptr<identifier_expression> none_expr = std::make_shared<identifier_expression>(none_cons_tok);
+            none_expr -> set_expression_type(CONSTRUCTOR_EXPR);
+            none_expr -> set_type_instance(maybe_instance);
+            std::shared_ptr<expr> final_expr = none_expr;
+            return final_expr;
+        }
+
+        // otherwise we remove the last element and return it
+        std::shared_ptr<expr> last_expr = elements.back();
+        elements.pop_back();
+        std::shared_ptr<call_expression> just_expr = std::make_shared<call_expression>(just_cons_tok);
+        just_expr -> add_argument(star_tok, last_expr);
+        just_expr -> set_expression_type(DEFAULT_CONSTRUCTOR_EXPR);
+        just_expr -> set_type_instance(maybe_instance);
+        std::shared_ptr<expr> final_expr = just_expr;
+        return final_expr;
+    }
+
+    /**
+     * list_set
+     * replaces the element found at the given index in the referenced list, returns false if the index is out of bounds
+     */
+    std::shared_ptr<expr> list_set(std::vector<std::shared_ptr<expr> >& arguments) {
+        // make sure we got only three arguments
+        if(arguments.size() != 3)
+            throw invalid_call("[compiler error] the list <set> function expects only three arguments.");
+
+        // we get the index first so we don't copy a shared list for nothing
+        long long int index = get_index(arguments[1], "set");
+        if(index < 0)
+            return bool_value(false);
+
+        std::shared_ptr<list_expression> list_expr = get_writable_list(arguments[0], "set");
+        std::vector<std::shared_ptr<expr> >& elements = list_expr -> get_elements();
+        if((std::size_t) index >= elements.size())
+            return bool_value(false);
+
+        elements[(std::size_t) index] = arguments[2];
+        return bool_value(true);
+    }
+
+    /**
+     * list_reserve
+     * makes sure the referenced list can hold the given number of elements without reallocating
+     */
+    std::shared_ptr<expr> list_reserve(std::vector<std::shared_ptr<expr> >& arguments) {
+        // make sure we got only two arguments
+        if(arguments.size() != 2)
+            throw invalid_call("[compiler error] the list <reserve> function expects only two arguments.");
+
+        long long int capacity = get_index(arguments[1], "reserve");
+        std::shared_ptr<list_expression> list_expr = get_writable_list(arguments[0], "reserve");
+        if(capacity > 0)
+            list_expr -> get_elements().reserve((std::size_t) capacity);
+
+        // DONE.
+        return nullptr;
+    }
+
+    /**
+     * list_len
+     * returns the number of elements in a list
+     */
+    std::shared_ptr<expr> list_len(std::vector<std::shared_ptr<expr> >& arguments) {
+        // int type
+        static avalon_int avl_int;
+        type_instance int_instance = avl_int.get_type_instance();
+
+        // make sure we got only one argument
+        if(arguments.size() != 1)
+            throw invalid_call("[compiler error] the list <len> function expects only one argument.");
+
+        std::shared_ptr<list_expression> list_expr = get_list(arguments[0], "len");
+        std::string res_str = std::to_string(list_expr -> get_length());
+
+        // create new literal with the length
+        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(builtin_token(INTEGER), INTEGER_EXPR, res_str);
+        res_lit -> set_type_instance(int_instance);
+        return res_lit;
+    }
+
+    /**
+     * list_slice
+     * returns a new list made of the elements found between the start (inclusive) and stop (exclusive) indices
+     * both indices are clamped to the bounds of the list
+     */
+    std::shared_ptr<expr> list_slice(std::vector<std::shared_ptr<expr> >& arguments) {
+        // make sure we got only three arguments
+        if(arguments.size() != 3)
+            throw invalid_call("[compiler error] the list <slice> function expects only three arguments.");
+
+        std::shared_ptr<list_expression> list_expr = get_list(arguments[0], "slice");
+        std::vector<std::shared_ptr<expr> >& elements = list_expr -> get_elements();
+        long long int length = (long long int) elements.size();
+        long long int start = get_index(arguments[1], "slice");
+        long long int stop = get_index(arguments[2], "slice");
+        start = start < 0 ? 0 : (start > length ? length : start);
+        stop = stop < start ? start : (stop > length ? length : stop);
+
+        // the new list shares the elements with the old one as elements are never modified in place
+        token list_tok = list_expr -> get_token();
+        std::shared_ptr<list_expression> new_list_expr = std::make_shared<list_expression>(list_tok);
+        new_list_expr -> set_type_instance(list_expr -> get_type_instance());
+        new_list_expr -> get_elements().assign(elements.begin() + start, elements.begin() + stop);
+
+        std::shared_ptr<expr> final_expr = new_list_expr;
+        return final_expr;
+    }
+}
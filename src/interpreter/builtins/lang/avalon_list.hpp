@@ -0,0 +1,72 @@
+/*
+ *  This file is part of the Avalon programming language
+ * 
+ *  Copyright (c) 2018 Ntwali Bashige Toussaint
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+#ifndef AVALON_INTERPRETER_BUILTINS_LANG_LIST_HPP_
+#define AVALON_INTERPRETER_BUILTINS_LANG_LIST_HPP_
+
+#include <memory>
+#include <vector>
+
+/* AST */
+#include "representer/ast/expr/expr.hpp"
+
+
+namespace avalon {
+    /**
+     * list_append
+     * appends an element at the end of the referenced list
+     */
+    std::shared_ptr<expr> list_append(std::vector<std::shared_ptr<expr> >& arguments);
+
+    /**
+     * list_pop
+     * removes the last element of the referenced list and returns it wrapped in a maybe
+     */
+    std::shared_ptr<expr> list_pop(std::vector<std::shared_ptr<expr> >& arguments);
+
+    /**
+     * list_set
+     * replaces the element found at the given index in the referenced list, returns false if the index is out of bounds
+     */
+    std::shared_ptr<expr> list_set(std::vector<std::shared_ptr<expr> >& arguments);
+
+    /**
+     * list_reserve
+     * makes sure the referenced list can hold the given number of elements without reallocating
+     */
+    std::shared_ptr<expr> list_reserve(std::vector<std::shared_ptr<expr> >& arguments);
+
+    /**
+     * list_len
+     * returns the number of elements in a list
+     */
+    std::shared_ptr<expr> list_len(std::vector<std::shared_ptr<expr> >& arguments);
+
+    /**
+     * list_slice
+     * returns a new list made of the elements found between the start (inclusive) and stop (exclusive) indices
+     */
+    std::shared_ptr<expr> list_slice(std::vector<std::shared_ptr<expr> >& arguments);
+}
+
+#endif
@@ -56,6 +56,12 @@ namespace avalon {
      * performs logical not
      */
     std::shared_ptr<expr> avl_not(std::vector<std::shared_ptr<expr> >& arguments);
+
+    /**
+     * avl_popcount
+     * counts the bits set
+     */
+    std::shared_ptr<expr> avl_popcount(std::vector<std::shared_ptr<expr> >& arguments);
 }
 
 #endif
@@ -0,0 +1,447 @@
+/*
+ *  This file is part of the Avalon programming language
+ *
+ *  Copyright (c) 2018 Ntwali Bashige Toussaint
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include <functional>
+#include <cstddef>
+#include <utility>
+#include <memory>
+#include <vector>
+#include <string>
+
+/* Lexer */
+#include "lexer/token_type.hpp"
+#include "lexer/token.hpp"
+
+/* AST */
+/* Declarations */
+#include "representer/ast/decl/function.hpp"
+#include "representer/ast/decl/variable.hpp"
+#include "representer/ast/decl/type.hpp"
+/* Expressions */
+#include "representer/ast/expr/identifier_expression.hpp"
+#include "representer/ast/expr/reference_expression.hpp"
+#include "representer/ast/expr/literal_expression.hpp"
+#include "representer/ast/expr/tuple_expression.hpp"
+#include "representer/ast/expr/call_expression.hpp"
+#include "representer/ast/expr/list_expression.hpp"
+#include "representer/ast/expr/map_expression.hpp"
+#include "representer/ast/expr/expr.hpp"
+
+/* Builtins */
+#include "representer/builtins/lang/avalon_list.hpp"
+#include "representer/builtins/lang/avalon_int.hpp"
+
+/* Builtin functions */
+#include "interpreter/builtins/lang/avalon_bool.hpp"
+#include "interpreter/builtins/lang/avalon_map.hpp"
+
+/* Exceptions */
+#include "interpreter/exceptions/invalid_call.hpp"
+
+
+namespace avalon {
+/**
+ * get_map
+ * returns the map expression held by the given argument, making sure it is indeed a map
+ */
+static std::shared_ptr<map_expression> get_map(std::shared_ptr<expr>& arg, const std::string& fun_name) {
+    if(arg -> is_map_expression() == false)
+        throw invalid_call("[compiler error] the map <" + fun_name + "> function expects its first argument to be a map.");
+
+    return std::static_pointer_cast<map_expression>(arg);
+}
+
+/**
+ * get_writable_map
+ * given a reference to a map variable, returns the map held by that variable so it can be modified in place.
+ * like lists, maps are shared between variables when they are copied so we copy the map first if anyone else holds it.
+ */
+static std::shared_ptr<map_expression> get_writable_map(std::shared_ptr<expr>& arg, const std::string& fun_name) {
+    if(arg -> is_reference_expression() == false)
+        throw invalid_call("[compiler error] the map <" + fun_name + "> function expects its first argument to be a reference to a map.");
+
+    std::shared_ptr<reference_expression> const & ref_expr = std::static_pointer_cast<reference_expression>(arg);
+    if(ref_expr -> get_expression_type() != REF_VAR_EXPR || ref_expr -> get_variable() == nullptr)
+        throw invalid_call("[compiler error] the map <" + fun_name + "> function expects its first argument to be a reference to a map variable.");
+
+    std::shared_ptr<variable>& ref_var = ref_expr -> get_variable();
+    std::shared_ptr<expr>& var_expr = ref_var -> get_value();
+    if(var_expr == nullptr || var_expr -> is_map_expression() == false)
+        throw invalid_call("[compiler error] the map <" + fun_name + "> function expects its first argument to be a reference to a map.");
+
+    // the variable is the only holder of the map, we can modify it directly
+    if(var_expr.use_count() == 1)
+        return std::static_pointer_cast<map_expression>(var_expr);
+
+    // someone else holds the map, the copy constructor copies the elements along with the hash index
+    std::shared_ptr<map_expression> const & shared_map = std::static_pointer_cast<map_expression>(var_expr);
+    std::shared_ptr<map_expression> own_map = std::make_shared<map_expression>(shared_map);
+    std::shared_ptr<expr> own_expr = own_map;
+    ref_var -> set_value(own_expr);
+    return own_map;
+}
+
+/**
+ * native_hash
+ * hashes keys of builtin types
+ */
+static std::size_t native_hash(std::shared_ptr<expr>& key) {
+    if(key -> is_literal_expression()) {
+        std::shared_ptr<literal_expression> const & key_lit = std::static_pointer_cast<literal_expression>(key);
+        switch(key_lit -> get_expression_type()) {
+            case INTEGER_EXPR:
+                return std::hash<long long int>()(key_lit -> get_int_value());
+
+            case FLOATING_POINT_EXPR:
+            {
+                // 0.0 and -0.0 compare equal so they must hash the same
+                double value = key_lit -> get_float_value();
+                return std::hash<double>()(value == 0.0 ? 0.0 : value);
+            }
+
+            case STRING_EXPR:
+                return key_lit -> get_shared_string_value().hash();
+
+            case BIT_EXPR:
+                return key_lit -> get_bits_value().hash();
+
+            default:
+                break;
+        }
+    }
+    // booleans are the True and False constructors
+    else if(key -> is_identifier_expression()) {
+        std::shared_ptr<identifier_expression> const & key_id = std::static_pointer_cast<identifier_expression>(key);
+        return std::hash<std::string>()(key_id -> get_name());
+    }
+
+    throw invalid_call("[compiler error] map keys must be of builtin types or have a __hash__ function.");
+}
+
+/**
+ * native_equal
+ * compares keys of builtin types
+ */
+static bool native_equal(std::shared_ptr<expr>& key, std::shared_ptr<expr>& other) {
+    if(key -> is_literal_expression() && other -> is_literal_expression()) {
+        std::shared_ptr<literal_expression> const & key_lit = std::static_pointer_cast<literal_expression>(key);
+        std::shared_ptr<literal_expression> const & other_lit = std::static_pointer_cast<literal_expression>(other);
+        if(key_lit -> get_expression_type() != other_lit -> get_expression_type())
+            return false;
+
+        switch(key_lit -> get_expression_type()) {
+            case INTEGER_EXPR:
+                return key_lit -> get_int_value() == other_lit -> get_int_value();
+
+            case FLOATING_POINT_EXPR:
+                return key_lit -> get_float_value() == other_lit -> get_float_value();
+
+            case STRING_EXPR:
+                return key_lit -> get_shared_string_value().compare(other_lit -> get_shared_string_value()) == 0;
+
+            case BIT_EXPR:
+                return key_lit -> get_bits_value() == other_lit -> get_bits_value();
+
+            default:
+                return false;
+        }
+    }
+    else if(key -> is_identifier_expression() && other -> is_identifier_expression()) {
+        std::shared_ptr<identifier_expression> const & key_id = std::static_pointer_cast<identifier_expression>(key);
+        std::shared_ptr<identifier_expression> const & other_id = std::static_pointer_cast<identifier_expression>(other);
+        return key_id -> get_name() == other_id -> get_name();
+    }
+
+    return false;
+}
+
+/**
+ * structural_equal
+ * compares keys of custom types that have no __eq__ function
+ * two keys are equal if they were built by the same constructor from equal values
+ */
+static bool structural_equal(std::shared_ptr<expr>& key, std::shared_ptr<expr>& other) {
+    if(key -> is_call_expression() && other -> is_call_expression()) {
+        std::shared_ptr<call_expression> const & key_call = std::static_pointer_cast<call_expression>(key);
+        std::shared_ptr<call_expression> const & other_call = std::static_pointer_cast<call_expression>(other);
+        std::vector<std::pair<token, std::shared_ptr<expr> > >& key_args = key_call -> get_arguments();
+        std::vector<std::pair<token, std::shared_ptr<expr> > >& other_args = other_call -> get_arguments();
+        if(key_call -> get_name() != other_call -> get_name() || key_args.size() != other_args.size())
+            return false;
+
+        for(std::size_t i = 0; i < key_args.size(); i++) {
+            if(structural_equal(key_args[i].second, other_args[i].second) == false)
+                return false;
+        }
+        return true;
+    }
+    else if(key -> is_tuple_expression() && other -> is_tuple_expression()) {
+        std::vector<std::pair<std::string, std::shared_ptr<expr> > >& key_elements = std::static_pointer_cast<tuple_expression>(key) -> get_elements();
+        std::vector<std::pair<std::string, std::shared_ptr<expr> > >& other_elements = std::static_pointer_cast<tuple_expression>(other) -> get_elements();
+        if(key_elements.size() != other_elements.size())
+            return false;
+
+        for(std::size_t i = 0; i < key_elements.size(); i++) {
+            if(structural_equal(key_elements[i].second, other_elements[i].second) == false)
+                return false;
+        }
+        return true;
+    }
+    else if(key -> is_list_expression() && other -> is_list_expression()) {
+        std::vector<std::shared_ptr<expr> >& key_elements = std::static_pointer_cast<list_expression>(key) -> get_elements();
+        std::vector<std::shared_ptr<expr> >& other_elements = std::static_pointer_cast<list_expression>(other) -> get_elements();
+        if(key_elements.size() != other_elements.size())
+            return false;
+
+        for(std::size_t i = 0; i < key_elements.size(); i++) {
+            if(structural_equal(key_elements[i], other_elements[i]) == false)
+                return false;
+        }
+        return true;
+    }
+    else if((key -> is_literal_expression() && other -> is_literal_expression()) || (key -> is_identifier_expression() && other -> is_identifier_expression())) {
+        return native_equal(key, other);
+    }
+
+    return false;
+}
+
+/**
+ * key_hash
+ * hashes the key with the map user defined __hash__ function if it has one, natively otherwise
+ */
+static std::size_t key_hash(map_hasher& hasher, std::shared_ptr<map_expression> const & map_expr, std::shared_ptr<expr>& key) {
+    std::shared_ptr<function>& hash_function = map_expr -> get_hash_function();
+    if(hash_function == nullptr)
+        return native_hash(key);
+    else
+        return hasher.hash_key(hash_function, key);
+}
+
+/**
+ * ensure_index
+ * builds the hash index of the map if it doesn't have one yet
+ * maps built from literals don't have an index until they are first searched
+ */
+static void ensure_index(map_hasher& hasher, std::shared_ptr<map_expression> const & map_expr) {
+    if(map_expr -> is_indexed())
+        return;
+
+    std::vector<std::pair<std::shared_ptr<expr>, std::shared_ptr<expr> > >& elements = map_expr -> get_elements();
+    std::vector<std::size_t> hashes;
+    hashes.reserve(elements.size());
+    for(auto& element : elements)
+        hashes.push_back(key_hash(hasher, map_expr, element.first));
+    map_expr -> build_index(hashes);
+}
+
+/**
+ * find_key
+ * returns the position of the element with the given key (whose hash is given) inside the map, npos if the key is not in the map
+ */
+static std::size_t find_key(map_hasher& hasher, std::shared_ptr<map_expression> const & map_expr, std::shared_ptr<expr>& key, std::size_t hash) {
+    // keys of builtin types are compared by value
+    if(map_expr -> get_hash_function() == nullptr)
+        return map_expr -> find_element(hash, [&key](std::shared_ptr<expr>& other) { return native_equal(key, other); });
+
+    // keys of custom types are compared with their __eq__ function, they are compared by structure if they have none
+    std::shared_ptr<function>& comp_function = map_expr -> get_comparator_function();
+    if(comp_function == nullptr)
+        return map_expr -> find_element(hash, [&key](std::shared_ptr<expr>& other) { return structural_equal(key, other); });
+    else
+        return map_expr -> find_element(hash, [&hasher, &comp_function, &key](std::shared_ptr<expr>& other) { return hasher.compare_keys(comp_function, key, other); });
+}
+
+/**
+ * make_int
+ * creates an integer literal with the given value
+ */
+static std::shared_ptr<expr> make_int(std::size_t value) {
+    // int type
+    static avalon_int avl_int;
+    type_instance int_instance = avl_int.get_type_instance();
+
+    std::string res_str = std::to_string(value);
+    std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(builtin_token(INTEGER), INTEGER_EXPR, res_str);
+    res_lit -> set_type_instance(int_instance);
+    return res_lit;
+}
+
+    /**
+     * map_find
+     * returns the position of the element with the given key inside the map, npos if the key is not in the map
+     */
+    std::size_t map_find(map_hasher& hasher, std::shared_ptr<map_expression> const & map_expr, std::shared_ptr<expr>& key) {
+        if(map_expr -> get_length() == 0)
+            return map_expression::npos;
+
+        ensure_index(hasher, map_expr);
+        return find_key(hasher, map_expr, key, key_hash(hasher, map_expr, key));
+    }
+
+    /**
+     * map_insert
+     * adds a key/value pair to the referenced map, replacing the value if the key is already present
+     * returns true if the key was not in the map before
+     */
+    std::shared_ptr<expr> map_insert(map_hasher& hasher, std::vector<std::shared_ptr<expr> >& arguments) {
+        // make sure we got only three arguments
+        if(arguments.size() != 3)
+            throw invalid_call("[compiler error] the map <insert> function expects only three arguments.");
+
+        std::shared_ptr<map_expression> map_expr = get_writable_map(arguments[0], "insert");
+        ensure_index(hasher, map_expr);
+
+        // the key is hashed once, both for the search and the insertion
+        std::size_t hash = key_hash(hasher, map_expr, arguments[1]);
+        std::size_t position = find_key(hasher, map_expr, arguments[1], hash);
+        if(position != map_expression::npos) {
+            map_expr -> get_elements()[position].second = arguments[2];
+            return bool_value(false);
+        }
+
+        map_expr -> insert_element(arguments[1], arguments[2], hash);
+        return bool_value(true);
+    }
+
+    /**
+     * map_update
+     * replaces the value of a key already present in the referenced map, returns false if the key is not in the map
+     */
+    std::shared_ptr<expr> map_update(map_hasher& hasher, std::vector<std::shared_ptr<expr> >& arguments) {
+        // make sure we got only three arguments
+        if(arguments.size() != 3)
+            throw invalid_call("[compiler error] the map <update> function expects only three arguments.");
+
+        std::shared_ptr<map_expression> map_expr = get_writable_map(arguments[0], "update");
+        std::size_t position = map_find(hasher, map_expr, arguments[1]);
+        if(position == map_expression::npos)
+            return bool_value(false);
+
+        map_expr -> get_elements()[position].second = arguments[2];
+        return bool_value(true);
+    }
+
+    /**
+     * map_remove
+     * removes a key and its value from the referenced map, returns false if the key is not in the map
+     */
+    std::shared_ptr<expr> map_remove(map_hasher& hasher, std::vector<std::shared_ptr<expr> >& arguments) {
+        // make sure we got only two arguments
+        if(arguments.size() != 2)
+            throw invalid_call("[compiler error] the map <remove> function expects only two arguments.");
+
+        std::shared_ptr<map_expression> map_expr = get_writable_map(arguments[0], "remove");
+        std::size_t position = map_find(hasher, map_expr, arguments[1]);
+        if(position == map_expression::npos)
+            return bool_value(false);
+
+        map_expr -> remove_element(position);
+        return bool_value(true);
+    }
+
+    /**
+     * map_contains
+     * returns true if the key is in the map
+     */
+    std::shared_ptr<expr> map_contains(map_hasher& hasher, std::vector<std::shared_ptr<expr> >& arguments) {
+        // make sure we got only two arguments
+        if(arguments.size() != 2)
+            throw invalid_call("[compiler error] the map <contains> function expects only two arguments.");
+
+        std::shared_ptr<map_expression> map_expr = get_map(arguments[0], "contains");
+        return bool_value(map_find(hasher, map_expr, arguments[1]) != map_expression::npos);
+    }
+
+    /**
+     * map_len
+     * returns the number of key/value pairs in a map
+     */
+    std::shared_ptr<expr> map_len(std::vector<std::shared_ptr<expr> >& arguments) {
+        // make sure we got only one argument
+        if(arguments.size() != 1)
+            throw invalid_call("[compiler error] the map <len> function expects only one argument.");
+
+        std::shared_ptr<map_expression> map_expr = get_map(arguments[0], "len");
+        return make_int(map_expr -> get_length());
+    }
+
+    /**
+     * map_keys
+     * returns the list of keys in a map
+     */
+    std::shared_ptr<expr> map_keys(std::vector<std::shared_ptr<expr> >& arguments) {
+        // make sure we got only one argument
+        if(arguments.size() != 1)
+            throw invalid_call("[compiler error] the map <keys> function expects only one argument.");
+
+        std::shared_ptr<map_expression> map_expr = get_map(arguments[0], "keys");
+        std::vector<std::pair<std::shared_ptr<expr>, std::shared_ptr<expr> > >& elements = map_expr -> get_elements();
+
+        // the list of keys type instance
+        type_instance element_instance = map_expr -> get_type_instance().get_params()[0];
+        avalon_list avl_list(element_instance);
+        type_instance list_instance = avl_list.get_type_instance();
+        token list_tok = map_expr -> get_token();
+        std::shared_ptr<list_expression> list_expr = std::make_shared<list_expression>(list_tok);
+        list_expr -> set_type_instance(list_instance);
+
+        std::vector<std::shared_ptr<expr> >& keys = list_expr -> get_elements();
+        keys.reserve(elements.size());
+        for(auto& element : elements)
+            keys.push_back(element.first);
+
+        std::shared_ptr<expr> final_expr = list_expr;
+        return final_expr;
+    }
+
+    /**
+     * map_values
+     * returns the list of values in a map, in the same order as the keys returned by map_keys
+     */
+    std::shared_ptr<expr> map_values(std::vector<std::shared_ptr<expr> >& arguments) {
+        // make sure we got only one argument
+        if(arguments.size() != 1)
+            throw invalid_call("[compiler error] the map <values> function expects only one argument.");
+
+        std::shared_ptr<map_expression> map_expr = get_map(arguments[0], "values");
+        std::vector<std::pair<std::shared_ptr<expr>, std::shared_ptr<expr> > >& elements = map_expr -> get_elements();
+
+        // the list of values type instance
+        type_instance element_instance = map_expr -> get_type_instance().get_params()[1];
+        avalon_list avl_list(element_instance);
+        type_instance list_instance = avl_list.get_type_instance();
+        token list_tok = map_expr -> get_token();
+        std::shared_ptr<list_expression> list_expr = std::make_shared<list_expression>(list_tok);
+        list_expr -> set_type_instance(list_instance);
+
+        std::vector<std::shared_ptr<expr> >& values = list_expr -> get_elements();
+        values.reserve(elements.size());
+        for(auto& element : elements)
+            values.push_back(element.second);
+
+        std::shared_ptr<expr> final_expr = list_expr;
+        return final_expr;
+    }
+}
@@ -0,0 +1,111 @@
+/*
+ *  This file is part of the Avalon programming language
+ *
+ *  Copyright (c) 2018 Ntwali Bashige Toussaint
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+#ifndef AVALON_INTERPRETER_BUILTINS_LANG_MAP_HPP_
+#define AVALON_INTERPRETER_BUILTINS_LANG_MAP_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/* AST */
+#include "representer/ast/expr/map_expression.hpp"
+#include "representer/ast/decl/function.hpp"
+#include "representer/ast/expr/expr.hpp"
+
+
+namespace avalon {
+    /**
+     * map_hasher
+     * hashes and compares keys of custom types by calling their user defined __hash__ and __eq__ functions
+     * keys of builtin types (bool, int, float, string and bits) are hashed and compared natively
+     */
+    class map_hasher {
+    public:
+        virtual ~map_hasher() {
+        }
+
+        /**
+         * hash_key
+         * calls the given hash function on the key and returns the integer it produced
+         */
+        virtual std::size_t hash_key(std::shared_ptr<function>& hash_function, std::shared_ptr<expr>& key) = 0;
+
+        /**
+         * compare_keys
+         * calls the given comparator function on both keys and returns true if they are the same key
+         */
+        virtual bool compare_keys(std::shared_ptr<function>& comp_function, std::shared_ptr<expr>& key, std::shared_ptr<expr>& other) = 0;
+    };
+
+    /**
+     * map_find
+     * returns the position of the element with the given key inside the map, npos if the key is not in the map
+     */
+    std::size_t map_find(map_hasher& hasher, std::shared_ptr<map_expression> const & map_expr, std::shared_ptr<expr>& key);
+
+    /**
+     * map_insert
+     * adds a key/value pair to the referenced map, replacing the value if the key is already present
+     * returns true if the key was not in the map before
+     */
+    std::shared_ptr<expr> map_insert(map_hasher& hasher, std::vector<std::shared_ptr<expr> >& arguments);
+
+    /**
+     * map_update
+     * replaces the value of a key already present in the referenced map, returns false if the key is not in the map
+     */
+    std::shared_ptr<expr> map_update(map_hasher& hasher, std::vector<std::shared_ptr<expr> >& arguments);
+
+    /**
+     * map_remove
+     * removes a key and its value from the referenced map, returns false if the key is not in the map
+     */
+    std::shared_ptr<expr> map_remove(map_hasher& hasher, std::vector<std::shared_ptr<expr> >& arguments);
+
+    /**
+     * map_contains
+     * returns true if the key is in the map
+     */
+    std::shared_ptr<expr> map_contains(map_hasher& hasher, std::vector<std::shared_ptr<expr> >& arguments);
+
+    /**
+     * map_len
+     * returns the number of key/value pairs in a map
+     */
+    std::shared_ptr<expr> map_len(std::vector<std::shared_ptr<expr> >& arguments);
+
+    /**
+     * map_keys
+     * returns the list of keys in a map
+     */
+    std::shared_ptr<expr> map_keys(std::vector<std::shared_ptr<expr> >& arguments);
+
+    /**
+     * map_values
+     * returns the list of values in a map, in the same order as the keys returned by map_keys
+     */
+    std::shared_ptr<expr> map_values(std::vector<std::shared_ptr<expr> >& arguments);
+}
+
+#endif
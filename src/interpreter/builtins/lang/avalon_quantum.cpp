@@ -25,6 +25,7 @@
 
 #include <memory>
 #include <vector>
+#include <string>
 
 /* Lexer */
 #include "lexer/token_type.hpp"
@@ -41,6 +42,7 @@
 #include "representer/ast/expr/expr.hpp"
 
 /* Builtins */
+#include "representer/builtins/lang/avalon_string.hpp"
 #include "representer/builtins/lang/avalon_qubit.hpp"
 #include "representer/builtins/lang/avalon_cgate.hpp"
 #include "representer/builtins/lang/avalon_gate.hpp"
@@ -64,15 +66,15 @@ namespace avalon {
      */
     std::shared_ptr<expr> avl_apply(std::shared_ptr<qprocessor>& qproc, std::vector<std::shared_ptr<expr> >& arguments) {
         // qubit type
-        avalon_qubit avl_qubit;
+        static avalon_qubit avl_qubit;
         type_instance qubit_instance = avl_qubit.get_type_instance();
 
         // gate type
-        avalon_gate avl_gate;
+        static avalon_gate avl_gate;
         type_instance gate_instance = avl_gate.get_type_instance();
 
         // cgate type
-        avalon_cgate avl_cgate;
+        static avalon_cgate avl_cgate;
         type_instance cgate_instance = avl_cgate.get_type_instance();
 
         // if we have two arguments, then we are dealing with the application of a qubit gate
@@ -96,7 +98,7 @@ namespace avalon {
                 
                 // start discriminating over the second argument
                 type_instance arg_two_instance_dref = arg_two_instance.get_params()[0];
-                if(type_instance_strong_compare(arg_two_instance_dref, qubit_instance)) {
+                if(qubit_width(arg_two_instance_dref) != 0) {
                     return qubit_apply(qproc, arguments);
                 }
                 else {
@@ -113,6 +115,10 @@ namespace avalon {
             std::shared_ptr<expr>& arg_two = arguments[1];
             std::shared_ptr<expr>& arg_three = arguments[2];
 
+            // if the controls come in a list, we are dealing with the application of a multi-controlled gate
+            if(arg_one -> is_call_expression() && arg_two -> is_list_expression() && arg_three -> is_reference_expression())
+                return qubit_mcapply(qproc, arguments);
+
             // we make sure that the first argument is a constructor expression and the second a reference expression
             if(arg_one -> is_call_expression() && arg_two -> is_reference_expression() && arg_three -> is_reference_expression()) {
                 std::shared_ptr<call_expression> const & arg_one_cons = std::static_pointer_cast<call_expression>(arg_one);
@@ -156,10 +162,6 @@ namespace avalon {
      * measures qubit(s) returning bits
      */
     std::shared_ptr<expr> avl_measure(std::shared_ptr<qprocessor>& qproc, std::vector<std::shared_ptr<expr> >& arguments) {
-        // qubit type
-        avalon_qubit avl_qubit;
-        type_instance qubit_instance = avl_qubit.get_type_instance();
-
         // make sure we were given only one argument
         if(arguments.size() != 1)
             throw invalid_call("[compiler error] the builtin <measure> function expects a single argument: a reference to the qubit to measure.");
@@ -170,7 +172,7 @@ namespace avalon {
             std::shared_ptr<reference_expression> const & arg_ref = std::static_pointer_cast<reference_expression>(arg);
             type_instance arg_instance = arg_ref -> get_type_instance();
             type_instance arg_instance_dref = arg_instance.get_params()[0];
-            if(type_instance_strong_compare(arg_instance_dref, qubit_instance)) {
+            if(qubit_width(arg_instance_dref) != 0) {
                 return qubit_measure(qproc, arguments);
             }
             else {
@@ -181,4 +183,23 @@ namespace avalon {
             throw invalid_call("[compiler error] the builtin <measure> function expects a reference to the qubit to measure.");
         }
     }
+
+    /**
+     * avl_qstats
+     * returns the quantum processor counters as a json string
+     */
+    std::shared_ptr<expr> avl_qstats(std::shared_ptr<qprocessor>& qproc, std::vector<std::shared_ptr<expr> >& arguments) {
+        // string type
+        static avalon_string avl_string;
+        type_instance string_instance = avl_string.get_type_instance();
+
+        // make sure we were given no argument
+        if(arguments.size() != 0)
+            throw invalid_call("[compiler error] the builtin <qstats> function expects no arguments.");
+
+        std::string res_str = qproc -> stats_to_json();
+        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(builtin_token(STRING), STRING_EXPR, res_str);
+        res_lit -> set_type_instance(string_instance);
+        return res_lit;
+    }
 }
@@ -47,6 +47,12 @@ namespace avalon {
      * measures qubit(s) returning bits
      */
     std::shared_ptr<expr> avl_measure(std::shared_ptr<qprocessor>& qproc, std::vector<std::shared_ptr<expr> >& arguments);
+
+    /**
+     * avl_qstats
+     * returns the quantum processor counters as a json string
+     */
+    std::shared_ptr<expr> avl_qstats(std::shared_ptr<qprocessor>& qproc, std::vector<std::shared_ptr<expr> >& arguments);
 }
 
 #endif
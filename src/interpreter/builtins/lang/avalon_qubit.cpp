@@ -23,12 +23,11 @@
  */
 
 
-#include <complex>
 #include <utility>
+#include <cstddef>
 #include <memory>
 #include <vector>
-#include <bitset>
-#include <cmath>
+#include <string>
 #include <tuple>
 
 #include <Eigen/Dense>
@@ -46,12 +45,19 @@
 #include "representer/ast/expr/reference_expression.hpp"
 #include "representer/ast/expr/literal_expression.hpp"
 #include "representer/ast/expr/call_expression.hpp"
+#include "representer/ast/expr/list_expression.hpp"
 #include "representer/ast/expr/expr.hpp"
 
 /* Builtins */
+#include "representer/builtins/lang/avalon_qubit8.hpp"
+#include "representer/builtins/lang/avalon_qubit4.hpp"
+#include "representer/builtins/lang/avalon_qubit2.hpp"
 #include "representer/builtins/lang/avalon_qubit.hpp"
 #include "representer/builtins/lang/avalon_cgate.hpp"
 #include "representer/builtins/lang/avalon_gate.hpp"
+#include "representer/builtins/lang/avalon_bit8.hpp"
+#include "representer/builtins/lang/avalon_bit4.hpp"
+#include "representer/builtins/lang/avalon_bit2.hpp"
 #include "representer/builtins/lang/avalon_bit.hpp"
 
 /* Builtin functions */
@@ -65,32 +71,26 @@
 
 
 namespace avalon {
-    static std::complex<double> get_00(double theta, double phi, double lambda) {
-        std::complex<double> i(0, 1);
-        std::complex<double> e = std::exp(i * ((-phi - lambda)/2));
-        double c = cos(theta / 2);
-        return e * c;
-    }
-
-    static std::complex<double> get_10(double theta, double phi, double lambda) {
-        std::complex<double> i(0, 1);
-        std::complex<double> e = std::exp(i * ((phi - lambda)/2));
-        double s = sin(theta / 2);
-        return e * s;
-    }
-
-    static std::complex<double> get_01(double theta, double phi, double lambda) {
-        std::complex<double> i(0, 1);
-        std::complex<double> e = -std::exp(i * ((-phi + lambda)/2));
-        double s = sin(theta / 2);
-        return e * s;
-    }
-
-    static std::complex<double> get_11(double theta, double phi, double lambda) {
-        std::complex<double> i(0, 1);
-        std::complex<double> e = std::exp(i * ((phi + lambda)/2));
-        double c = cos(theta / 2);
-        return e * c;
+    /**
+     * qubit_width
+     * returns the number of qubits held by variables of the given type instance or zero if it is not a qubits type instance
+     */
+    std::size_t qubit_width(type_instance& instance) {
+        static avalon_qubit avl_qubit;
+        static avalon_qubit2 avl_qubit2;
+        static avalon_qubit4 avl_qubit4;
+        static avalon_qubit8 avl_qubit8;
+
+        if(type_instance_strong_compare(instance, avl_qubit.get_type_instance()))
+            return 1;
+        else if(type_instance_strong_compare(instance, avl_qubit2.get_type_instance()))
+            return 2;
+        else if(type_instance_strong_compare(instance, avl_qubit4.get_type_instance()))
+            return 4;
+        else if(type_instance_strong_compare(instance, avl_qubit8.get_type_instance()))
+            return 8;
+        else
+            return 0;
     }
 
     /**
@@ -98,12 +98,8 @@ namespace avalon {
      * applies a quantum gate to the qubits stored at the given reference
      */
     std::shared_ptr<expr> qubit_apply(std::shared_ptr<qprocessor>& qproc, std::vector<std::shared_ptr<expr> >& arguments) {
-        // qubit type
-        avalon_qubit avl_qubit;
-        type_instance qubit_instance = avl_qubit.get_type_instance();
-
         // gate type
-        avalon_gate avl_gate;
+        static avalon_gate avl_gate;
         type_instance gate_instance = avl_gate.get_type_instance();
 
         // make sure we got only two arguments
@@ -129,31 +125,11 @@ namespace avalon {
 
         type_instance arg_two_instance = arg_two_ref -> get_type_instance();
         type_instance arg_two_instance_dref = arg_two_instance.get_params()[0];
-        if(type_instance_strong_compare(arg_two_instance_dref, qubit_instance) == false)
-            throw invalid_call("[compiler error] the quantum <apply> function expects the second argument to be a reference to a single <qubit> variable. Instead we got <" + mangle_type_instance(arg_two_instance_dref) + ">.");
-
-        // transform the gate definition into an Eigen matrix
-        // 1. first, we get the gate parameters and transform them into double values
-        std::vector<std::pair<token, std::shared_ptr<expr> > >& gate_args = arg_one_cons -> get_arguments();
-        // work on theta
-        std::shared_ptr<expr> theta_expr = gate_args[0].second;
-        std::shared_ptr<literal_expression> const & theta_lit = std::static_pointer_cast<literal_expression>(theta_expr);
-        double theta = theta_lit -> get_float_value();
-        // work on phi
-        std::shared_ptr<expr> phi_expr = gate_args[1].second;
-        std::shared_ptr<literal_expression> const & phi_lit = std::static_pointer_cast<literal_expression>(phi_expr);
-        double phi = phi_lit -> get_float_value();
-        // work on lambda
-        std::shared_ptr<expr> lambda_expr = gate_args[2].second;
-        std::shared_ptr<literal_expression> const & lambda_lit = std::static_pointer_cast<literal_expression>(lambda_expr);
-        double lambda = lambda_lit -> get_float_value();
-
-        // 2. we built the 2x2 Eigen matrix to be used as gate
-        Eigen::MatrixXcd unitary(2, 2);
-        unitary(0, 0) = get_00(theta, phi, lambda);
-        unitary(1, 0) = get_10(theta, phi, lambda);
-        unitary(0, 1) = get_01(theta, phi, lambda);
-        unitary(1, 1) = get_11(theta, phi, lambda);
+        if(qubit_width(arg_two_instance_dref) == 0)
+            throw invalid_call("[compiler error] the quantum <apply> function expects the second argument to be a reference to a <qubit>, <qubit2>, <qubit4> or <qubit8> variable. Instead we got <" + mangle_type_instance(arg_two_instance_dref) + ">.");
+
+        // get the unitary matrix of the gate, it is only computed the first time the gate is applied
+        const Eigen::Matrix2cd& unitary = avalon_gate::get_unitary(arg_one_cons);
 
         // we now apply the gate to the ket contained in the second argument
         // 1. get the content of the referenced variable
@@ -164,7 +140,7 @@ namespace avalon {
         if(qubit_expr -> was_measured())
             throw invalid_call("[compiler error] the quantum <apply> function second argument has already been measured and further gates cannot be applied to it.");
 
-        // 2. apply the gate to qubit
+        // 2. apply the gate to every qubit of the register in one pass
         qproc -> apply(unitary, qubit_expr -> get_start_index(), qubit_expr -> get_end_index());
 
         // DONE.
@@ -177,15 +153,15 @@ namespace avalon {
      */
     std::shared_ptr<expr> qubit_capply(std::shared_ptr<qprocessor>& qproc, std::vector<std::shared_ptr<expr> >& arguments) {
         // qubit type
-        avalon_qubit avl_qubit;
+        static avalon_qubit avl_qubit;
         type_instance qubit_instance = avl_qubit.get_type_instance();
 
         // gate type
-        avalon_gate avl_gate;
+        static avalon_gate avl_gate;
         type_instance gate_instance = avl_gate.get_type_instance();
 
         // cgate type
-        avalon_cgate avl_cgate;
+        static avalon_cgate avl_cgate;
         type_instance cgate_instance = avl_cgate.get_type_instance();
 
         // make sure we got only three arguments
@@ -227,32 +203,10 @@ namespace avalon {
         if(type_instance_strong_compare(arg_three_instance_dref, qubit_instance) == false)
             throw invalid_call("[compiler error] the quantum <apply> function for controlled gates expects the third argument to be a reference to a single <qubit> variable. Instead we got <" + mangle_type_instance(arg_three_instance_dref) + ">.");
 
-        // transform the gate definition into an Eigen matrix
-        // 0. We get the gate that parametrizes this controlled gate
+        // get the unitary matrix of the gate that parametrizes this controlled gate
         std::vector<std::pair<token, std::shared_ptr<expr> > >& cgate_args = arg_one_cons -> get_arguments();
         std::shared_ptr<call_expression> const & cgate_arg = std::static_pointer_cast<call_expression>(cgate_args[0].second);
-        // 1. first, we get the gate parameters and transform them into double values
-
-        std::vector<std::pair<token, std::shared_ptr<expr> > >& gate_args = cgate_arg -> get_arguments();
-        // work on theta
-        std::shared_ptr<expr> theta_expr = gate_args[0].second;
-        std::shared_ptr<literal_expression> const & theta_lit = std::static_pointer_cast<literal_expression>(theta_expr);
-        double theta = theta_lit -> get_float_value();
-        // work on phi
-        std::shared_ptr<expr> phi_expr = gate_args[1].second;
-        std::shared_ptr<literal_expression> const & phi_lit = std::static_pointer_cast<literal_expression>(phi_expr);
-        double phi = phi_lit -> get_float_value();
-        // work on lambda
-        std::shared_ptr<expr> lambda_expr = gate_args[2].second;
-        std::shared_ptr<literal_expression> const & lambda_lit = std::static_pointer_cast<literal_expression>(lambda_expr);
-        double lambda = lambda_lit -> get_float_value();
-
-        // 2. we built the 2x2 Eigen matrix to be used as control gate
-        Eigen::MatrixXcd unitary(2, 2);
-        unitary(0, 0) = get_00(theta, phi, lambda);
-        unitary(1, 0) = get_10(theta, phi, lambda);
-        unitary(0, 1) = get_01(theta, phi, lambda);
-        unitary(1, 1) = get_11(theta, phi, lambda);
+        const Eigen::Matrix2cd& unitary = avalon_gate::get_unitary(cgate_arg);
 
         // we now apply the gate to the ket contained in the second argument
         // 1. get the content of the first referenced variable (argument two)
@@ -279,17 +233,101 @@ namespace avalon {
     }
 
     /**
-     * qubit_measure
-     * performs a measure on the qubits stored at the given reference in the Z basis
+     * qubit_mcapply
+     * applies a controlled quantum gate to the qubit given as third argument using all the qubits in the list given in second argument as controls
      */
-    std::shared_ptr<expr> qubit_measure(std::shared_ptr<qprocessor>& qproc, std::vector<std::shared_ptr<expr> >& arguments) {
+    std::shared_ptr<expr> qubit_mcapply(std::shared_ptr<qprocessor>& qproc, std::vector<std::shared_ptr<expr> >& arguments) {
         // qubit type
-        avalon_qubit avl_qubit;
+        static avalon_qubit avl_qubit;
         type_instance qubit_instance = avl_qubit.get_type_instance();
 
-        // bit type
-        avalon_bit avl_bit;
-        type_instance bit_instance = avl_bit.get_type_instance();
+        // cgate type
+        static avalon_cgate avl_cgate;
+        type_instance cgate_instance = avl_cgate.get_type_instance();
+
+        // make sure we got only three arguments
+        if(arguments.size() != 3)
+            throw invalid_call("[compiler error] the quantum <apply> function for multi-controlled gates expects only three arguments.");
+
+        // make sure the first argument is a call expression, the second a list expression and the third a reference expression
+        std::shared_ptr<expr>& arg_one = arguments[0];
+        std::shared_ptr<expr>& arg_two = arguments[1];
+        std::shared_ptr<expr>& arg_three = arguments[2];
+        if(arg_one -> is_call_expression() == false)
+            throw invalid_call("[compiler error] the quantum <apply> function for multi-controlled gates expects the first argument to be a gate definition.");
+        if(arg_two -> is_list_expression() == false)
+            throw invalid_call("[compiler error] the quantum <apply> function for multi-controlled gates expects the second argument to be a list of references to quantum variables.");
+        if(arg_three -> is_reference_expression() == false)
+            throw invalid_call("[compiler error] the quantum <apply> function for multi-controlled gates expects the third argument to be a reference to a quantum variable.");
+
+        // we cast the arguments
+        std::shared_ptr<call_expression> const & arg_one_cons = std::static_pointer_cast<call_expression>(arg_one);
+        std::shared_ptr<list_expression> const & arg_two_list = std::static_pointer_cast<list_expression>(arg_two);
+        std::shared_ptr<reference_expression> const & arg_three_ref = std::static_pointer_cast<reference_expression>(arg_three);
+
+        // we double check the type instances
+        type_instance arg_one_instance = arg_one_cons -> get_type_instance();
+        if(type_instance_strong_compare(arg_one_instance, cgate_instance) == false)
+            throw invalid_call("[compiler error] the quantum <apply> function for multi-controlled gates expects the first argument to be a gate definition of type <cgate>.");
+
+        type_instance arg_three_instance = arg_three_ref -> get_type_instance();
+        if(arg_three_instance.is_reference() == false)
+            throw invalid_call("[compiler error] the quantum <apply> function for multi-controlled gates expects the third argument to be a reference to a single <qubit>.");
+        type_instance arg_three_instance_dref = arg_three_instance.get_params()[0];
+        if(type_instance_strong_compare(arg_three_instance_dref, qubit_instance) == false)
+            throw invalid_call("[compiler error] the quantum <apply> function for multi-controlled gates expects the third argument to be a reference to a single <qubit> variable. Instead we got <" + mangle_type_instance(arg_three_instance_dref) + ">.");
+
+        // get the unitary matrix of the gate that parametrizes this controlled gate
+        std::vector<std::pair<token, std::shared_ptr<expr> > >& cgate_args = arg_one_cons -> get_arguments();
+        std::shared_ptr<call_expression> const & cgate_arg = std::static_pointer_cast<call_expression>(cgate_args[0].second);
+        const Eigen::Matrix2cd& unitary = avalon_gate::get_unitary(cgate_arg);
+
+        // we collect the indices of the control qubits
+        std::vector<qpp::idx> control_indices;
+        std::vector<std::shared_ptr<expr> >& controls = arg_two_list -> get_elements();
+        if(controls.size() == 0)
+            throw invalid_call("The quantum <apply> function for multi-controlled gates expects at least one control qubit.");
+        for(auto& control : controls) {
+            if(control -> is_reference_expression() == false)
+                throw invalid_call("[compiler error] the quantum <apply> function for multi-controlled gates expects the second argument to be a list of references to quantum variables.");
+
+            std::shared_ptr<reference_expression> const & control_ref = std::static_pointer_cast<reference_expression>(control);
+            type_instance control_instance = control_ref -> get_type_instance();
+            if(control_instance.is_reference() == false || type_instance_strong_compare(control_instance.get_params()[0], qubit_instance) == false)
+                throw invalid_call("[compiler error] the quantum <apply> function for multi-controlled gates expects the controls to be references to single <qubit> variables.");
+
+            std::shared_ptr<variable>& control_var = control_ref -> get_variable();
+            std::shared_ptr<literal_expression> const & control_expr = std::static_pointer_cast<literal_expression>(control_var -> get_value());
+            if(control_expr -> was_measured())
+                throw invalid_call("[compiler error] the quantum <apply> function second argument contains a qubit that has already been measured and further gates cannot be applied to it.");
+            control_indices.push_back(control_expr -> get_start_index());
+        }
+
+        // get the content of the target referenced variable
+        std::shared_ptr<variable>& ref_var_three = arg_three_ref -> get_variable();
+        std::shared_ptr<expr>& var_expr_three = ref_var_three -> get_value();
+        std::shared_ptr<literal_expression> const & qubit_expr_three = std::static_pointer_cast<literal_expression>(var_expr_three);
+        // we make sure that the qubit was not measured already
+        if(qubit_expr_three -> was_measured())
+            throw invalid_call("[compiler error] the quantum <apply> function third argument has already been measured and further gates cannot be applied to it.");
+
+        // apply the controlled operation in a single pass over the amplitudes where all the controls are set
+        qproc -> capply(unitary, control_indices, qubit_expr_three -> get_end_index());
+
+        // DONE.
+        return nullptr;
+    }
+
+    /**
+     * qubit_measure
+     * performs a measure on the qubits stored at the given reference in the Z basis
+     */
+    std::shared_ptr<expr> qubit_measure(std::shared_ptr<qprocessor>& qproc, std::vector<std::shared_ptr<expr> >& arguments) {
+        // bit types
+        static avalon_bit avl_bit;
+        static avalon_bit2 avl_bit2;
+        static avalon_bit4 avl_bit4;
+        static avalon_bit8 avl_bit8;
 
         // make sure we got only one argument
         if(arguments.size() != 1)
@@ -306,8 +344,9 @@ namespace avalon {
         // we double check the type instance
         type_instance arg_instance = arg_ref -> get_type_instance();
         type_instance arg_instance_dref = arg_instance.get_params()[0];
-        if(type_instance_strong_compare(arg_instance_dref, qubit_instance) == false)
-            throw invalid_call("[compiler error] the quantum <measure> function expects the argument to be a reference to a single <qubit> variable.");
+        std::size_t width = qubit_width(arg_instance_dref);
+        if(width == 0)
+            throw invalid_call("[compiler error] the quantum <measure> function expects the argument to be a reference to a <qubit>, <qubit2>, <qubit4> or <qubit8> variable.");
 
         // get the qubit held inside the variable
         // 1. get the content of the referenced variable
@@ -322,18 +361,25 @@ namespace avalon {
 
         // 3. perform the measurement
         std::vector<qpp::idx> results = qproc -> measure(qubit_expr -> get_start_index(), qubit_expr -> get_end_index());
-        qpp::idx result = results[0];
 
         // 4. we set the qubit measurement result
         qubit_expr -> was_measured(true);
-        qpp::ket l_ket = result == 0 ? qpp::mket({0}) : qpp::mket({1});
+        qpp::ket l_ket = qpp::mket(results);
         qubit_expr -> set_qubit_value(l_ket);
 
-        // 5. Create a bit expression with the measurement result
-        std::string res_str = std::to_string(result);
-        token lit_tok(BITS, res_str, 0, 0, "__bil__");
-        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(lit_tok, BIT_EXPR, res_str);
-        res_lit -> set_type_instance(bit_instance);
+        // 5. Create a bit expression with the measurement result, the first qubit gives the first bit
+        std::string res_str;
+        for(qpp::idx result : results)
+            res_str += std::to_string(result);
+        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(builtin_token(BITS), BIT_EXPR, res_str);
+        if(width == 1)
+            res_lit -> set_type_instance(avl_bit.get_type_instance());
+        else if(width == 2)
+            res_lit -> set_type_instance(avl_bit2.get_type_instance());
+        else if(width == 4)
+            res_lit -> set_type_instance(avl_bit4.get_type_instance());
+        else
+            res_lit -> set_type_instance(avl_bit8.get_type_instance());
 
         return res_lit;
     }
@@ -344,7 +390,7 @@ namespace avalon {
      */
     std::shared_ptr<expr> qubit_cast(std::shared_ptr<qprocessor>& qproc, std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance) {
         // bit type
-        avalon_bit avl_bit;
+        static avalon_bit avl_bit;
         type_instance bit_instance = avl_bit.get_type_instance();
 
         if(type_instance_strong_compare(ret_instance, bit_instance)) {
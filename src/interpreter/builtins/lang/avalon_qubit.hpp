@@ -25,6 +25,7 @@
 #ifndef AVALON_INTERPRETER_BUILTINS_LANG_QUBIT_HPP_
 #define AVALON_INTERPRETER_BUILTINS_LANG_QUBIT_HPP_
 
+#include <cstddef>
 #include <memory>
 #include <vector>
 
@@ -37,6 +38,12 @@
 
 
 namespace avalon {
+    /**
+     * qubit_width
+     * returns the number of qubits held by variables of the given type instance or zero if it is not a qubits type instance
+     */
+    std::size_t qubit_width(type_instance& instance);
+
     /**
      * qubit_apply
      * applies a quantum gate to the qubits stored at the given reference
@@ -49,6 +56,12 @@ namespace avalon {
      */
     std::shared_ptr<expr> qubit_capply(std::shared_ptr<qprocessor>& qproc, std::vector<std::shared_ptr<expr> >& arguments);
 
+    /**
+     * qubit_mcapply
+     * applies a controlled quantum gate to the qubit given as third argument using all the qubits in the list given in second argument as controls
+     */
+    std::shared_ptr<expr> qubit_mcapply(std::shared_ptr<qprocessor>& qproc, std::vector<std::shared_ptr<expr> >& arguments);
+
     /**
      * qubit_measure
      * performs a measure on the qubits stored at the given reference in the Z basis
@@ -58,6 +58,9 @@
 /* Builtin functions */
 #include "interpreter/builtins/lang/avalon_string.hpp"
 
+/* Utilities */
+#include "utils/shared_string.hpp"
+
 /* Exceptions */
 #include "interpreter/exceptions/invalid_call.hpp"
 
@@ -69,7 +72,7 @@ namespace avalon {
      */
     std::shared_ptr<expr> string_reverse(std::vector<std::shared_ptr<expr> >& arguments) {
         // string type
-        avalon_string avl_string;
+        static avalon_string avl_string;
         type_instance string_instance = avl_string.get_type_instance();
 
         // make sure we got only one argument
@@ -89,14 +92,11 @@ namespace avalon {
         if(type_instance_strong_compare(arg_instance, string_instance) == false)
             throw invalid_call("[compiler error] the string __reverse__ function expects its argument to be an string.");
 
-        // reverse the value held inside the literal
-        std::string arg_val = arg_lit -> get_string_value();
-        std::string res_str = arg_val;
-        std::reverse(res_str.begin(), res_str.end());
+        // reverse the value held inside the literal, this only creates a view that reads the same buffer backwards
+        shared_string res_str = arg_lit -> get_shared_string_value().reversed();
 
         // create new literal with the new string
-        token lit_tok(STRING, res_str, 0, 0, "__bil__");
-        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(lit_tok, STRING_EXPR, res_str);
+        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(builtin_token(STRING), res_str);
         res_lit -> set_type_instance(string_instance);
 
         return res_lit;
@@ -108,7 +108,7 @@ namespace avalon {
      */
     std::shared_ptr<expr> string_concat(std::vector<std::shared_ptr<expr> >& arguments) {
         // string type
-        avalon_string avl_string;
+        static avalon_string avl_string;
         type_instance string_instance = avl_string.get_type_instance();
 
         // make sure we got only two arguments
@@ -137,14 +137,11 @@ namespace avalon {
         if(type_instance_strong_compare(arg_two_instance, string_instance) == false)
             throw invalid_call("[compiler error] the string __concat__ function expects its argument to be strings.");
 
-        // add both arguments
-        std::string arg_one_val = arg_one_lit -> get_string_value();
-        std::string arg_two_val = arg_two_lit -> get_string_value();
-        std::string res_str = arg_one_val + arg_two_val;
+        // add both arguments, appending to the buffer of the first one if nothing else was appended to it
+        shared_string res_str = shared_string::concat(arg_one_lit -> get_shared_string_value(), arg_two_lit -> get_shared_string_value());
 
         // create new literal with the new string
-        token lit_tok(STRING, res_str, 0, 0, "__bil__");
-        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(lit_tok, STRING_EXPR, res_str);
+        std::shared_ptr<literal_expression> res_lit = std::make_shared<literal_expression>(builtin_token(STRING), res_str);
         res_lit -> set_type_instance(string_instance);
 
         return res_lit;
@@ -156,11 +153,11 @@ namespace avalon {
      */
     std::shared_ptr<expr> string_hash(std::vector<std::shared_ptr<expr> >& arguments) {
         // string type
-        avalon_string avl_string;
+        static avalon_string avl_string;
         type_instance string_instance = avl_string.get_type_instance();
 
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
         // make sure we got only one argument
@@ -181,14 +178,11 @@ namespace avalon {
             throw invalid_call("[compiler error] the string __hash__ function expects its argument to be an string.");
 
         // computes the hash
-        std::string arg_val = arg_lit -> get_string_value();
-        std::hash<std::string> hasher;
-        std::size_t int_hash = hasher(arg_val);
+        std::size_t int_hash = arg_lit -> get_shared_string_value().hash();
         std::string string_hash = std::to_string(int_hash);
 
         // create new literal with the new string
-        token lit_tok(INTEGER, string_hash, 0, 0, "__bil__");
-        std::shared_ptr<literal_expression> hash_lit = std::make_shared<literal_expression>(lit_tok, INTEGER_EXPR, string_hash);
+        std::shared_ptr<literal_expression> hash_lit = std::make_shared<literal_expression>(builtin_token(INTEGER), INTEGER_EXPR, string_hash);
         hash_lit -> set_type_instance(int_instance);
 
         return hash_lit;
@@ -200,19 +194,19 @@ namespace avalon {
      */
     std::shared_ptr<expr> string_cast(std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance) {
         // bool type
-        avalon_bool avl_bool;
+        static avalon_bool avl_bool;
         type_instance bool_instance = avl_bool.get_type_instance();
         
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
         
         // float type
-        avalon_float avl_float;
+        static avalon_float avl_float;
         type_instance float_instance = avl_float.get_type_instance();
 
         // maybe type
-        avalon_maybe avl_maybe;
+        static avalon_maybe avl_maybe;
         type_instance maybe_bool_instance = avl_maybe.get_type_instance(bool_instance);
         type_instance maybe_int_instance = avl_maybe.get_type_instance(int_instance);
         type_instance maybe_float_instance = avl_maybe.get_type_instance(float_instance);
@@ -237,15 +231,15 @@ namespace avalon {
      */
     std::shared_ptr<expr> string_bool(std::vector<std::shared_ptr<expr> >& arguments) {
         // bool type
-        avalon_bool avl_bool;
+        static avalon_bool avl_bool;
         type_instance bool_instance = avl_bool.get_type_instance();
 
         // maybe type
-        avalon_maybe avl_maybe;
+        static avalon_maybe avl_maybe;
         type_instance maybe_bool_instance = avl_maybe.get_type_instance(bool_instance);
 
         // string type
-        avalon_string avl_string;
+        static avalon_string avl_string;
         type_instance string_instance = avl_string.get_type_instance();
 
         // prepare None expression
@@ -326,15 +320,15 @@ namespace avalon {
      */
     std::shared_ptr<expr> string_int(std::vector<std::shared_ptr<expr> >& arguments) {
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
         // maybe type
-        avalon_maybe avl_maybe;
+        static avalon_maybe avl_maybe;
         type_instance maybe_int_instance = avl_maybe.get_type_instance(int_instance);
 
         // string type
-        avalon_string avl_string;
+        static avalon_string avl_string;
         type_instance string_instance = avl_string.get_type_instance();
 
         // prepare None expression
@@ -411,15 +405,15 @@ namespace avalon {
      */
     std::shared_ptr<expr> string_float(std::vector<std::shared_ptr<expr> >& arguments) {
         // float type
-        avalon_float avl_float;
+        static avalon_float avl_float;
         type_instance float_instance = avl_float.get_type_instance();
 
         // maybe type
-        avalon_maybe avl_maybe;
+        static avalon_maybe avl_maybe;
         type_instance maybe_float_instance = avl_maybe.get_type_instance(float_instance);
 
         // string type
-        avalon_string avl_string;
+        static avalon_string avl_string;
         type_instance string_instance = avl_string.get_type_instance();
 
         // prepare None expression
@@ -499,11 +493,11 @@ namespace avalon {
      */
     std::shared_ptr<expr> string_refitem(std::vector<std::shared_ptr<expr> >& arguments) {
         // string type
-        avalon_string avl_string;
+        static avalon_string avl_string;
         type_instance string_instance = avl_string.get_type_instance();
 
         // int type
-        avalon_int avl_int;
+        static avalon_int avl_int;
         type_instance int_instance = avl_int.get_type_instance();
 
         // make sure we got exactly two arguments
@@ -541,12 +535,9 @@ namespace avalon {
 
         std::size_t index = (std::size_t) user_index;
 
-        // get the string
-        std::string user_string = arg_one_lit -> get_string_value();
-
         // if the user index is within the string length, we return a reference with the effective index where the substring was found
         std::shared_ptr<expr> final_expr = nullptr;
-        if(index < user_string.length()) {
+        if(index < arg_one_lit -> get_shared_string_value().length()) {
             // we create a dummy reference expression and set on it the most important information: the index where to find the substring
             token gen_tok(MUL, "*", 0, 0, "__dummy__");
             std::shared_ptr<reference_expression> ref_expr = std::make_shared<reference_expression>(gen_tok, nullptr);
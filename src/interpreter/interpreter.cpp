@@ -23,6 +23,9 @@
  */
 
 #include <stdexcept>
+#include <cstdint>
+#include <iostream>
+#include <unordered_map>
 #include <memory>
 #include <vector>
 #include <string>
@@ -40,10 +43,8 @@
 #include "representer/ast/decl/statement.hpp"
 #include "representer/ast/decl/function.hpp"
 #include "representer/ast/decl/variable.hpp"
-#include "representer/ast/decl/import.hpp"
 #include "representer/ast/decl/type.hpp"
 #include "representer/ast/decl/decl.hpp"
-#include "representer/ast/decl/ns.hpp"
 #include "representer/ast/program.hpp"
 /* Statements */
 #include "representer/ast/stmt/expression_stmt.hpp"
@@ -51,6 +52,7 @@
 #include "representer/ast/stmt/return_stmt.hpp"
 #include "representer/ast/stmt/block_stmt.hpp"
 #include "representer/ast/stmt/while_stmt.hpp"
+#include "representer/ast/stmt/for_stmt.hpp"
 #include "representer/ast/stmt/break_stmt.hpp"
 #include "representer/ast/stmt/pass_stmt.hpp"
 #include "representer/ast/stmt/if_stmt.hpp"
@@ -78,9 +80,6 @@
 #include "representer/builtins/lang/avalon_list.hpp"
 #include "representer/builtins/lang/avalon_bool.hpp"
 #include "representer/builtins/lang/avalon_void.hpp"
-#include "representer/builtins/lang/avalon_bit8.hpp"
-#include "representer/builtins/lang/avalon_bit4.hpp"
-#include "representer/builtins/lang/avalon_bit2.hpp"
 #include "representer/builtins/lang/avalon_bit.hpp"
 #include "representer/builtins/lang/avalon_ref.hpp"
 
@@ -96,14 +95,55 @@
 
 /* Builtin functions implementation */
 #include "interpreter/builtins/avalon_function.hpp"
+#include "interpreter/builtins/lang/avalon_bool.hpp"
+#include "interpreter/builtins/lang/avalon_map.hpp"
+#include "interpreter/builtins/io/avalon_io.hpp"
+
+/* Profiler */
+#include "interpreter/profiler.hpp"
+
+/* Tracer */
+#include "interpreter/tracer.hpp"
+
+/* Utilities */
+#include "utils/shared_string.hpp"
+#include "utils/bit_vector.hpp"
 
 /* Exceptions */
-#include "representer/exceptions/symbol_already_declared.hpp"
 #include "representer/exceptions/symbol_can_collide.hpp"
 #include "representer/exceptions/symbol_not_found.hpp"
 
 
 namespace avalon {
+/**
+ * argument_frame
+ * lends the argument vector reserved for the current call depth and hands it back, emptied, once the call is over.
+ * vectors keep their capacity so calls stop allocating argument storage after the first call at a given depth.
+ */
+class argument_frame {
+public:
+    argument_frame(std::deque<std::vector<std::shared_ptr<expr> > >& stack, std::size_t& depth) : m_depth(depth) {
+        // a deque never moves its elements when it grows so vectors lent to outer calls stay valid
+        if(stack.size() <= m_depth)
+            stack.emplace_back();
+        m_arguments = &stack[m_depth];
+        m_depth = m_depth + 1;
+    }
+
+    ~argument_frame() {
+        m_arguments -> clear();
+        m_depth = m_depth - 1;
+    }
+
+    std::vector<std::shared_ptr<expr> >& get_arguments() {
+        return * m_arguments;
+    }
+
+private:
+    std::vector<std::shared_ptr<expr> > * m_arguments;
+    std::size_t& m_depth;
+};
+
 /**
  * the contructor expects:
  * - the error handler to be used to show errors
@@ -134,8 +174,9 @@ interpret_error::interpret_error(error& error_handler, token tok, const std::str
  * - the global symbol table with programs to interpret
  * - the error handler to use in order to display errors
  */
-interpreter::interpreter(gtable& gtab, error& error_handler) : m_error_handler(error_handler), m_gtable(gtab), m_qproc(nullptr), m_continue_loop(false), m_break_loop(false) {
+interpreter::interpreter(gtable& gtab, error& error_handler) : m_error_handler(error_handler), m_gtable(gtab), m_qproc(nullptr), m_call_depth(0), m_continue_loop(false), m_break_loop(false) {
     m_qproc = std::make_shared<qprocessor>(m_error_handler);
+    m_builtins.reset(new avalon_function(m_qproc, * this));
 }
 
     /**
@@ -146,14 +187,53 @@ interpreter::interpreter(gtable& gtab, error& error_handler) : m_error_handler(e
         if(m_gtable.has_main_fqn() == false)
             throw interpretation_error(star_tok, "The main program could not be found.");
 
-        // import all of the main program dependencies
-        import_declarations();
-
         // get the main program
         program& main_prog = m_gtable.get_main_program();
 
+        // paths given to Io.resolve are relative to the main program
+        set_program_path(main_prog.get_fqn().get_path());
+
         // interpret the main program
-        interpret_program(main_prog, arguments);
+        // the report is also printed when interpretation fails since that is often when it is needed most
+        try {
+            interpret_program(main_prog, arguments);
+        } catch(...) {
+            if(qprocessor::is_stats_report_enabled())
+                m_qproc -> report_stats(std::cerr);
+            throw;
+        }
+
+        // report what the quantum processor did if asked to
+        if(qprocessor::is_stats_report_enabled())
+            m_qproc -> report_stats(std::cerr);
+    }
+
+    /**
+     * hash_key
+     * calls the given user defined __hash__ function on a map key and returns the integer it produced
+     */
+    std::size_t interpreter::hash_key(std::shared_ptr<function>& hash_function, std::shared_ptr<expr>& key) {
+        std::vector<std::shared_ptr<expr> > hash_arguments = { key };
+        std::shared_ptr<expr> hashed_key = interpret_function(hash_function, hash_arguments);
+        if(hashed_key == nullptr || hashed_key -> is_literal_expression() == false)
+            throw interpretation_error(hash_function -> get_token(), "The __hash__ function must return an integer.");
+
+        std::shared_ptr<literal_expression> const & hash_lit = std::static_pointer_cast<literal_expression>(hashed_key);
+        return static_cast<std::size_t>(hash_lit -> get_int_value());
+    }
+
+    /**
+     * compare_keys
+     * calls the given user defined __eq__ function on two map keys and returns the boolean it produced
+     */
+    bool interpreter::compare_keys(std::shared_ptr<function>& comp_function, std::shared_ptr<expr>& key, std::shared_ptr<expr>& other) {
+        std::vector<std::shared_ptr<expr> > comp_arguments = { key, other };
+        std::shared_ptr<expr> comp_result = interpret_function(comp_function, comp_arguments);
+        if(comp_result == nullptr || comp_result -> is_identifier_expression() == false)
+            throw interpretation_error(comp_function -> get_token(), "The __eq__ function must return a boolean.");
+
+        std::shared_ptr<identifier_expression> const & comp_id = std::static_pointer_cast<identifier_expression>(comp_result);
+        return comp_id -> get_token() == true_cons_tok;
     }
 
     /**
@@ -162,7 +242,7 @@ interpreter::interpreter(gtable& gtab, error& error_handler) : m_error_handler(e
      */
     void interpreter::interpret_program(program& main_prog, std::vector<std::string>& arguments) {
         // string type instance
-        avalon_string avl_string;
+        static avalon_string avl_string;
         type_instance string_instance = avl_string.get_type_instance();
         // list type instance
         avalon_list avl_list(string_instance);
@@ -183,8 +263,14 @@ interpreter::interpreter(gtable& gtab, error& error_handler) : m_error_handler(e
         // find the main function
         std::shared_ptr<scope>& l_scope = main_prog.get_scope();
         try {
-            std::shared_ptr<function>& main_fun = l_scope -> get_function("*", "__main__", 1);
-            interpret_function(main_fun, argv);
+            // the program scope holds the declaration of the main function, what we run is the specialization the checker made of it
+            // there is none if checking the main function failed
+            std::shared_ptr<function>& main_decl = l_scope -> get_function("*", "__main__", 1);
+            std::unordered_map<std::string, std::shared_ptr<function> >& specializations = main_decl -> get_specializations();
+            auto main_it = specializations.find(main_decl -> get_name());
+            if(main_it == specializations.end())
+                throw interpretation_error(star_tok, "No function by the name <__main__> with arity <1> was checked. Namespace is <*>.");
+            interpret_function(main_it -> second, argv);
         } catch(std::runtime_error err) {
             throw interpretation_error(star_tok, err.what());
         }
@@ -221,13 +307,13 @@ interpreter::interpreter(gtable& gtab, error& error_handler) : m_error_handler(e
      * evaluates a builtin function by calling its local evaluate method passing it the given arguments
      */
     std::shared_ptr<expr> interpreter::interpret_builtin_function(std::shared_ptr<function>& function_decl, std::vector<std::shared_ptr<expr> >& arguments) {
-        avalon_function avl_function(function_decl, m_qproc);
-        return avl_function.run(arguments);
+        profile_scope profile(function_decl);
+        return m_builtins -> run(function_decl, arguments);
     }
 
     std::shared_ptr<expr> interpreter::interpret_builtin_function(std::shared_ptr<function>& function_decl, std::vector<std::shared_ptr<expr> >& arguments, type_instance& ret_instance) {
-        avalon_function avl_function(function_decl, m_qproc);
-        return avl_function.run(arguments, ret_instance);
+        profile_scope profile(function_decl);
+        return m_builtins -> run(function_decl, arguments, ret_instance);
     }
 
     /**
@@ -235,6 +321,8 @@ interpreter::interpreter(gtable& gtab, error& error_handler) : m_error_handler(e
      * evaluates a user function by using this interpreter
      */
     std::shared_ptr<expr> interpreter::interpret_user_function(std::shared_ptr<function>& function_decl, std::vector<std::shared_ptr<expr> >& arguments) {
+        profile_scope profile(function_decl);
+        trace_scope trace(function_decl);
         // first, we assign the function parameters values passed as arguments
         std::vector<std::pair<std::string, std::shared_ptr<variable> > >& params = function_decl -> get_params();
         auto param_it = params.begin(), param_end = params.end();
@@ -268,14 +356,8 @@ interpreter::interpreter(gtable& gtab, error& error_handler) : m_error_handler(e
                 if(res.first == true)
                     return res;
 
-                // handle continue statement
-                if(m_continue_loop) {
-                    m_continue_loop = false;
-                    return std::make_pair(false, nullptr);
-                }
-
-                // handle break statement
-                if(m_break_loop)
+                // handle continue and break statements, the enclosing loop clears the flags
+                if(m_continue_loop || m_break_loop)
                     return std::make_pair(false, nullptr);
             }
             else {
@@ -320,6 +402,9 @@ interpreter::interpreter(gtable& gtab, error& error_handler) : m_error_handler(e
         if(a_statement -> is_while()) {
             return interpret_while(a_statement, l_scope, ns_name);
         }
+        else if(a_statement -> is_for()) {
+            return interpret_for(a_statement, l_scope, ns_name);
+        }
         else if(a_statement -> is_if()) {
             return interpret_if(a_statement, l_scope, ns_name);
         }
@@ -355,12 +440,19 @@ interpreter::interpreter(gtable& gtab, error& error_handler) : m_error_handler(e
 
         std::shared_ptr<expr> final_condition = interpret_expression(w_condition, w_scope, ns_name);
         std::shared_ptr<identifier_expression> condition_id = std::static_pointer_cast<identifier_expression>(final_condition);
+        std::int64_t iteration = 0;
         while(condition_id -> get_token() == true_cons_tok) {
+            if(tracer::is_enabled())
+                tracer::loop_iteration(* w_stmt, iteration++);
+
             std::pair<bool, std::shared_ptr<expr> > res = interpret_block(w_body, w_scope, ns_name);
             // handle return statement
             if(res.first == true)
                 return res;
 
+            // handle continue statement
+            m_continue_loop = false;
+
             // handle break statement
             if(m_break_loop) {
                 m_break_loop = false;
@@ -375,6 +467,129 @@ interpreter::interpreter(gtable& gtab, error& error_handler) : m_error_handler(e
         return std::make_pair(false, nullptr);
     }
 
+    /**
+     * interpret_for
+     * given a for statement, we walk the iterable container directly and run the body once per element
+     * the iterable is evaluated only once and there is no subscript, maybe wrapping nor matching per iteration
+     */
+    std::pair<bool, std::shared_ptr<expr> > interpreter::interpret_for(std::shared_ptr<stmt>& a_statement, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
+        std::shared_ptr<for_stmt> const & f_stmt = std::static_pointer_cast<for_stmt>(a_statement);
+        std::shared_ptr<expr>& f_iterable = f_stmt -> get_iterable();
+        std::shared_ptr<scope>& f_scope = f_stmt -> get_scope();
+        std::vector<std::shared_ptr<variable> >& f_variables = f_stmt -> get_variables();
+        block_stmt& f_body = f_stmt -> get_block();
+
+        // the loop variables always hold final values so reading them never goes back through the interpreter
+        std::shared_ptr<variable>& element_var = f_variables[0];
+        std::shared_ptr<variable> value_var = f_variables.size() > 1 ? f_variables[1] : nullptr;
+        for(auto& f_variable : f_variables)
+            f_variable -> is_interpreted(true);
+
+        std::shared_ptr<expr> iterable = interpret_expression(f_iterable, f_scope, ns_name);
+        std::pair<bool, std::shared_ptr<expr> > res = std::make_pair(false, nullptr);
+        std::int64_t iteration = 0;
+
+        // runs the body once and returns false if a return or break statement ended the loop
+        auto run_body = [&]() -> bool {
+            if(tracer::is_enabled())
+                tracer::loop_iteration(* f_stmt, iteration++);
+
+            res = interpret_block(f_body, f_scope, ns_name);
+            // handle return statement
+            if(res.first == true)
+                return false;
+
+            // handle continue statement
+            m_continue_loop = false;
+
+            // handle break statement
+            if(m_break_loop) {
+                m_break_loop = false;
+                return false;
+            }
+
+            return true;
+        };
+
+        // binds the loop variable to each integer in the range from start (included) to end (excluded)
+        auto run_range = [&](long long int start, long long int end, long long int step, type_instance& int_instance) {
+            if(step == 0)
+                throw interpretation_error(f_stmt -> get_token(), "The step of a range in a for loop cannot be zero.");
+
+            // every integer shares the same token and holds its value directly, its string is only built if the body asks for it.
+            // the body may keep the literal so each iteration gets its own instead of reusing one.
+            for(long long int i = start; step > 0 ? i < end : i > end; i += step) {
+                std::shared_ptr<literal_expression> int_lit = std::make_shared<literal_expression>(builtin_token(INTEGER), i);
+                int_lit -> set_type_instance(int_instance);
+                std::shared_ptr<expr> element = int_lit;
+                element_var -> set_value(element);
+                if(run_body() == false)
+                    break;
+            }
+        };
+
+        if(iterable -> is_list_expression()) {
+            std::shared_ptr<list_expression> const & list_expr = std::static_pointer_cast<list_expression>(iterable);
+            std::vector<std::shared_ptr<expr> >& elements = list_expr -> get_elements();
+            for(auto it = elements.begin(), end = elements.end(); it != end; ++it) {
+                element_var -> set_value(* it);
+                if(run_body() == false)
+                    break;
+            }
+        }
+        else if(iterable -> is_map_expression()) {
+            std::shared_ptr<map_expression> const & map_expr = std::static_pointer_cast<map_expression>(iterable);
+            std::vector<std::pair<std::shared_ptr<expr>, std::shared_ptr<expr> > >& elements = map_expr -> get_elements();
+            for(auto it = elements.begin(), end = elements.end(); it != end; ++it) {
+                element_var -> set_value(it -> first);
+                if(value_var != nullptr)
+                    value_var -> set_value(it -> second);
+                if(run_body() == false)
+                    break;
+            }
+        }
+        else if(iterable -> is_literal_expression()) {
+            std::shared_ptr<literal_expression> const & lit_expr = std::static_pointer_cast<literal_expression>(iterable);
+            type_instance& lit_instance = lit_expr -> get_type_instance();
+            if(lit_expr -> get_expression_type() == STRING_EXPR) {
+                // every character is a view over the buffer of the string we are iterating over
+                const shared_string& str = lit_expr -> get_shared_string_value();
+                token lit_tok = lit_expr -> get_token();
+                for(std::size_t i = 0, length = str.length(); i < length; i++) {
+                    std::shared_ptr<literal_expression> char_lit = std::make_shared<literal_expression>(lit_tok, str.substr(i, 1));
+                    char_lit -> set_type_instance(lit_instance);
+                    std::shared_ptr<expr> element = char_lit;
+                    element_var -> set_value(element);
+                    if(run_body() == false)
+                        break;
+                }
+            }
+            else if(lit_expr -> get_expression_type() == INTEGER_EXPR) {
+                run_range(0, lit_expr -> get_int_value(), 1, lit_instance);
+            }
+            else {
+                throw interpretation_error(f_stmt -> get_token(), "[compiler error] unexpected literal iterated over in for loop.");
+            }
+        }
+        else if(iterable -> is_tuple_expression()) {
+            std::shared_ptr<tuple_expression> const & tup_expr = std::static_pointer_cast<tuple_expression>(iterable);
+            std::vector<std::pair<std::string, std::shared_ptr<expr> > >& bounds = tup_expr -> get_elements();
+            std::shared_ptr<literal_expression> const & start_lit = std::static_pointer_cast<literal_expression>(bounds[0].second);
+            std::shared_ptr<literal_expression> const & end_lit = std::static_pointer_cast<literal_expression>(bounds[1].second);
+            long long int step = 1;
+            if(bounds.size() > 2)
+                step = std::static_pointer_cast<literal_expression>(bounds[2].second) -> get_int_value();
+            run_range(start_lit -> get_int_value(), end_lit -> get_int_value(), step, start_lit -> get_type_instance());
+        }
+        else {
+            throw interpretation_error(f_stmt -> get_token(), "[compiler error] unexpected expression iterated over in for loop.");
+        }
+
+        if(res.first == true)
+            return res;
+        return std::make_pair(false, nullptr);
+    }
+
     /**
      * interpret_if
      * given an if statemnt, we make choices
@@ -566,43 +781,7 @@ interpreter::interpreter(gtable& gtab, error& error_handler) : m_error_handler(e
     }
 
     std::shared_ptr<expr> interpreter::interpret_reference_tuple(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
-        std::shared_ptr<reference_expression> const & ref_expr = std::static_pointer_cast<reference_expression>(an_expression);
-        std::shared_ptr<variable>& ref_var = ref_expr -> get_variable();
-        std::shared_ptr<expr>& ref_var_val = ref_var -> get_value();
-        std::shared_ptr<reference_expression> const & inner_ref_expr = std::static_pointer_cast<reference_expression>(ref_var_val);
-        std::shared_ptr<variable>& inner_ref_var = inner_ref_expr -> get_variable();
-        std::shared_ptr<expr>& var_expr = inner_ref_var -> get_value();
-        
-        std::shared_ptr<tuple_expression> const & tup_expr = std::static_pointer_cast<tuple_expression>(var_expr);
-        std::vector<std::pair<std::string, std::shared_ptr<expr> > >& elements = tup_expr -> get_elements();
-
-        // get the index expression that will help us locate the element of interest inside the tuple
-        std::shared_ptr<expr>& index_expr = ref_expr -> get_index_expression();
-        // the index inside the tuple where to find the referenced element
-        std::size_t index = 0;
-
-        // if the index expression is an identifier, then we have a named tuple
-        if(index_expr -> is_identifier_expression()) {
-            for(auto& element : elements) {
-                if(element.first == index_expr -> expr_token().get_lexeme()) {
-                    ref_expr -> set_index(index);
-                    break;
-                }
-                else {
-                    index = index + 1;
-                }
-            }
-        }
-        // if the index is a literal, then we have a regular tuple
-        else if(index_expr -> is_literal_expression()) {
-            std::sscanf(index_expr -> expr_token().get_lexeme().c_str(), "%zu", &index);
-            ref_expr -> set_index(index);
-        }
-        // anything else is an error - though this should not happen at all
-        else {
-            throw interpretation_error(index_expr -> expr_token(), "[compiler error] Unexpected expression used as index to access a tuple.");
-        }
-
+        // tuple keys are literals so the index of the referenced element was set on the reference expression during checking
         return an_expression;
     }
 
@@ -641,26 +820,19 @@ interpreter::interpreter(gtable& gtab, error& error_handler) : m_error_handler(e
 
         // try to find the element
         // the type instance of the expression to return
-        avalon_ref avl_ref;
-        type_instance ref_instance = avl_ref.get_type_instance(var_instance.get_params()[0]);
-        avalon_maybe avl_maybe;
-        type_instance ret_instance = avl_maybe.get_type_instance(ref_instance);
+        maybe_result& result = get_maybe_result(var_instance.get_params()[0], true);
         // the expression to return
         std::shared_ptr<expr> final_expr = nullptr;
         if(index >=0 && index < elements.size()) {
-            elements.at(index);
             ref_expr -> set_index(index);
             std::shared_ptr<call_expression> ret_expr = std::make_shared<call_expression>(just_cons_tok);
             ret_expr -> add_argument(star_tok, an_expression);
             ret_expr -> set_expression_type(DEFAULT_CONSTRUCTOR_EXPR);
-            ret_expr -> set_type_instance(ret_instance);
+            ret_expr -> set_type_instance(result.m_maybe_instance);
             final_expr = ret_expr;
         }
         else {
-            std::shared_ptr<identifier_expression> ret_expr = std::make_shared<identifier_expression>(none_cons_tok);
-            ret_expr -> set_type_instance(ret_instance);
-            ret_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-            final_expr = ret_expr;
+            final_expr = result.m_none;
         }
 
         return final_expr;
@@ -675,73 +847,28 @@ interpreter::interpreter(gtable& gtab, error& error_handler) : m_error_handler(e
         std::shared_ptr<expr>& var_expr = inner_ref_var -> get_value();
 
         std::shared_ptr<map_expression> const & map_expr = std::static_pointer_cast<map_expression>(var_expr);
-        std::vector<std::pair<std::shared_ptr<expr>, std::shared_ptr<expr> > >& elements = map_expr -> get_elements();
         type_instance& map_instance = map_expr -> get_type_instance();
 
         // get the index expression that will help us locate the element of interest inside the list
         std::shared_ptr<expr>& user_index_expr = ref_expr -> get_index_expression();
         std::shared_ptr<expr> index_expr = interpret_expression(user_index_expr, l_scope, ns_name);
-        // the index inside the list where to find the referenced element
-        std::size_t index = 0;
 
         // try to find the element
         // the type instance of the expression to return
-        avalon_ref avl_ref;
-        type_instance ref_instance = avl_ref.get_type_instance(map_instance.get_params()[1]);
-        avalon_maybe avl_maybe;
-        type_instance ret_instance = avl_maybe.get_type_instance(ref_instance);
-        // the expression to return
-        std::shared_ptr<expr> final_expr = nullptr;
-
-        // failure return value
-        std::shared_ptr<identifier_expression> ret_expr = std::make_shared<identifier_expression>(none_cons_tok);
+        maybe_result& result = get_maybe_result(map_instance.get_params()[1], true);
+        type_instance& ret_instance = result.m_maybe_instance;
+
+        // the hash index finds the position of the key without going over every element
+        std::size_t position = map_find(* this, map_expr, index_expr);
+        if(position == map_expression::npos)
+            return result.m_none;
+
+        ref_expr -> set_index(position);
+        std::shared_ptr<call_expression> ret_expr = std::make_shared<call_expression>(just_cons_tok);
+        ret_expr -> add_argument(star_tok, an_expression);
+        ret_expr -> set_expression_type(DEFAULT_CONSTRUCTOR_EXPR);
         ret_expr -> set_type_instance(ret_instance);
-        ret_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        final_expr = ret_expr;
-
-        // if the map is empty, we return None
-        if(elements.size() == 0) {
-            return final_expr;
-        }
-
-        // get the namespace
-        type_instance& index_instance = index_expr -> expr_type_instance();
-
-        // get the hash function and hash the key
-        std::shared_ptr<function>& hash_function = l_scope -> get_function(index_instance.get_namespace(), map_expr -> get_callee(), 1);
-        std::vector<std::shared_ptr<expr> > hash_arguments = { index_expr };
-        std::shared_ptr<expr> hashed_key = interpret_function(hash_function, hash_arguments);
-
-        // get the key comparator function
-        std::shared_ptr<function>& eq_function = l_scope -> get_function("*", map_expr -> get_comparator_callee(), 2);
-
-        // deduce and return the expression
-        for(auto& element : elements) {
-            std::shared_ptr<expr> key_expr = interpret_expression(element.first, l_scope, ns_name);
-            // hash the map key
-            std::vector<std::shared_ptr<expr> > hash_arguments = { key_expr };
-            std::shared_ptr<expr> hashed_key_expr = interpret_function(hash_function, hash_arguments);
-            // compare it with the given key
-            std::vector<std::shared_ptr<expr> > eq_arguments = { hashed_key, hashed_key_expr };
-            std::shared_ptr<expr> res = interpret_function(eq_function, eq_arguments);
-            // the resulting expression is identifier expression containing a boolean
-            std::shared_ptr<identifier_expression> const & res_id = std::static_pointer_cast<identifier_expression>(res);
-            // while we could build an another boolean comparator function but for now we just compare the names here
-            if(res_id -> get_token() == true_cons_tok) {
-                ref_expr -> set_index(index);
-                std::shared_ptr<call_expression> ret_expr = std::make_shared<call_expression>(just_cons_tok);
-                ret_expr -> add_argument(star_tok, an_expression);
-                ret_expr -> set_expression_type(DEFAULT_CONSTRUCTOR_EXPR);
-                ret_expr -> set_type_instance(ret_instance);
-                std::shared_ptr<expr> final_expr = ret_expr;
-                return final_expr;
-            }
-            else {
-                index = index + 1;
-            }
-        }
-
-        // we didn't find the value
+        std::shared_ptr<expr> final_expr = ret_expr;
         return final_expr;
     }
 
@@ -769,19 +896,13 @@ interpreter::interpreter(gtable& gtab, error& error_handler) : m_error_handler(e
         std::shared_ptr<expr> user_ref_expr = interpret_function(get_function, args);
 
         // the type instance of the expression to return
-        avalon_ref avl_ref;
-        type_instance ref_instance = avl_ref.get_type_instance(var_instance.get_params()[0]);
-        avalon_maybe avl_maybe;
-        type_instance ret_instance = avl_maybe.get_type_instance(ref_instance);
-
+        maybe_result& result = get_maybe_result(var_instance.get_params()[0], true);
+        type_instance& ret_instance = result.m_maybe_instance;
 
         std::shared_ptr<expr> final_expr = nullptr;
         // if the returned expression is an identifier expression then the referenced expression could not be found
         if(user_ref_expr -> is_identifier_expression()) {
-            std::shared_ptr<identifier_expression> ret_expr = std::make_shared<identifier_expression>(none_cons_tok);
-            ret_expr -> set_type_instance(ret_instance);
-            ret_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-            final_expr = ret_expr;
+            final_expr = result.m_none;
         }
         // we got a call expression, then we do have an index. so we set it on the current reference
         else if(user_ref_expr -> is_call_expression()) {
@@ -906,62 +1027,28 @@ interpreter::interpreter(gtable& gtab, error& error_handler) : m_error_handler(e
             // if we have bits
             if(lit_expr -> get_expression_type() == BIT_EXPR) {
                 std::size_t index = ref_expr -> get_index();
-                std::size_t length = lit_expr -> get_length();
-                std::size_t string_index = length - index - 1;
+                const bit_vector& bits = lit_expr -> get_bits_value();
+                if(index >= bits.size())
+                    throw interpretation_error(lit_expr -> get_token(), "[compiler error] unexpected bit index <" + std::to_string(index) + "> on bits of size <" + std::to_string(bits.size()) + ">.");
 
                 // bit type
-                avalon_bit avl_bit;
+                static avalon_bit avl_bit;
                 type_instance bit_instance = avl_bit.get_type_instance();
 
-                // if we have a bitset of size 1
-                if(length == 1) {
-                    std::string lit_val = lit_expr -> get_value().substr(string_index, 1);
-                    token lit_tok(BITS, lit_val, 0, 0, "__bil__");
-                    std::shared_ptr<literal_expression> ret_expr = std::make_shared<literal_expression>(lit_tok, BIT_EXPR, lit_val);
-                    ret_expr -> set_type_instance(bit_instance);
-                    final_expr = ret_expr;
-                }
-                // if we have a bitset of size 2
-                else if(length == 2) {
-                    std::string lit_val = lit_expr -> get_value().substr(string_index, 1);
-                    token lit_tok(BITS, lit_val, 0, 0, "__bil__");
-                    std::shared_ptr<literal_expression> ret_expr = std::make_shared<literal_expression>(lit_tok, BIT_EXPR, lit_val);
-                    ret_expr -> set_type_instance(bit_instance);
-                    final_expr = ret_expr;
-                }
-                // if we have a bitset of size 4
-                else if(length == 4) {
-                    std::string lit_val = lit_expr -> get_value().substr(string_index, 1);
-                    token lit_tok(BITS, lit_val, 0, 0, "__bil__");
-                    std::shared_ptr<literal_expression> ret_expr = std::make_shared<literal_expression>(lit_tok, BIT_EXPR, lit_val);
-                    ret_expr -> set_type_instance(bit_instance);
-                    final_expr = ret_expr;
-                }
-                // if we have a bitset of size 8
-                else if(length == 8) {
-                    // bit8 type
-                    avalon_bit8 avl_bit8;
-                    type_instance bit8_instance = avl_bit8.get_type_instance();
-
-                    std::string lit_val = lit_expr -> get_value().substr(string_index, 1);
-                    token lit_tok(BITS, lit_val, 0, 0, "__bil__");
-                    std::shared_ptr<literal_expression> ret_expr = std::make_shared<literal_expression>(lit_tok, BIT_EXPR, lit_val);
-                    ret_expr -> set_type_instance(bit_instance);
-                    final_expr = ret_expr;
-                }
-                else {
-                    throw interpretation_error(lit_expr -> get_token(), "[compiler error] unexpected bit of size <" + std::to_string(length) + ">.");
-                }
+                bit_vector bit(1);
+                bit.set(0, bits.test(index));
+                std::shared_ptr<literal_expression> ret_expr = std::make_shared<literal_expression>(builtin_token(BITS), bit);
+                ret_expr -> set_type_instance(bit_instance);
+                final_expr = ret_expr;
             }
             else if(lit_expr -> get_expression_type() == STRING_EXPR) {
                 // string type
-                avalon_string avl_string;
+                static avalon_string avl_string;
                 type_instance string_instance = avl_string.get_type_instance();
 
                 // build the new string
-                std::string lit_val = lit_expr -> get_string_value().substr(ref_expr -> get_index(), 1);
-                token lit_tok(STRING, lit_val, 0, 0, "__bil__");
-                std::shared_ptr<literal_expression> ret_expr = std::make_shared<literal_expression>(lit_tok, STRING_EXPR, lit_val);
+                shared_string lit_val = lit_expr -> get_shared_string_value().substr(ref_expr -> get_index(), 1);
+                std::shared_ptr<literal_expression> ret_expr = std::make_shared<literal_expression>(builtin_token(STRING), lit_val);
                 ret_expr -> set_type_instance(string_instance);
                 final_expr = ret_expr;
             }
@@ -1035,10 +1122,30 @@ interpreter::interpreter(gtable& gtab, error& error_handler) : m_error_handler(e
 
         // create a new map expression and fill it with elements
         std::shared_ptr<map_expression> new_map_expr = std::make_shared<map_expression>(tok);
-        new_map_expr -> set_comparator_callee(map_expr -> get_comparator_callee());
         new_map_expr -> set_callee(map_expr -> get_callee());
+        new_map_expr -> set_comparator_callee(map_expr -> get_comparator_callee());
         new_map_expr -> set_type_instance(instance);
 
+        // keys of custom types are hashed with the __hash__ function found during inference, keys of builtin types are hashed natively
+        if(map_expr -> get_callee().empty() == false) {
+            std::shared_ptr<function> hash_function = map_expr -> get_hash_function();
+            if(hash_function == nullptr) {
+                hash_function = l_scope -> get_function(instance.get_params()[0].get_namespace(), map_expr -> get_callee(), 1);
+                map_expr -> set_hash_function(hash_function);
+            }
+            new_map_expr -> set_hash_function(hash_function);
+
+            // keys with equal hashes are compared with the __eq__ function of their type if it has one
+            if(map_expr -> get_comparator_callee().empty() == false) {
+                std::shared_ptr<function> comp_function = map_expr -> get_comparator_function();
+                if(comp_function == nullptr) {
+                    comp_function = l_scope -> get_function(instance.get_params()[0].get_namespace(), map_expr -> get_comparator_callee(), 2);
+                    map_expr -> set_comparator_function(comp_function);
+                }
+                new_map_expr -> set_comparator_function(comp_function);
+            }
+        }
+
         // set up new elements if the map is not empty
         if(elements.size() > 0) {
             for(auto& element : elements) {
@@ -1063,18 +1170,34 @@ interpreter::interpreter(gtable& gtab, error& error_handler) : m_error_handler(e
         std::shared_ptr<call_expression> const & call_expr = std::static_pointer_cast<call_expression>(an_expression);
         std::vector<std::pair<token, std::shared_ptr<expr> > >& arguments = call_expr -> get_arguments();
         call_expression_type expr_type = call_expr -> get_expression_type();
-        const std::string& cons_ns = call_expr -> get_namespace();
-        type_instance instance = call_expr -> get_type_instance();
-        token tok = call_expr -> get_token();
 
-        if(call_expr -> get_expression_type() == DEFAULT_CONSTRUCTOR_EXPR || call_expr -> get_expression_type() == RECORD_CONSTRUCTOR_EXPR) {
+        if(expr_type == DEFAULT_CONSTRUCTOR_EXPR || expr_type == RECORD_CONSTRUCTOR_EXPR) {
+            // a gate whose unitary was computed is already a value, building it again would lose the unitary
+            if(call_expr -> has_unitary())
+                return an_expression;
+
+            const std::string& cons_ns = call_expr -> get_namespace();
+            type_instance& instance = call_expr -> get_type_instance();
+            token tok = call_expr -> get_token();
             std::shared_ptr<call_expression> cons_call_expr = std::make_shared<call_expression>(tok);
             cons_call_expr -> set_type_instance(instance);
             cons_call_expr -> set_namespace(cons_ns);
             cons_call_expr -> set_expression_type(expr_type);
-            for(auto& argument : arguments) {
-                std::shared_ptr<expr> cons_argument = interpret_expression(argument.second, l_scope, ns_name);
-                cons_call_expr -> add_argument(argument.first, cons_argument);
+
+            // record constructor arguments are stored in the order of the parameters but evaluated in the order of the source
+            const std::vector<std::size_t>& evaluation_order = call_expr -> get_evaluation_order();
+            if(evaluation_order.empty()) {
+                for(auto& argument : arguments) {
+                    std::shared_ptr<expr> cons_argument = interpret_expression(argument.second, l_scope, ns_name);
+                    cons_call_expr -> add_argument(argument.first, cons_argument);
+                }
+            }
+            else {
+                std::vector<std::shared_ptr<expr> > cons_arguments(arguments.size());
+                for(std::size_t position : evaluation_order)
+                    cons_arguments[position] = interpret_expression(arguments[position].second, l_scope, ns_name);
+                for(std::size_t i = 0; i < arguments.size(); i++)
+                    cons_call_expr -> add_argument(arguments[i].first, cons_arguments[i]);
             }
             std::shared_ptr<expr> final_expr = cons_call_expr;
             return final_expr;
@@ -1088,11 +1211,10 @@ interpreter::interpreter(gtable& gtab, error& error_handler) : m_error_handler(e
             std::tie(fun_ns_name, fun_name, fun_arity) = call_expr -> get_callee();            
             std::shared_ptr<function>& function_decl = l_scope -> get_function(fun_ns_name, fun_name, fun_arity);
             // build arguments
-            std::vector<std::shared_ptr<expr> > fun_arguments;
-            for(auto& argument : arguments) {
-                std::shared_ptr<expr> fun_argument = interpret_expression(argument.second, l_scope, ns_name);
-                fun_arguments.push_back(fun_argument);
-            }
+            argument_frame frame(m_argument_stack, m_call_depth);
+            std::vector<std::shared_ptr<expr> >& fun_arguments = frame.get_arguments();
+            for(auto& argument : arguments)
+                fun_arguments.push_back(interpret_expression(argument.second, l_scope, ns_name));
             // "call" the function
             return interpret_function(function_decl, fun_arguments);
         }
@@ -1152,10 +1274,9 @@ interpreter::interpreter(gtable& gtab, error& error_handler) : m_error_handler(e
         std::shared_ptr<function>& function_decl = l_scope -> get_function(value_instance.get_namespace(), cast_expr -> get_callee(), 1);
         
         // build arguments
-        std::shared_ptr<expr> argument = interpret_expression(value, l_scope, ns_name);
-        std::vector<std::shared_ptr<expr> > arguments {
-            argument
-        };
+        argument_frame frame(m_argument_stack, m_call_depth);
+        std::vector<std::shared_ptr<expr> >& arguments = frame.get_arguments();
+        arguments.push_back(interpret_expression(value, l_scope, ns_name));
 
         // "call" the function        
         return interpret_function(function_decl, arguments, cast_expr -> get_cast_type_instance());
@@ -1174,10 +1295,9 @@ interpreter::interpreter(gtable& gtab, error& error_handler) : m_error_handler(e
         std::shared_ptr<function>& function_decl = l_scope -> get_function(value_instance.get_namespace(), unary_expr -> get_callee(), 1);
 
         // build arguments
-        std::shared_ptr<expr> argument = interpret_expression(value, l_scope, ns_name);
-        std::vector<std::shared_ptr<expr> > arguments {
-            argument
-        };
+        argument_frame frame(m_argument_stack, m_call_depth);
+        std::vector<std::shared_ptr<expr> >& arguments = frame.get_arguments();
+        arguments.push_back(interpret_expression(value, l_scope, ns_name));
 
         // "call" the function
         return interpret_function(function_decl, arguments);
@@ -1239,12 +1359,10 @@ interpreter::interpreter(gtable& gtab, error& error_handler) : m_error_handler(e
         std::shared_ptr<function>& function_decl = l_scope -> get_function(lval_instance.get_namespace(), bin_expr -> get_callee(), 2);
 
         // build arguments
-        std::shared_ptr<expr> argument_one = interpret_expression(lval, l_scope, ns_name);
-        std::shared_ptr<expr> argument_two = interpret_expression(rval, l_scope, ns_name);
-        std::vector<std::shared_ptr<expr> > arguments {
-            argument_one,
-            argument_two
-        };
+        argument_frame frame(m_argument_stack, m_call_depth);
+        std::vector<std::shared_ptr<expr> >& arguments = frame.get_arguments();
+        arguments.push_back(interpret_expression(lval, l_scope, ns_name));
+        arguments.push_back(interpret_expression(rval, l_scope, ns_name));
 
         // "call" the function
         return interpret_function(function_decl, arguments);
@@ -1254,22 +1372,6 @@ interpreter::interpreter(gtable& gtab, error& error_handler) : m_error_handler(e
         std::shared_ptr<expr>& lval = bin_expr -> get_lval();
         std::shared_ptr<expr>& rval = bin_expr -> get_rval();
 
-        // bool type
-        avalon_bool avl_bool;
-        type_instance bool_instance = avl_bool.get_type_instance();
-
-        // true expression
-        std::shared_ptr<identifier_expression> true_expr = std::make_shared<identifier_expression>(true_cons_tok);
-        true_expr -> set_type_instance(bool_instance);
-        true_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        std::shared_ptr<expr> true_final_expr = true_expr;
-
-        // false expression
-        std::shared_ptr<identifier_expression> false_expr = std::make_shared<identifier_expression>(false_cons_tok);
-        false_expr -> set_type_instance(bool_instance);
-        false_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        std::shared_ptr<expr> false_final_expr = false_expr;
-
         // we get the variable contained in the lval and rval references
         std::shared_ptr<variable> lval_var = nullptr;
         std::shared_ptr<variable> rval_var = nullptr;
@@ -1310,10 +1412,8 @@ interpreter::interpreter(gtable& gtab, error& error_handler) : m_error_handler(e
             rval_type = rval_ref -> get_expression_type();
         }
 
-        if(bin_expr -> get_expression_type() == IS_EXPR)
-            return (lval_var == rval_var && lval_index == rval_index && lval_type == rval_type) ? true_expr : false_expr;
-        else
-            return (lval_var == rval_var && lval_index == rval_index && lval_type == rval_type) ? false_expr : true_expr;
+        bool same = lval_var == rval_var && lval_index == rval_index && lval_type == rval_type;
+        return bool_value(bin_expr -> get_expression_type() == IS_EXPR ? same : !same);
     }
 
     std::shared_ptr<expr> interpreter::interpret_dot_binary(std::shared_ptr<binary_expression> const & bin_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
@@ -1397,38 +1497,29 @@ interpreter::interpreter(gtable& gtab, error& error_handler) : m_error_handler(e
 
     std::shared_ptr<expr> interpreter::interpret_tuple_attribute(std::shared_ptr<binary_expression> const & bin_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         std::shared_ptr<expr>& lval = bin_expr -> get_lval();
-        std::shared_ptr<expr>& rval = bin_expr -> get_rval();
-
         std::shared_ptr<identifier_expression> const & id_expr = std::static_pointer_cast<identifier_expression>(lval);
         std::shared_ptr<variable>& var_decl = l_scope -> get_variable(id_expr -> get_namespace(), id_expr -> get_name());
-        std::shared_ptr<scope>& var_scope = (var_decl -> is_global() == true) ? var_decl -> get_scope() : l_scope;
-        std::shared_ptr<expr>& var_value = var_decl -> get_value();
-        std::shared_ptr<tuple_expression> const & tuple_expr = std::static_pointer_cast<tuple_expression>(var_value);
-        std::vector<std::pair<std::string, std::shared_ptr<expr> > >& elements = tuple_expr -> get_elements();
-
-        for(auto& element : elements) {
-            if(element.first == rval -> expr_token().get_lexeme()) {
-                std::shared_ptr<expr>& tup_value = element.second;
-                return interpret_expression(tup_value, var_scope, ns_name);
-            }
-        }
-
-        // we should never reach here but the compiler function termination checker will complain if we don't have this
-        return nullptr;
+        return interpret_tuple_element(var_decl, bin_expr -> get_element_index(), l_scope, ns_name);
     }
 
     std::shared_ptr<expr> interpreter::interpret_custom_attribute(std::shared_ptr<binary_expression> const & bin_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         std::shared_ptr<expr>& lval = bin_expr -> get_lval();
 
+        // record fields were resolved to a position during checking and record values keep their fields in that order
+        if(bin_expr -> has_element_index()) {
+            std::shared_ptr<expr> value = interpret_expression(lval, l_scope, ns_name);
+            std::shared_ptr<call_expression> const & record_expr = std::static_pointer_cast<call_expression>(value);
+            return record_expr -> get_arguments()[bin_expr -> get_element_index()].second;
+        }
+
         // get the __getattr__ function
         type_instance& lval_instance = lval -> expr_type_instance();
         std::shared_ptr<function>& function_decl = l_scope -> get_function(lval_instance.get_namespace(), bin_expr -> get_callee(), 1);
 
         // build arguments
-        std::shared_ptr<expr> argument = interpret_expression(lval, l_scope, ns_name);
-        std::vector<std::shared_ptr<expr> > arguments = {
-            argument
-        };
+        argument_frame frame(m_argument_stack, m_call_depth);
+        std::vector<std::shared_ptr<expr> >& arguments = frame.get_arguments();
+        arguments.push_back(interpret_expression(lval, l_scope, ns_name));
 
         // "call" the function
         return interpret_function(function_decl, arguments);
@@ -1457,26 +1548,34 @@ interpreter::interpreter(gtable& gtab, error& error_handler) : m_error_handler(e
 
     std::shared_ptr<expr> interpreter::interpret_tuple_subscript(std::shared_ptr<binary_expression> const & bin_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         std::shared_ptr<expr>& lval = bin_expr -> get_lval();
-        std::shared_ptr<expr>& rval = bin_expr -> get_rval();
-        
-        // get the tuple expression inside the lval (which is a variable expression)
         std::shared_ptr<identifier_expression> const & id_expr = std::static_pointer_cast<identifier_expression>(lval);
         std::shared_ptr<variable>& var_decl = l_scope -> get_variable(id_expr -> get_namespace(), id_expr -> get_name());
+        return interpret_tuple_element(var_decl, bin_expr -> get_element_index(), l_scope, ns_name);
+    }
+
+    /**
+     * interpret_tuple_element
+     * returns the element at the given position, resolved during checking, inside the tuple held by the given variable
+     */
+    std::shared_ptr<expr> interpreter::interpret_tuple_element(std::shared_ptr<variable>& var_decl, std::size_t index, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         std::shared_ptr<scope>& var_scope = (var_decl -> is_global() == true) ? var_decl -> get_scope() : l_scope;
         std::shared_ptr<expr>& var_value = var_decl -> get_value();
+
+        // if the variable holds a tuple expression, we only need the element of interest
+        // and once the variable has been interpreted, its elements are values already
+        if(var_value -> is_tuple_expression()) {
+            std::shared_ptr<tuple_expression> const & tup_expr = std::static_pointer_cast<tuple_expression>(var_value);
+            std::shared_ptr<expr>& element = tup_expr -> get_elements()[index].second;
+            if(var_decl -> is_interpreted())
+                return element;
+            else
+                return interpret_expression(element, var_scope, ns_name);
+        }
+
+        // otherwise the variable holds an expression that evaluates to a tuple
         std::shared_ptr<expr> value = interpret_expression(var_value, var_scope, ns_name);
         std::shared_ptr<tuple_expression> const & tup_expr = std::static_pointer_cast<tuple_expression>(value);
-        std::vector<std::pair<std::string, std::shared_ptr<expr> > >& elements = tup_expr -> get_elements();
-        
-        // get the key
-        std::size_t key = 0;
-        std::shared_ptr<literal_expression> const & key_expr = std::static_pointer_cast<literal_expression>(rval);
-        std::sscanf(rval -> expr_token().get_lexeme().c_str(), "%zu", &key);
-
-        // deduce and return the expression
-        std::pair<std::string, std::shared_ptr<expr> >& element = elements.at(key);
-        std::shared_ptr<expr> final_expr = interpret_expression(element.second, l_scope, ns_name);
-        return final_expr;
+        return tup_expr -> get_elements()[index].second;
     }
 
     std::shared_ptr<expr> interpreter::interpret_list_subscript(std::shared_ptr<binary_expression> const & bin_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
@@ -1505,9 +1604,8 @@ interpreter::interpreter(gtable& gtab, error& error_handler) : m_error_handler(e
 
         // list subscript access returns a maybe object
         type_instance& list_instance = list_expr -> get_type_instance();
-        std::vector<type_instance> list_instance_params = list_instance.get_params();
-        avalon_maybe avl_maybe;
-        type_instance ret_instance = avl_maybe.get_type_instance(list_instance_params[0]);
+        maybe_result& result = get_maybe_result(list_instance.get_params()[0], false);
+        type_instance& ret_instance = result.m_maybe_instance;
 
         try {
             // deduce and return the expression
@@ -1520,12 +1618,7 @@ interpreter::interpreter(gtable& gtab, error& error_handler) : m_error_handler(e
             std::shared_ptr<expr> final_expr = ret_expr;
             return final_expr;
         } catch(std::out_of_range err) {
-            // get the type instance of elements in the list
-            std::shared_ptr<identifier_expression> ret_expr = std::make_shared<identifier_expression>(none_cons_tok);
-            ret_expr -> set_type_instance(ret_instance);
-            ret_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-            std::shared_ptr<expr> final_expr = ret_expr;
-            return final_expr;
+            return result.m_none;
         }
     }
 
@@ -1534,67 +1627,30 @@ interpreter::interpreter(gtable& gtab, error& error_handler) : m_error_handler(e
         std::shared_ptr<expr>& rval = bin_expr -> get_rval();
 
         // get the map expression inside the lval (which is a variable expression)
+        // only global variables can hold a map that was not interpreted yet, everywhere else we use the map as is instead of rebuilding it
         std::shared_ptr<identifier_expression> const & id_expr = std::static_pointer_cast<identifier_expression>(lval);
         std::shared_ptr<variable>& var_decl = l_scope -> get_variable(id_expr -> get_namespace(), id_expr -> get_name());
         std::shared_ptr<scope>& var_scope = (var_decl -> is_global() == true) ? var_decl -> get_scope() : l_scope;
         std::shared_ptr<expr>& var_value = var_decl -> get_value();
-        std::shared_ptr<expr> value = interpret_expression(var_value, var_scope, ns_name);
+        std::shared_ptr<expr> value = (var_decl -> is_interpreted() || var_decl -> is_global() == false) ? var_value : interpret_expression(var_value, var_scope, ns_name);
         std::shared_ptr<map_expression> const & map_expr = std::static_pointer_cast<map_expression>(value);
-        std::vector<std::pair<std::shared_ptr<expr>, std::shared_ptr<expr> > >& elements = map_expr -> get_elements();
         type_instance& map_instance = map_expr -> get_type_instance();
 
         // return type instance
-        std::vector<type_instance> map_instance_params = map_instance.get_params();
-        avalon_maybe avl_maybe;
-        type_instance ret_instance = avl_maybe.get_type_instance(map_instance_params[1]);
+        maybe_result& result = get_maybe_result(map_instance.get_params()[1], false);
+        type_instance& ret_instance = result.m_maybe_instance;
 
-        // failure return value
-        std::shared_ptr<identifier_expression> ret_expr = std::make_shared<identifier_expression>(none_cons_tok);
-        ret_expr -> set_type_instance(ret_instance);
-        ret_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        std::shared_ptr<expr> final_expr = ret_expr;
-
-        // if the map is empty, we return None
-        if(elements.size() == 0) {
-            return final_expr;
-        }
-
-        // get the namespace
+        // the hash index finds the position of the key without going over every element
         std::shared_ptr<expr> key = interpret_expression(rval, l_scope, ns_name);
-        type_instance& key_instance = key -> expr_type_instance();
-
-        // get the hash function and hash the key
-        std::shared_ptr<function>& hash_function = l_scope -> get_function(key_instance.get_namespace(), map_expr -> get_callee(), 1);
-        std::vector<std::shared_ptr<expr> > hash_arguments = { key };
-        std::shared_ptr<expr> hashed_key = interpret_function(hash_function, hash_arguments);
+        std::size_t position = map_find(* this, map_expr, key);
+        if(position == map_expression::npos)
+            return result.m_none;
 
-        // get the key comparator function
-        std::shared_ptr<function>& eq_function = l_scope -> get_function("*", map_expr -> get_comparator_callee(), 2);
-
-        // deduce and return the expression
-        for(auto& element : elements) {
-            std::shared_ptr<expr> key_expr = interpret_expression(element.first, l_scope, ns_name);
-            // hash the map key
-            std::vector<std::shared_ptr<expr> > hash_arguments = { key_expr };
-            std::shared_ptr<expr> hashed_key_expr = interpret_function(hash_function, hash_arguments);
-            // compare it with the given key
-            std::vector<std::shared_ptr<expr> > eq_arguments = { hashed_key, hashed_key_expr };
-            std::shared_ptr<expr> res = interpret_function(eq_function, eq_arguments);
-            // the resulting expression is identifier expression containing a boolean
-            std::shared_ptr<identifier_expression> const & res_id = std::static_pointer_cast<identifier_expression>(res);
-            // while we could build an another boolean comparator function but for now we just compare the names here
-            if(res_id -> get_token() == true_cons_tok) {
-                std::shared_ptr<expr> element_expr = interpret_expression(element.second, l_scope, ns_name);
-                std::shared_ptr<call_expression> ret_expr = std::make_shared<call_expression>(just_cons_tok);
-                ret_expr -> add_argument(star_tok, element_expr);
-                ret_expr -> set_expression_type(DEFAULT_CONSTRUCTOR_EXPR);
-                ret_expr -> set_type_instance(ret_instance);
-                std::shared_ptr<expr> final_expr = ret_expr;
-                return final_expr;
-            }
-        }
-
-        // we didn't find the value
+        std::shared_ptr<call_expression> ret_expr = std::make_shared<call_expression>(just_cons_tok);
+        ret_expr -> add_argument(star_tok, map_expr -> get_elements()[position].second);
+        ret_expr -> set_expression_type(DEFAULT_CONSTRUCTOR_EXPR);
+        ret_expr -> set_type_instance(ret_instance);
+        std::shared_ptr<expr> final_expr = ret_expr;
         return final_expr;
     }
 
@@ -1622,220 +1678,136 @@ interpreter::interpreter(gtable& gtab, error& error_handler) : m_error_handler(e
     std::shared_ptr<expr> interpreter::interpret_match(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
         std::shared_ptr<match_expression> const & match_expr = std::static_pointer_cast<match_expression>(an_expression);
         std::shared_ptr<expr>& lval = match_expr -> get_lval();
-        std::shared_ptr<expr>& rval = match_expr -> get_rval();
+
+        // the rval was compiled by the checker
+        std::shared_ptr<match_pattern>& pattern = match_expr -> get_pattern();
+        if(pattern == nullptr)
+            throw interpretation_error(match_expr -> get_token(), "[compiler error] the rval of the match expression was not compiled while checking.");
 
         std::shared_ptr<expr> lval_expr = interpret_expression(lval, l_scope, ns_name);
-        if(lval_expr -> is_literal_expression()) {
-            return interpret_literal_match(lval_expr, rval, l_scope, ns_name);
-        }
-        else if(lval_expr -> is_identifier_expression()) {
-            return interpret_identifier_match(lval_expr, rval, l_scope, ns_name);
-        }
-        else if(lval_expr -> is_call_expression()) {
-            return interpret_call_match(lval_expr, rval, l_scope, ns_name);
-        }
-        else {
+        if(lval_expr -> is_literal_expression() == false && lval_expr -> is_identifier_expression() == false && lval_expr -> is_call_expression() == false)
             throw interpretation_error(lval_expr -> expr_token(), "[compiler error] unexpected effective expression as lval in match expression.");
-        }
+
+        std::size_t pos = 0;
+        bool matched = match_pattern_node(pattern -> m_nodes, pos, lval_expr, l_scope, ns_name);
+        if(match_expr -> get_expression_type() == NOT_MATCH_EXPR)
+            matched = !matched;
+        return bool_value(matched);
     }
 
-    std::shared_ptr<expr> interpreter::interpret_literal_match(std::shared_ptr<expr>& lval_expr, std::shared_ptr<expr>& rval, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
-        // bool type
-        avalon_bool avl_bool;
-        type_instance bool_instance = avl_bool.get_type_instance();
+    /**
+     * match_pattern_node
+     * performs the test at the given position against the given value then the tests of its arguments if the value is a constructor call.
+     * returns false as soon as a test fails, variables captured before that keep their new values.
+     */
+    bool interpreter::match_pattern_node(std::vector<pattern_node>& nodes, std::size_t& pos, std::shared_ptr<expr>& value, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
+        pattern_node& node = nodes[pos++];
+        switch(node.m_kind) {
+            case pattern_node_kind::ANY:
+                return true;
+
+            case pattern_node_kind::NONE:
+                return false;
+
+            case pattern_node_kind::LITERAL: {
+                if(value -> is_literal_expression() == false)
+                    return false;
+
+                std::shared_ptr<literal_expression> const & value_lit = std::static_pointer_cast<literal_expression>(value);
+                if(value_lit -> get_expression_type() != node.m_literal_type)
+                    return false;
+
+                if(node.m_literal_type == INTEGER_EXPR)
+                    return value_lit -> get_int_value() == node.m_int;
+                else if(node.m_literal_type == FLOATING_POINT_EXPR)
+                    return value_lit -> get_float_value() == node.m_float;
+                else
+                    return value_lit -> get_shared_string_value() == node.m_string;
+            }
 
-        // true expression
-        std::shared_ptr<identifier_expression> true_expr = std::make_shared<identifier_expression>(true_cons_tok);
-        true_expr -> set_type_instance(bool_instance);
-        true_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        std::shared_ptr<expr> true_final_expr = true_expr;
+            case pattern_node_kind::CONSTRUCTOR: {
+                if(node.m_is_call == false) {
+                    if(value -> is_identifier_expression() == false)
+                        return false;
+                    return std::static_pointer_cast<identifier_expression>(value) -> get_name() == node.m_name;
+                }
 
-        // false expression
-        std::shared_ptr<identifier_expression> false_expr = std::make_shared<identifier_expression>(false_cons_tok);
-        false_expr -> set_type_instance(bool_instance);
-        false_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        std::shared_ptr<expr> false_final_expr = false_expr;
-        
-        // if the rval is not a literal expression, we return false
-        if(rval -> is_literal_expression() == false)
-            return false_final_expr;
-
-        // if it is, we compare both for value
-        std::shared_ptr<literal_expression> const & lval_lit = std::static_pointer_cast<literal_expression>(lval_expr);
-        std::shared_ptr<literal_expression> const & rval_lit = std::static_pointer_cast<literal_expression>(rval);
-        const literal_expression_type& expr_type = lval_lit -> get_expression_type();
-
-        // if they have different expression types, we return false
-        if(expr_type != rval_lit -> get_expression_type())
-            return false_final_expr;
-
-        // if we have the integers
-        if(expr_type == INTEGER_EXPR) {
-            long long int lval_value = lval_lit -> get_int_value();
-            long long int rval_value = rval_lit -> get_int_value();
-            if(lval_value == rval_value)
-                return true_final_expr;
-            else
-                return false_final_expr;
-        }
-        else if(expr_type == FLOATING_POINT_EXPR) {
-            double lval_value = lval_lit -> get_float_value();
-            double rval_value = rval_lit -> get_float_value();
-            if(lval_value == rval_value)
-                return true_final_expr;
-            else
-                return false_final_expr;
-        }
-        else {
-            std::string lval_value = lval_lit -> get_string_value();
-            std::string rval_value = rval_lit -> get_string_value();
-            if(lval_value == rval_value)
-                return true_final_expr;
-            else
-                return false_final_expr;
-        }
-    }
+                if(value -> is_call_expression() == false)
+                    return false;
 
-    std::shared_ptr<expr> interpreter::interpret_identifier_match(std::shared_ptr<expr>& lval_expr, std::shared_ptr<expr>& rval, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
-        // bool type
-        avalon_bool avl_bool;
-        type_instance bool_instance = avl_bool.get_type_instance();
+                std::shared_ptr<call_expression> const & value_call = std::static_pointer_cast<call_expression>(value);
+                std::vector<std::pair<token, std::shared_ptr<expr> > >& value_args = value_call -> get_arguments();
+                if(value_args.size() != node.m_arity || value_call -> get_name() != node.m_name)
+                    return false;
 
-        // true expression
-        std::shared_ptr<identifier_expression> true_expr = std::make_shared<identifier_expression>(true_cons_tok);
-        true_expr -> set_type_instance(bool_instance);
-        true_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        std::shared_ptr<expr> true_final_expr = true_expr;
+                for(auto& value_arg : value_args) {
+                    if(match_pattern_node(nodes, pos, value_arg.second, l_scope, ns_name) == false)
+                        return false;
+                }
+                return true;
+            }
 
-        // false expression
-        std::shared_ptr<identifier_expression> false_expr = std::make_shared<identifier_expression>(false_cons_tok);
-        false_expr -> set_type_instance(bool_instance);
-        false_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        std::shared_ptr<expr> false_final_expr = false_expr;
+            case pattern_node_kind::CAPTURE: {
+                // if we are capturing a reference expression, we must avoid performing a second interpretation
+                // this is because if we do, the interpret_reference function will wrap the reference expression inside the <Just> constructor defeating the whole point of pattern matching
+                if(value -> is_reference_expression()) {
+                    node.m_variable -> set_value(value);
+                }
+                else {
+                    std::shared_ptr<expr> var_value = interpret_expression(value, l_scope, ns_name);
+                    node.m_variable -> set_value(var_value);
+                }
+                return true;
+            }
 
-        // if the rval is not an identifier expression, we return false
-        if(rval -> is_identifier_expression() == false)
-            return false_final_expr;
+            case pattern_node_kind::NAMESPACED: {
+                if(value -> is_binary_expression() == false)
+                    return false;
 
-        // if it is, we compare both
-        std::shared_ptr<identifier_expression> const & lval_id = std::static_pointer_cast<identifier_expression>(lval_expr);
-        std::shared_ptr<identifier_expression> const & rval_id = std::static_pointer_cast<identifier_expression>(rval);
-        if(lval_id -> get_name() != rval_id -> get_name())
-            return false_final_expr;
-        else
-            return true_final_expr;
+                std::shared_ptr<binary_expression> const & value_bin = std::static_pointer_cast<binary_expression>(value);
+                return match_pattern_node(nodes, pos, value_bin -> get_rval(), l_scope, ns_name);
+            }
+        }
+
+        return false;
     }
 
-    std::shared_ptr<expr> interpreter::interpret_call_match(std::shared_ptr<expr>& lval_expr, std::shared_ptr<expr>& rval, std::shared_ptr<scope>& l_scope, const std::string& ns_name) {
-        // bool type
-        avalon_bool avl_bool;
-        type_instance bool_instance = avl_bool.get_type_instance();
+    /**
+     * get_maybe_result
+     * returns the maybe type instance and None value subscripts and references produce for elements of the given type instance
+     * both are built the first time an element type instance is seen and shared by every later subscript or reference on it
+     * the element type instance is interned once so later lookups only compare addresses
+     */
+    maybe_result& interpreter::get_maybe_result(type_instance& element_instance, bool by_reference) {
+        static avalon_ref avl_ref;
+        static avalon_maybe avl_maybe;
 
-        // true expression
-        std::shared_ptr<identifier_expression> true_expr = std::make_shared<identifier_expression>(true_cons_tok);
-        true_expr -> set_type_instance(bool_instance);
-        true_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        std::shared_ptr<expr> true_final_expr = true_expr;
+        if(element_instance.get_canonical() == nullptr)
+            element_instance.intern();
 
-        // false expression
-        std::shared_ptr<identifier_expression> false_expr = std::make_shared<identifier_expression>(false_cons_tok);
-        false_expr -> set_type_instance(bool_instance);
-        false_expr -> set_expression_type(CONSTRUCTOR_EXPR);
-        std::shared_ptr<expr> false_final_expr = false_expr;
+        // element type instances that cannot be interned are not complete, we never expect them at runtime
+        const type_instance * canonical = element_instance.get_canonical();
+        if(canonical == nullptr)
+            throw interpretation_error(element_instance.get_token(), "[compiler error] expected a complete type instance for the elements of a list or map.");
 
-        // if the rval is not a call expression, we return false
-        if(rval -> is_call_expression() == false)
-            return false_final_expr;
+        auto it = m_maybe_results.find(std::make_pair(canonical, by_reference));
+        if(it != m_maybe_results.end())
+            return it -> second;
 
-        // if it is, we compare both
-        std::shared_ptr<call_expression> const & lval_call = std::static_pointer_cast<call_expression>(lval_expr);
-        std::shared_ptr<call_expression> const & rval_call = std::static_pointer_cast<call_expression>(rval);
-        
-        // return false if they have different names
-        if(lval_call -> get_name() != rval_call -> get_name())
-            return false_final_expr;
-
-        // return false if they have different number of arguments
-        std::vector<std::pair<token, std::shared_ptr<expr> > >& lval_args = lval_call -> get_arguments();
-        std::vector<std::pair<token, std::shared_ptr<expr> > >& rval_args = rval_call -> get_arguments();
-        if(lval_args.size() != rval_args.size())
-            return false_final_expr;
-
-        // compare arguments while capturing variables where necessary
-        auto lval_it = lval_args.begin(), lval_end = lval_args.end();
-        auto rval_it = rval_args.begin(), rval_end = rval_args.end();
-        for(; lval_it != lval_end && rval_it != rval_end; ++lval_it, ++rval_it) {
-            // if the rval argument is an underscore expression, we move on
-            if(rval_it -> second -> is_underscore_expression()) {
-                continue;
-            }
-            // if it is a literal, we compare both
-            else if(rval_it -> second -> is_literal_expression()) {
-                std::shared_ptr<expr> res = interpret_literal_match(lval_it -> second, rval_it -> second, l_scope, ns_name);
-                if(res -> expr_token() == false_cons_tok)
-                    return false_final_expr;
-            }
-            // if it is an identifier expression, it could be a variable or a constructor
-            else if(rval_it -> second -> is_identifier_expression()) {
-                std::shared_ptr<identifier_expression> const & rval_id = std::static_pointer_cast<identifier_expression>(rval_it -> second);
-                // we have a constructor, we compare the names
-                if(rval_id -> get_expression_type() == CONSTRUCTOR_EXPR) {
-                    std::shared_ptr<expr> res = interpret_identifier_match(lval_it -> second, rval_it -> second, l_scope, ns_name);
-                    if(res -> expr_token() == false_cons_tok)
-                        return false_final_expr;
-                }
-                // we have variable, we put the lval value into it
-                else {
-                    std::shared_ptr<variable>& var_decl = l_scope -> get_variable(rval_id -> get_namespace(), rval_id -> get_name());
-
-                    // if we are capturing a reference expression, we must avoid performing a second interpretation
-                    // this is because if we do, the interpret_reference function will wrap the reference expression inside the <Just> constructor defeating the whole point of pattern matching
-                    if(lval_it -> second -> is_reference_expression()) {
-                        var_decl -> set_value(lval_it -> second);
-                    }
-                    else {
-                        std::shared_ptr<expr> var_value = interpret_expression(lval_it -> second, l_scope, ns_name);
-                        var_decl -> set_value(var_value);
-                    }
-                }
-            }
-            // we have a call expression, then we perform a recursive call to this function
-            else if(rval_it -> second -> is_call_expression()) {
-                std::shared_ptr<expr> res = interpret_call_match(lval_it -> second, rval_it -> second, l_scope, ns_name);
-                if(res -> expr_token() == false_cons_tok)
-                    return false_final_expr;
-            }
-            // if we have a binary expression, we check the rval as usual above because the lval of the binary expression is just the namespace
-            else if(rval_it -> second -> is_binary_expression()) {
-                if(lval_it -> second -> is_binary_expression() == false)
-                    return false_final_expr;
-
-                std::shared_ptr<binary_expression> const & lval_bin = std::static_pointer_cast<binary_expression>(lval_it -> second);
-                std::shared_ptr<binary_expression> const & rval_bin = std::static_pointer_cast<binary_expression>(rval_it -> second);
-                std::shared_ptr<expr>& lbin_rval = lval_bin -> get_rval();
-                std::shared_ptr<expr>& rbin_rval = rval_bin -> get_rval();
-
-                // if both the lval and rval are identifier expression
-                if(lbin_rval -> is_identifier_expression() == true && rbin_rval -> is_identifier_expression() == true) {
-                    std::shared_ptr<expr> res = interpret_identifier_match(lbin_rval, rbin_rval, l_scope, ns_name);
-                    if(res -> expr_token() == false_cons_tok)
-                        return false_final_expr;
-                }
-                // in case both are call expressions
-                else if(lbin_rval -> is_call_expression() == true && rbin_rval -> is_call_expression() == true) {
-                    std::shared_ptr<expr> res = interpret_call_match(lbin_rval, rbin_rval, l_scope, ns_name);
-                    if(res -> expr_token() == false_cons_tok)
-                        return false_final_expr;
-                }
-                // anything else is wrong
-                else {
-                    throw interpretation_error(rval_bin -> get_token(), "[compiler error] unexpected binary expression in match expression.");
-                }
-            }
+        maybe_result& result = m_maybe_results[std::make_pair(canonical, by_reference)];
+        if(by_reference) {
+            type_instance ref_instance = avl_ref.get_type_instance(element_instance);
+            result.m_maybe_instance = avl_maybe.get_type_instance(ref_instance);
+        }
+        else {
+            result.m_maybe_instance = avl_maybe.get_type_instance(element_instance);
         }
 
-        // if we reached here then everything checked out
-        return true_final_expr;
+        std::shared_ptr<identifier_expression> none_expr = std::make_shared<identifier_expression>(none_cons_tok);
+        none_expr -> set_type_instance(result.m_maybe_instance);
+        none_expr -> set_expression_type(CONSTRUCTOR_EXPR);
+        result.m_none = none_expr;
+        return result;
     }
 
     /**
@@ -1901,85 +1873,6 @@ interpreter::interpreter(gtable& gtab, error& error_handler) : m_error_handler(e
         return value;
     }
 
-    /**
-     * import_declarations
-     * we imports immediate declarations into the given program scope from the imported scope
-     */
-    void interpreter::import_declarations() {
-        std::unordered_map<std::string, program>& progs = m_gtable.get_programs();
-
-        for(auto& prog : progs) {
-            std::vector<std::shared_ptr<decl> >& declarations = prog.second.get_declarations();
-            for(auto& declaration : declarations) {
-                // perform the import of declared imports
-                if(declaration -> is_import()) {
-                    const std::shared_ptr<import>& import_decl = std::static_pointer_cast<import>(declaration);
-                    program& imported_prog = m_gtable.get_program(import_decl -> get_fqn_name());
-                    import_declarations(imported_prog, prog.second);
-                }
-            }
-        }
-    }
-
-    void interpreter::import_declarations(program& from, program& to) {
-        // declarations defined in from with hope of find namespaces with declarations in them
-        std::vector<std::shared_ptr<decl> >& declarations = from.get_declarations();
-        std::vector<std::shared_ptr<ns> > namespace_decls;
-        // the scope into which to insert the found declarations
-        std::shared_ptr<scope>& to_scope = to.get_scope();
-
-        // we get all the namespaces defined in the "from" program        
-        for(auto& declaration : declarations) {
-            if(declaration -> is_namespace()) {
-                std::shared_ptr<ns> namespace_decl = std::static_pointer_cast<ns>(declaration);
-                namespace_decls.push_back(namespace_decl);
-                to_scope -> add_namespace(namespace_decl -> get_name());
-            }
-        }
-
-        // go over the namespaces and insert the public declarations found in them into the "to" scope
-        for(auto& namespace_decl : namespace_decls) {
-            std::vector<std::shared_ptr<decl> >& l_declarations = namespace_decl -> get_declarations();
-            for(auto& l_declaration : l_declarations) {
-                const std::string& namespace_name = namespace_decl -> get_name();
-                if(l_declaration -> is_type()) {
-                    std::shared_ptr<type> type_decl = std::static_pointer_cast<type>(l_declaration);
-                    if(type_decl -> is_public()) {
-                        try {
-                            to_scope -> add_type(namespace_name, type_decl);
-                        } catch(symbol_already_declared err) {
-                            throw interpretation_error(type_decl -> get_token(), err.what());
-                        }
-                    }
-                }
-                else if(l_declaration -> is_function()) {
-                    std::shared_ptr<function> function_decl = std::static_pointer_cast<function>(l_declaration);
-                    if(function_decl -> is_public()) {
-                        try {
-                            to_scope -> add_function(namespace_name, function_decl);
-                        } catch(symbol_already_declared err) {
-                            throw interpretation_error(function_decl -> get_token(), err.what());
-                        }
-                    }
-                }
-                else if(l_declaration -> is_variable()) {
-                    std::shared_ptr<variable> variable_decl = std::static_pointer_cast<variable>(l_declaration);
-                    if(variable_decl -> is_public()) {
-                        try {
-                            to_scope -> add_variable(namespace_name, variable_decl);
-                        } catch(symbol_already_declared err) {
-                            throw interpretation_error(variable_decl -> get_token(), err.what());
-                        }
-                    }
-                }
-                else {
-                    throw std::runtime_error("Unknown declaration found in program.");
-                }
-            }
-        }
-    }
-
-
     /**
      * interpretation_error
      * contructs and returns a interpret_error exception
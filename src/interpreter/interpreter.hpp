@@ -25,11 +25,15 @@
 #ifndef AVALON_INTERPRETER_INTERPRETER_HPP_
 #define AVALON_INTERPRETER_INTERPRETER_HPP_
 
+#include <unordered_map>
 #include <stdexcept>
 #include <utility>
+#include <cstddef>
 #include <memory>
 #include <vector>
 #include <string>
+#include <deque>
+#include <map>
 
 /* Error */
 #include "error/error.hpp"
@@ -47,6 +51,7 @@
 /* Expressions */
 #include "representer/ast/expr/reference_expression.hpp"
 #include "representer/ast/expr/binary_expression.hpp"
+#include "representer/ast/expr/match_pattern.hpp"
 #include "representer/ast/expr/expr.hpp"
 
 /* Symtable */
@@ -56,6 +61,10 @@
 /* Quantum processor */
 #include "interpreter/qprocessor.hpp"
 
+/* Builtin functions */
+#include "interpreter/builtins/avalon_function.hpp"
+#include "interpreter/builtins/lang/avalon_map.hpp"
+
 
 namespace avalon {
     class interpret_error : public std::runtime_error {
@@ -96,7 +105,19 @@ namespace avalon {
         token m_tok;
     };
 
-    class interpreter {
+    /**
+     * maybe_result
+     * the maybe type instance and the None value subscripts and references produce for a given element type instance
+     */
+    struct maybe_result {
+        /* the maybe type instance of the results */
+        type_instance m_maybe_instance;
+
+        /* the None value returned when the site fails to find an element */
+        std::shared_ptr<expr> m_none;
+    };
+
+    class interpreter : public map_hasher {
     public:
         /**
          * the constructor expects:
@@ -111,6 +132,18 @@ namespace avalon {
          */
         void interpret(std::vector<std::string>& arguments);
 
+        /**
+         * hash_key
+         * calls the given user defined __hash__ function on a map key and returns the integer it produced
+         */
+        std::size_t hash_key(std::shared_ptr<function>& hash_function, std::shared_ptr<expr>& key);
+
+        /**
+         * compare_keys
+         * calls the given user defined __eq__ function on two map keys and returns the boolean it produced
+         */
+        bool compare_keys(std::shared_ptr<function>& comp_function, std::shared_ptr<expr>& key, std::shared_ptr<expr>& other);
+
     private:
         /**
          * interpret_program
@@ -163,6 +196,12 @@ namespace avalon {
          */
         std::pair<bool, std::shared_ptr<expr> > interpret_while(std::shared_ptr<stmt>& a_statement, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
 
+        /**
+         * interpret_for
+         * given a for statement, we walk the iterable container directly and run the body once per element
+         */
+        std::pair<bool, std::shared_ptr<expr> > interpret_for(std::shared_ptr<stmt>& a_statement, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
+
         /**
          * interpret_if
          * given an if statemnt, we make choices
@@ -291,6 +330,7 @@ namespace avalon {
         std::shared_ptr<expr> interpret_custom_attribute(std::shared_ptr<binary_expression> const & bin_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
         std::shared_ptr<expr> interpret_variable_subscript(std::shared_ptr<binary_expression> const & bin_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
         std::shared_ptr<expr> interpret_tuple_subscript(std::shared_ptr<binary_expression> const & bin_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
+        std::shared_ptr<expr> interpret_tuple_element(std::shared_ptr<variable>& var_decl, std::size_t index, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
         std::shared_ptr<expr> interpret_list_subscript(std::shared_ptr<binary_expression> const & bin_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
         std::shared_ptr<expr> interpret_map_subscript(std::shared_ptr<binary_expression> const & bin_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
         std::shared_ptr<expr> interpret_custom_subscript(std::shared_ptr<binary_expression> const & bin_expr, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
@@ -300,9 +340,19 @@ namespace avalon {
          * compare the lval to the rval and update the values of any variables if any captures were requested
          */
         std::shared_ptr<expr> interpret_match(std::shared_ptr<expr>& an_expression, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
-        std::shared_ptr<expr> interpret_literal_match(std::shared_ptr<expr>& lval_expr, std::shared_ptr<expr>& rval, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
-        std::shared_ptr<expr> interpret_identifier_match(std::shared_ptr<expr>& lval_expr, std::shared_ptr<expr>& rval, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
-        std::shared_ptr<expr> interpret_call_match(std::shared_ptr<expr>& lval_expr, std::shared_ptr<expr>& rval, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
+
+        /**
+         * match_pattern_node
+         * performs the test at the given position against the given value then the tests of its arguments if the value is a constructor call
+         */
+        bool match_pattern_node(std::vector<pattern_node>& nodes, std::size_t& pos, std::shared_ptr<expr>& value, std::shared_ptr<scope>& l_scope, const std::string& ns_name);
+
+        /**
+         * get_maybe_result
+         * returns the maybe type instance and None value subscripts and references produce for elements of the given type instance
+         * if by_reference is true, the maybe wraps references to the elements instead of the elements themselves
+         */
+        maybe_result& get_maybe_result(type_instance& element_instance, bool by_reference);
 
         /**
          * interpret_conditional
@@ -331,6 +381,27 @@ namespace avalon {
          */
         std::shared_ptr<qprocessor> m_qproc;
 
+        /*
+         * the implementations of builtin functions
+         */
+        std::unique_ptr<avalon_function> m_builtins;
+
+        /*
+         * argument vectors handed to called functions, one per call depth so they keep their capacity across calls
+         */
+        std::deque<std::vector<std::shared_ptr<expr> > > m_argument_stack;
+
+        /*
+         * the number of argument vectors currently in use
+         */
+        std::size_t m_call_depth;
+
+        /*
+         * maybe results keyed by the interned element type instance and whether they wrap references.
+         * there is at most one entry per element type instance the program uses.
+         */
+        std::map<std::pair<const type_instance *, bool>, maybe_result> m_maybe_results;
+
         /*
          * flag set to true if we are to continue to the next line
          */
@@ -341,13 +412,6 @@ namespace avalon {
          */
         bool m_break_loop;
 
-        /**
-         * import_declarations
-         * we imports immediate declarations into the given program scope from the imported scope
-         */
-        void import_declarations();
-        void import_declarations(program& from, program& to);
-
         /**
          * interpretation_error
          * contructs and returns a interpret_error exception
@@ -0,0 +1,175 @@
+/*
+ *  This file is part of the Avalon programming language
+ * 
+ *  Copyright (c) 2018 Ntwali Bashige Toussaint
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include <cstddef>
+#include <cstring>
+#include <cstdlib>
+#include <cstdio>
+#include <cerrno>
+#include <memory>
+
+#include <unistd.h>
+
+/* Utilities */
+#include "utils/shared_string.hpp"
+
+/* Output buffer */
+#include "interpreter/output_buffer.hpp"
+
+
+namespace avalon {
+/*
+ * the size of the staging buffer used when the output is unbuffered
+ */
+static const std::size_t unbuffered_capacity = 4096;
+
+/**
+ * flush_at_exit
+ * flushes the output buffer when the process exits normally
+ */
+static void flush_at_exit() {
+    output_buffer::flush();
+}
+
+std::unique_ptr<char[]> output_buffer::m_buffer;
+std::size_t output_buffer::m_size = 0;
+std::size_t output_buffer::m_capacity = output_buffer::default_capacity;
+output_mode output_buffer::m_mode = output_mode::FULL;
+bool output_buffer::m_mode_set = false;
+
+    /**
+     * set_capacity
+     * fully buffers the output using a buffer of the given size, a size of zero disables buffering
+     */
+    void output_buffer::set_capacity(std::size_t capacity) {
+        if(capacity == 0) {
+            set_unbuffered();
+            return;
+        }
+
+        flush();
+        m_buffer.reset();
+        m_capacity = capacity;
+        m_mode = output_mode::FULL;
+        m_mode_set = true;
+    }
+
+    /**
+     * set_unbuffered
+     * writes the output as soon as it is printed
+     */
+    void output_buffer::set_unbuffered() {
+        flush();
+        m_buffer.reset();
+        m_capacity = unbuffered_capacity;
+        m_mode = output_mode::NONE;
+        m_mode_set = true;
+    }
+
+    /**
+     * write
+     * appends the given string to the buffer and returns the number of characters written
+     */
+    std::size_t output_buffer::write(const shared_string& str) {
+        if(!m_buffer)
+            reserve();
+
+        std::size_t length = str.length();
+        bool new_line = false;
+        for(std::size_t pos = 0; pos < length;) {
+            if(m_size == m_capacity)
+                flush();
+
+            std::size_t count = str.copy(m_buffer.get() + m_size, m_capacity - m_size, pos);
+            if(m_mode == output_mode::LINE && new_line == false)
+                new_line = std::memchr(m_buffer.get() + m_size, '\n', count) != nullptr;
+            m_size += count;
+            pos += count;
+        }
+
+        if(m_mode == output_mode::NONE || new_line)
+            flush();
+        return length;
+    }
+
+    /**
+     * put
+     * appends the given character to the buffer
+     */
+    void output_buffer::put(char c) {
+        if(!m_buffer)
+            reserve();
+
+        if(m_size == m_capacity)
+            flush();
+        m_buffer[m_size++] = c;
+
+        if(m_mode == output_mode::NONE || (m_mode == output_mode::LINE && c == '\n'))
+            flush();
+    }
+
+    /**
+     * flush
+     * writes whatever is in the buffer to standard output
+     */
+    void output_buffer::flush() {
+        if(m_size == 0)
+            return;
+
+        // whatever went through stdio before us goes out first
+        std::fflush(stdout);
+
+        const char * data = m_buffer.get();
+        std::size_t left = m_size;
+        while(left > 0) {
+            ssize_t written = ::write(STDOUT_FILENO, data, left);
+            if(written < 0) {
+                if(errno == EINTR)
+                    continue;
+                // there is nobody to report to if standard output is gone so we drop the output
+                break;
+            }
+            data += written;
+            left -= written;
+        }
+        m_size = 0;
+    }
+
+    /**
+     * reserve
+     * allocates the buffer and picks the output mode before the first write
+     */
+    void output_buffer::reserve() {
+        static bool registered = false;
+        if(registered == false) {
+            std::atexit(flush_at_exit);
+            registered = true;
+        }
+
+        if(m_mode_set == false)
+            m_mode = ::isatty(STDOUT_FILENO) ? output_mode::LINE : output_mode::FULL;
+        m_buffer.reset(new char[m_capacity]);
+        m_size = 0;
+    }
+}
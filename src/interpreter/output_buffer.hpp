@@ -0,0 +1,110 @@
+/*
+ *  This file is part of the Avalon programming language
+ * 
+ *  Copyright (c) 2018 Ntwali Bashige Toussaint
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#ifndef AVALON_INTERPRETER_OUTPUT_BUFFER_HPP_
+#define AVALON_INTERPRETER_OUTPUT_BUFFER_HPP_
+
+#include <cstddef>
+#include <memory>
+
+/* Utilities */
+#include "utils/shared_string.hpp"
+
+
+namespace avalon {
+    /**
+     * output_mode
+     * when the output buffer is written to standard output
+     */
+    enum class output_mode {
+        FULL,       // when the buffer fills up
+        LINE,       // whenever a new line is written, the default when standard output is a terminal
+        NONE        // after every write
+    };
+
+    /**
+     * output_buffer
+     * collects what programs print and writes it to standard output in large batches instead of once per print.
+     * the buffer is flushed before reading from standard input, when the interpreter is done and at exit.
+     */
+    class output_buffer {
+    public:
+        /**
+         * set_capacity
+         * fully buffers the output using a buffer of the given size, a size of zero disables buffering
+         */
+        static void set_capacity(std::size_t capacity);
+
+        /**
+         * set_unbuffered
+         * writes the output as soon as it is printed
+         */
+        static void set_unbuffered();
+
+        /**
+         * write
+         * appends the given string to the buffer and returns the number of characters written
+         */
+        static std::size_t write(const shared_string& str);
+
+        /**
+         * put
+         * appends the given character to the buffer
+         */
+        static void put(char c);
+
+        /**
+         * flush
+         * writes whatever is in the buffer to standard output
+         */
+        static void flush();
+
+        /*
+         * the size of the buffer when none is given
+         */
+        static const std::size_t default_capacity = 64 * 1024;
+
+    private:
+        /**
+         * reserve
+         * allocates the buffer and picks the output mode before the first write
+         */
+        static void reserve();
+
+        /*
+         * the buffer and how much of it is in use
+         */
+        static std::unique_ptr<char[]> m_buffer;
+        static std::size_t m_size;
+        static std::size_t m_capacity;
+
+        /*
+         * when the buffer is flushed and whether the mode was picked by the user
+         */
+        static output_mode m_mode;
+        static bool m_mode_set;
+    };
+}
+
+#endif
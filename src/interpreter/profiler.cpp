@@ -0,0 +1,180 @@
+/*
+ *  This file is part of the Avalon programming language
+ * 
+ *  Copyright (c) 2018 Ntwali Bashige Toussaint
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include <unordered_map>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <cstdint>
+#include <cstddef>
+#include <chrono>
+#include <vector>
+#include <string>
+#include <map>
+
+/* AST */
+#include "representer/ast/decl/function.hpp"
+
+/* Utils */
+#include "utils/stats.hpp"
+
+/* Profiler */
+#include "interpreter/profiler.hpp"
+
+
+namespace avalon {
+/**
+ * now
+ * returns a monotonic time in seconds
+ */
+static double now() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool profiler::m_enabled = false;
+
+    /**
+     * enable
+     * turns on profiling, the collapsed stacks will be written to the given path
+     */
+    void profiler::enable(const std::string& folded_path) {
+        get_instance().m_folded_path = folded_path;
+        m_enabled = true;
+    }
+
+    /**
+     * enter
+     * records entering the given function
+     */
+    void profiler::enter(const function& fun) {
+        profiler& prof = get_instance();
+
+        // find the function entry, creating it if this is the first call
+        auto it = prof.m_indices.find(& fun);
+        std::size_t index = 0;
+        if(it == prof.m_indices.end()) {
+            // specializations already carry a mangled name, other functions need to be mangled
+            const std::string& name = fun.get_name();
+            entry new_entry;
+            new_entry.m_name = name.find('(') == std::string::npos ? mangle_function(fun) : name;
+            new_entry.m_calls = 0;
+            new_entry.m_depth = 0;
+            new_entry.m_inclusive = 0;
+            new_entry.m_exclusive = 0;
+            new_entry.m_allocations = 0;
+            index = prof.m_entries.size();
+            prof.m_entries.push_back(new_entry);
+            prof.m_indices.emplace(& fun, index);
+        }
+        else {
+            index = it -> second;
+        }
+
+        entry& fun_entry = prof.m_entries[index];
+        fun_entry.m_calls++;
+        fun_entry.m_depth++;
+
+        frame new_frame;
+        new_frame.m_entry = index;
+        new_frame.m_path = prof.m_frames.empty() ? fun_entry.m_name : prof.m_frames.back().m_path + ";" + fun_entry.m_name;
+        new_frame.m_children = 0;
+        new_frame.m_children_objects = 0;
+        new_frame.m_start_objects = stats::get_objects();
+        new_frame.m_start = now();
+        prof.m_frames.push_back(new_frame);
+    }
+
+    /**
+     * leave
+     * records leaving the function entered last
+     */
+    void profiler::leave() {
+        double end = now();
+        profiler& prof = get_instance();
+        if(prof.m_frames.empty())
+            return;
+
+        frame& last = prof.m_frames.back();
+        entry& fun_entry = prof.m_entries[last.m_entry];
+        double inclusive = end - last.m_start;
+        double exclusive = inclusive - last.m_children;
+        std::uint64_t objects = stats::get_objects() - last.m_start_objects;
+
+        // recursive calls are already accounted for by the outermost call as far as inclusive time goes
+        fun_entry.m_depth--;
+        if(fun_entry.m_depth == 0)
+            fun_entry.m_inclusive += inclusive;
+        fun_entry.m_exclusive += exclusive;
+        fun_entry.m_allocations += objects - last.m_children_objects;
+        prof.m_stacks[last.m_path] += exclusive;
+
+        prof.m_frames.pop_back();
+        if(prof.m_frames.empty() == false) {
+            prof.m_frames.back().m_children += inclusive;
+            prof.m_frames.back().m_children_objects += objects;
+        }
+    }
+
+    /**
+     * report
+     * prints the functions sorted by exclusive time and writes the collapsed stacks to the file given when enabling the profiler
+     */
+    void profiler::report(std::ostream& os) {
+        profiler& prof = get_instance();
+
+        std::vector<entry> entries = prof.m_entries;
+        std::sort(entries.begin(), entries.end(), [](const entry& a, const entry& b) {
+            return a.m_exclusive > b.m_exclusive;
+        });
+
+        std::ios::fmtflags flags = os.flags();
+        std::streamsize precision = os.precision();
+        os << std::fixed << std::setprecision(6);
+        os << std::setw(12) << "calls" << std::setw(16) << "inclusive (s)" << std::setw(16) << "exclusive (s)" << std::setw(14) << "allocations" << "  function" << std::endl;
+        for(auto& fun_entry : entries)
+            os << std::setw(12) << fun_entry.m_calls << std::setw(16) << fun_entry.m_inclusive << std::setw(16) << fun_entry.m_exclusive << std::setw(14) << fun_entry.m_allocations << "  " << fun_entry.m_name << std::endl;
+        os.flags(flags);
+        os.precision(precision);
+
+        // the collapsed stacks are weighted by microseconds of exclusive time
+        std::ofstream folded(prof.m_folded_path);
+        if(!folded) {
+            os << "Failed to write the collapsed stacks to <" << prof.m_folded_path << ">." << std::endl;
+            return;
+        }
+        for(auto& stack : prof.m_stacks)
+            folded << stack.first << " " << static_cast<std::uint64_t>(stack.second * 1e6 + 0.5) << std::endl;
+        os << "Collapsed stacks written to <" << prof.m_folded_path << ">." << std::endl;
+    }
+
+    /**
+     * get_instance
+     * returns the only profiler instance
+     */
+    profiler& profiler::get_instance() {
+        static profiler instance;
+        return instance;
+    }
+}
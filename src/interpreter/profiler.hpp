@@ -0,0 +1,161 @@
+/*
+ *  This file is part of the Avalon programming language
+ * 
+ *  Copyright (c) 2018 Ntwali Bashige Toussaint
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#ifndef AVALON_INTERPRETER_PROFILER_HPP_
+#define AVALON_INTERPRETER_PROFILER_HPP_
+
+#include <unordered_map>
+#include <iostream>
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <string>
+#include <map>
+
+/* AST */
+#include "representer/ast/decl/function.hpp"
+
+
+namespace avalon {
+    /**
+     * profiler
+     * records how many times each function is called, the time spent in it and the objects it allocates.
+     * it is enabled with "--profile" and costs a single branch per function call otherwise.
+     */
+    class profiler {
+    public:
+        /**
+         * enable
+         * turns on profiling, the collapsed stacks will be written to the given path
+         */
+        static void enable(const std::string& folded_path);
+
+        /**
+         * is_enabled
+         * returns true if function calls are being profiled
+         */
+        static bool is_enabled() {
+            return m_enabled;
+        }
+
+        /**
+         * enter
+         * records entering the given function
+         */
+        static void enter(const function& fun);
+
+        /**
+         * leave
+         * records leaving the function entered last
+         */
+        static void leave();
+
+        /**
+         * report
+         * prints the functions sorted by exclusive time and writes the collapsed stacks to the file given when enabling the profiler
+         */
+        static void report(std::ostream& os);
+
+    private:
+        /*
+         * what we know about a single function
+         */
+        struct entry {
+            std::string m_name;
+            std::uint64_t m_calls;
+            std::size_t m_depth;
+            double m_inclusive;
+            double m_exclusive;
+            std::uint64_t m_allocations;
+        };
+
+        /*
+         * a function that is currently running
+         */
+        struct frame {
+            std::size_t m_entry;
+            std::string m_path;
+            double m_start;
+            double m_children;
+            std::uint64_t m_start_objects;
+            std::uint64_t m_children_objects;
+        };
+
+        /**
+         * get_instance
+         * returns the only profiler instance
+         */
+        static profiler& get_instance();
+
+        /*
+         * whether profiling is enabled
+         * this is a plain static so checking it on every call is as cheap as it gets
+         */
+        static bool m_enabled;
+
+        /*
+         * where to write the collapsed stacks
+         */
+        std::string m_folded_path;
+
+        /*
+         * the functions we saw, indexed by their declaration since mangling on every call would be expensive
+         */
+        std::vector<entry> m_entries;
+        std::unordered_map<const function *, std::size_t> m_indices;
+
+        /*
+         * the functions that are currently running, innermost last
+         */
+        std::vector<frame> m_frames;
+
+        /*
+         * the exclusive time spent in each call stack, stacks are semicolon separated function names
+         */
+        std::map<std::string, double> m_stacks;
+    };
+
+    /**
+     * profile_scope
+     * enters the given function on construction and leaves it on destruction, if the profiler is enabled
+     */
+    class profile_scope {
+    public:
+        profile_scope(const std::shared_ptr<function>& fun) : m_active(profiler::is_enabled()) {
+            if(m_active)
+                profiler::enter(* fun);
+        }
+
+        ~profile_scope() {
+            if(m_active)
+                profiler::leave();
+        }
+
+    private:
+        bool m_active;
+    };
+}
+
+#endif
@@ -23,11 +23,21 @@
  */
 
 #include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
 #include <utility>
+#include <complex>
+#include <bitset>
+#include <chrono>
 #include <memory>
 #include <vector>
+#include <string>
 #include <tuple>
 
+#include <Eigen/Dense>
+#include <omp.h>
+
 #include "qpp.h"
 
 /* Error */
@@ -39,6 +49,9 @@
 /* Quantum processor */
 #include "interpreter/qprocessor.hpp"
 
+/* Tracer */
+#include "interpreter/tracer.hpp"
+
 
 namespace avalon {
 /**
@@ -66,10 +79,32 @@ qprocessor_error::qprocessor_error(error& error_handler, const std::string& mess
     }
 
 
+/**
+ * now
+ * returns a monotonic time in seconds
+ */
+static double now() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * the default constructor zeroes all counters
+ */
+qprocessor_stats::qprocessor_stats() : m_single_gates(0), m_controlled_gates(0), m_measurements(0), m_ket_additions(0), m_qubits(0), m_peak_qubits(0), m_peak_state_bytes(0), m_apply_time(0), m_capply_time(0), m_measure_time(0) {
+}
+
+
+/*
+ * gates touching fewer pairs of amplitudes than this are applied by a single thread,
+ * below it starting the threads costs more than they save
+ */
+static const std::int64_t parallel_pairs = 1 << 14;
+
+
 /**
  * The default constructor expects the error handler in case of errors
  */
-qprocessor::qprocessor(error& error_handler) : m_error_handler(error_handler) {
+qprocessor::qprocessor(error& error_handler) : m_error_handler(error_handler), m_length(0) {
 }
 
     /**
@@ -86,15 +121,22 @@ qprocessor::qprocessor(error& error_handler) : m_error_handler(error_handler) {
         m_literals.push_back(lit_expr);
 
         // update the internal ket
+        m_stats.m_ket_additions++;
         if(m_ket.size() == 0) {
             m_ket = l_ket;
             m_length = length;
+            update_state_stats();
+            if(tracer::is_enabled())
+                tracer::allocation(0, m_length - 1);
             return std::make_pair(0, m_length - 1);
         }
         else {
             m_ket = qpp::kron(m_ket, l_ket);
             qpp::idx old_length = m_length;
             m_length += length;
+            update_state_stats();
+            if(tracer::is_enabled())
+                tracer::allocation(old_length, m_length - 1);
             return std::make_pair(old_length, m_length - 1);
         }
     }
@@ -103,25 +145,59 @@ qprocessor::qprocessor(error& error_handler) : m_error_handler(error_handler) {
      * apply
      * applies a unitary gate to kets from the given starting index to the given ending index
      */
-    void qprocessor::apply(qpp::cmat& unitary, qpp::idx start_index, qpp::idx end_index) {
+    void qprocessor::apply(const Eigen::Matrix2cd& unitary, qpp::idx start_index, qpp::idx end_index) {
         // we perform bound checking on register indices
         if(end_index < start_index)
             throw qprocessing_error("[compiler error] the ending register index must be greater or equal to the starting register index.");
 
         // apply the gate to all the kets from the starting index to the ending index
+        // registers wider than a qubit8 are split so the amplitudes gathered at once stay within the cache
+        double start = now();
         qpp::idx current = start_index;
         while(current < end_index + 1) {
-            m_ket = qpp::apply(m_ket, unitary, {current});
-            current += 1;
+            qpp::idx last = std::min(current + 7, end_index);
+            if(current == last)
+                apply_in_place(unitary, current, 0);
+            else
+                apply_register(unitary, current, last);
+            current = last + 1;
         }
+        m_stats.m_single_gates += end_index - start_index + 1;
+        m_stats.m_apply_time += now() - start;
+        if(tracer::is_enabled())
+            tracer::gate(start_index, end_index);
     }
 
     /**
      * capply
      * applies a controlled unitary gate to the target ket given the control index
      */
-    void qprocessor::capply(qpp::cmat& unitary, qpp::idx control_index, qpp::idx target_index) {
-        m_ket = qpp::applyCTRL(m_ket, unitary, {control_index}, {target_index});
+    void qprocessor::capply(const Eigen::Matrix2cd& unitary, qpp::idx control_index, qpp::idx target_index) {
+        std::vector<qpp::idx> control_indices = {control_index};
+        capply(unitary, control_indices, target_index);
+    }
+
+    /**
+     * capply
+     * applies a controlled unitary gate to the target ket, only where all the kets at the given control indices are set
+     */
+    void qprocessor::capply(const Eigen::Matrix2cd& unitary, const std::vector<qpp::idx>& control_indices, qpp::idx target_index) {
+        // we make sure the controls are valid and distinct from each other and from the target
+        qpp::idx control_mask = 0;
+        for(qpp::idx control_index : control_indices) {
+            if(control_index >= m_length)
+                throw qprocessing_error("[compiler error] the control register index is not within the register count upper bound.");
+            if(control_index == target_index || (control_mask & get_mask(control_index)))
+                throw qprocessing_error("[compiler error] the control qubits of a gate must be distinct from each other and from the target qubit.");
+            control_mask |= get_mask(control_index);
+        }
+
+        double start = now();
+        apply_in_place(unitary, target_index, control_mask);
+        m_stats.m_controlled_gates++;
+        m_stats.m_capply_time += now() - start;
+        if(tracer::is_enabled())
+            tracer::controlled_gate(control_indices, target_index);
     }
 
     /**
@@ -146,11 +222,20 @@ qprocessor::qprocessor(error& error_handler) : m_error_handler(error_handler) {
         }
 
         // perform the measurement
+        double start = now();
         auto measurement = qpp::measure_seq(m_ket, indices);
         m_ket = std::get<2>(measurement);
+        m_stats.m_measurements += indices.size();
+        m_stats.m_measure_time += now() - start;
+        if(tracer::is_enabled()) {
+            std::vector<qpp::idx>& outcomes = std::get<0>(measurement);
+            for(std::size_t i = 0; i < indices.size() && i < outcomes.size(); i++)
+                tracer::measurement(indices[i], outcomes[i]);
+        }
 
         // update the length
         m_length -= end_index - start_index + 1;
+        update_state_stats();
 
         // update the literals that are represented into this processor
         for(auto& lit : m_literals) {
@@ -169,6 +254,225 @@ qprocessor::qprocessor(error& error_handler) : m_error_handler(error_handler) {
         return std::get<0>(measurement);
     }
 
+    /**
+     * get_stats
+     * returns the counters describing the work done so far
+     */
+    const qprocessor_stats& qprocessor::get_stats() const {
+        return m_stats;
+    }
+
+    /**
+     * stats_to_json
+     * returns the counters as a json object
+     */
+    std::string qprocessor::stats_to_json() const {
+        std::ostringstream os;
+        os << std::fixed << std::setprecision(6)
+           << "{\"single_gates\": " << m_stats.m_single_gates
+           << ", \"controlled_gates\": " << m_stats.m_controlled_gates
+           << ", \"measurements\": " << m_stats.m_measurements
+           << ", \"ket_additions\": " << m_stats.m_ket_additions
+           << ", \"qubits\": " << m_stats.m_qubits
+           << ", \"peak_qubits\": " << m_stats.m_peak_qubits
+           << ", \"peak_state_bytes\": " << m_stats.m_peak_state_bytes
+           << ", \"apply_time\": " << m_stats.m_apply_time
+           << ", \"capply_time\": " << m_stats.m_capply_time
+           << ", \"measure_time\": " << m_stats.m_measure_time << "}";
+        return os.str();
+    }
+
+    /**
+     * report_stats
+     * prints the counters in human readable form
+     */
+    void qprocessor::report_stats(std::ostream& os) const {
+        std::ios::fmtflags flags = os.flags();
+        std::streamsize precision = os.precision();
+        os << std::fixed << std::setprecision(6)
+           << "single qubit gates applied: " << m_stats.m_single_gates << std::endl
+           << "controlled gates applied:   " << m_stats.m_controlled_gates << std::endl
+           << "qubits measured:            " << m_stats.m_measurements << std::endl
+           << "kets added:                 " << m_stats.m_ket_additions << std::endl
+           << "qubits (current/peak):      " << m_stats.m_qubits << "/" << m_stats.m_peak_qubits << std::endl
+           << "peak state vector bytes:    " << m_stats.m_peak_state_bytes << std::endl
+           << "time in apply (s):          " << m_stats.m_apply_time << std::endl
+           << "time in capply (s):         " << m_stats.m_capply_time << std::endl
+           << "time in measure (s):        " << m_stats.m_measure_time << std::endl;
+        os.flags(flags);
+        os.precision(precision);
+    }
+
+    /**
+     * enable_stats_report
+     * asks the interpreter to print the counters once the program finishes, this is what "--qstats" does
+     */
+    void qprocessor::enable_stats_report() {
+        stats_report_flag() = true;
+    }
+
+    /**
+     * is_stats_report_enabled
+     * returns true if the counters must be printed once the program finishes
+     */
+    bool qprocessor::is_stats_report_enabled() {
+        return stats_report_flag();
+    }
+
+    /**
+     * apply_in_place
+     * updates, in place, the amplitudes of every pair of basis states that differ only at the target index.
+     * only the pairs where all the bits in the control mask are set are updated.
+     */
+    void qprocessor::apply_in_place(const Eigen::Matrix2cd& unitary, qpp::idx target_index, qpp::idx control_mask) {
+        if(target_index >= m_length)
+            throw qprocessing_error("[compiler error] the target register index is not within the register count upper bound.");
+
+        const std::complex<double> u00 = unitary(0, 0), u01 = unitary(0, 1);
+        const std::complex<double> u10 = unitary(1, 0), u11 = unitary(1, 1);
+        qpp::idx stride = get_mask(target_index);
+        qpp::idx size = static_cast<qpp::idx>(m_ket.size());
+        std::complex<double> * amplitudes = m_ket.data();
+        qpp::idx fixed_mask = control_mask | stride;
+        std::int64_t pairs = static_cast<std::int64_t>(size >> std::bitset<64>(fixed_mask).count());
+
+        // large state vectors are split between threads, each pair is found from its number alone
+        // by spreading the number over the bits that are neither control nor target bits
+        if(pairs >= parallel_pairs && omp_get_max_threads() > 1) {
+            std::vector<qpp::idx> fixed_bits;
+            for(qpp::idx rest = fixed_mask; rest != 0; rest &= rest - 1)
+                fixed_bits.push_back(rest & (~rest + 1));
+
+            #pragma omp parallel for
+            for(std::int64_t pair = 0; pair < pairs; pair++) {
+                qpp::idx i = static_cast<qpp::idx>(pair);
+                for(qpp::idx bit : fixed_bits)
+                    i = ((i & ~(bit - 1)) << 1) | (i & (bit - 1));
+                i |= control_mask;
+
+                std::complex<double> a0 = amplitudes[i];
+                std::complex<double> a1 = amplitudes[i + stride];
+                amplitudes[i] = u00 * a0 + u01 * a1;
+                amplitudes[i + stride] = u10 * a0 + u11 * a1;
+            }
+            return;
+        }
+
+        // without controls, the first state of every pair has the target bit cleared and the second has it set
+        if(control_mask == 0) {
+            for(qpp::idx block = 0; block < size; block += 2 * stride) {
+                for(qpp::idx i = block; i < block + stride; i++) {
+                    std::complex<double> a0 = amplitudes[i];
+                    std::complex<double> a1 = amplitudes[i + stride];
+                    amplitudes[i] = u00 * a0 + u01 * a1;
+                    amplitudes[i + stride] = u10 * a0 + u11 * a1;
+                }
+            }
+            return;
+        }
+
+        // with controls, we only visit the pairs where all the control bits are set.
+        // the other bits take every possible value by counting in them while skipping over the control and target bits.
+        qpp::idx free_bits = 0;
+        for(std::int64_t pair = 0; pair < pairs; pair++) {
+            qpp::idx i = free_bits | control_mask;
+            std::complex<double> a0 = amplitudes[i];
+            std::complex<double> a1 = amplitudes[i + stride];
+            amplitudes[i] = u00 * a0 + u01 * a1;
+            amplitudes[i + stride] = u10 * a0 + u11 * a1;
+            free_bits = ((free_bits | fixed_mask) + 1) & ~fixed_mask;
+        }
+    }
+
+    /**
+     * apply_register
+     * applies the same unitary to every qubit from the given starting index to the given ending index in a single pass over the state vector.
+     */
+    void qprocessor::apply_register(const Eigen::Matrix2cd& unitary, qpp::idx start_index, qpp::idx end_index) {
+        if(end_index >= m_length)
+            throw qprocessing_error("[compiler error] the ending register index is not within the register count upper bound.");
+
+        const std::complex<double> u00 = unitary(0, 0), u01 = unitary(0, 1);
+        const std::complex<double> u10 = unitary(1, 0), u11 = unitary(1, 1);
+        qpp::idx width = end_index - start_index + 1;
+        qpp::idx states = static_cast<qpp::idx>(1) << width;
+        qpp::idx stride = get_mask(end_index);
+        qpp::idx size = static_cast<qpp::idx>(m_ket.size());
+        std::complex<double> * amplitudes = m_ket.data();
+
+        // the register occupies contiguous bits so the amplitudes that only differ in those bits are <stride> apart.
+        // we gather them, apply the gate to every qubit of the register while they are at hand then write them back.
+        auto transform = [&](qpp::idx offset, std::vector<std::complex<double> >& block) {
+            for(qpp::idx j = 0; j < states; j++)
+                block[j] = amplitudes[offset + j * stride];
+
+            // the first qubit of the register is the most significant bit of the block position
+            for(qpp::idx bit = states >> 1; bit > 0; bit >>= 1) {
+                for(qpp::idx pair = 0; pair < states; pair += 2 * bit) {
+                    for(qpp::idx j = pair; j < pair + bit; j++) {
+                        std::complex<double> a0 = block[j];
+                        std::complex<double> a1 = block[j + bit];
+                        block[j] = u00 * a0 + u01 * a1;
+                        block[j + bit] = u10 * a0 + u11 * a1;
+                    }
+                }
+            }
+
+            for(qpp::idx j = 0; j < states; j++)
+                amplitudes[offset + j * stride] = block[j];
+        };
+
+        // large state vectors are split between threads, each with its own block.
+        // blocks never share an amplitude and the offset of each is found from its number alone.
+        std::int64_t blocks = static_cast<std::int64_t>(size / states);
+        if(static_cast<std::int64_t>(size >> 1) >= parallel_pairs && omp_get_max_threads() > 1) {
+            #pragma omp parallel
+            {
+                std::vector<std::complex<double> > block(states);
+                #pragma omp for
+                for(std::int64_t number = 0; number < blocks; number++) {
+                    qpp::idx position = static_cast<qpp::idx>(number);
+                    transform((position / stride) * states * stride + position % stride, block);
+                }
+            }
+            return;
+        }
+
+        std::vector<std::complex<double> > block(states);
+        for(qpp::idx tile = 0; tile < size; tile += states * stride) {
+            for(qpp::idx offset = tile; offset < tile + stride; offset++)
+                transform(offset, block);
+        }
+    }
+
+    /**
+     * get_mask
+     * returns the bit that represents the qubit at the given index in the position of a basis state
+     */
+    qpp::idx qprocessor::get_mask(qpp::idx index) const {
+        // the first qubit is the most significant bit of the position, as in quantum++
+        return static_cast<qpp::idx>(1) << (m_length - 1 - index);
+    }
+
+    /**
+     * update_state_stats
+     * records the current qubit count and state vector size, updating the peaks
+     */
+    void qprocessor::update_state_stats() {
+        m_stats.m_qubits = m_length;
+        m_stats.m_peak_qubits = std::max(m_stats.m_peak_qubits, m_length);
+        m_stats.m_peak_state_bytes = std::max<std::size_t>(m_stats.m_peak_state_bytes, m_ket.size() * sizeof(qpp::cplx));
+    }
+
+    /**
+     * stats_report_flag
+     * returns a reference to the flag telling whether to print the counters once the program finishes
+     */
+    bool& qprocessor::stats_report_flag() {
+        static bool enabled = false;
+        return enabled;
+    }
+
     /**
      * qprocessing_error
      * contructs and returns a qprocessor_error exception
@@ -25,9 +25,14 @@
 #ifndef AVALON_INTERPRETER_QPROCESSOR_HPP_
 #define AVALON_INTERPRETER_QPROCESSOR_HPP_
 
+#include <iostream>
+#include <cstdint>
 #include <cstddef>
 #include <memory>
 #include <vector>
+#include <string>
+
+#include <Eigen/Dense>
 
 #include "qpp.h"
 
@@ -67,6 +72,48 @@ namespace avalon {
         error m_error_handler;
     };
 
+    /**
+     * qprocessor_stats
+     * counters describing the work done by the quantum processor
+     */
+    struct qprocessor_stats {
+        qprocessor_stats();
+
+        /*
+         * the number of single qubit gate applications and controlled gate applications
+         */
+        std::uint64_t m_single_gates;
+        std::uint64_t m_controlled_gates;
+
+        /*
+         * the number of measured qubits
+         */
+        std::uint64_t m_measurements;
+
+        /*
+         * the number of times a ket was added to the processor, growing the state vector
+         */
+        std::uint64_t m_ket_additions;
+
+        /*
+         * the current and peak number of qubits in the processor
+         */
+        std::size_t m_qubits;
+        std::size_t m_peak_qubits;
+
+        /*
+         * the peak size of the state vector in bytes
+         */
+        std::size_t m_peak_state_bytes;
+
+        /*
+         * the time spent applying gates, applying controlled gates and measuring, in seconds
+         */
+        double m_apply_time;
+        double m_capply_time;
+        double m_measure_time;
+    };
+
     class qprocessor {
     public:
         /**
@@ -85,13 +132,19 @@ namespace avalon {
          * apply
          * applies a unitary gate to kets from the given starting index to the given ending index
          */
-        void apply(qpp::cmat& unitary, qpp::idx start_index, qpp::idx end_index);
+        void apply(const Eigen::Matrix2cd& unitary, qpp::idx start_index, qpp::idx end_index);
 
         /**
          * capply
          * applies a controlled unitary gate to the target ket given the control index
          */
-        void capply(qpp::cmat& unitary, qpp::idx control_index, qpp::idx target_index);
+        void capply(const Eigen::Matrix2cd& unitary, qpp::idx control_index, qpp::idx target_index);
+
+        /**
+         * capply
+         * applies a controlled unitary gate to the target ket, only where all the kets at the given control indices are set
+         */
+        void capply(const Eigen::Matrix2cd& unitary, const std::vector<qpp::idx>& control_indices, qpp::idx target_index);
 
         /**
          * measure
@@ -99,6 +152,36 @@ namespace avalon {
          */
         std::vector<qpp::idx> measure(qpp::idx start_index, qpp::idx end_index);
 
+        /**
+         * get_stats
+         * returns the counters describing the work done so far
+         */
+        const qprocessor_stats& get_stats() const;
+
+        /**
+         * stats_to_json
+         * returns the counters as a json object
+         */
+        std::string stats_to_json() const;
+
+        /**
+         * report_stats
+         * prints the counters in human readable form
+         */
+        void report_stats(std::ostream& os) const;
+
+        /**
+         * enable_stats_report
+         * asks the interpreter to print the counters once the program finishes, this is what "--qstats" does
+         */
+        static void enable_stats_report();
+
+        /**
+         * is_stats_report_enabled
+         * returns true if the counters must be printed once the program finishes
+         */
+        static bool is_stats_report_enabled();
+
         /**
          * qprocessing_error
          * contructs and returns a qprocessor_error exception
@@ -125,6 +208,42 @@ namespace avalon {
          * vector of literals containing the kets of interest
          */
         std::vector<std::shared_ptr<literal_expression> > m_literals;
+
+        /*
+         * counters describing the work done so far
+         */
+        qprocessor_stats m_stats;
+
+        /**
+         * update_state_stats
+         * records the current qubit count and state vector size, updating the peaks
+         */
+        void update_state_stats();
+
+        /**
+         * apply_in_place
+         * updates, in place, the amplitudes of every pair of basis states that differ only at the target index.
+         * only the pairs where all the bits in the control mask are set are updated.
+         */
+        void apply_in_place(const Eigen::Matrix2cd& unitary, qpp::idx target_index, qpp::idx control_mask);
+
+        /**
+         * apply_register
+         * applies the same unitary to every qubit from the given starting index to the given ending index in a single pass over the state vector.
+         */
+        void apply_register(const Eigen::Matrix2cd& unitary, qpp::idx start_index, qpp::idx end_index);
+
+        /**
+         * get_mask
+         * returns the bit that represents the qubit at the given index in the position of a basis state
+         */
+        qpp::idx get_mask(qpp::idx index) const;
+
+        /**
+         * stats_report_flag
+         * returns a reference to the flag telling whether to print the counters once the program finishes
+         */
+        static bool& stats_report_flag();
     };
 }
 
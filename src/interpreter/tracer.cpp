@@ -0,0 +1,383 @@
+/*
+ *  This file is part of the Avalon programming language
+ * 
+ *  Copyright (c) 2018 Ntwali Bashige Toussaint
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include <unordered_map>
+#include <algorithm>
+#include <iostream>
+#include <fstream>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <string>
+
+/* AST */
+#include "representer/ast/stmt/while_stmt.hpp"
+#include "representer/ast/stmt/for_stmt.hpp"
+#include "representer/ast/decl/function.hpp"
+
+/* Tracer */
+#include "interpreter/tracer.hpp"
+
+
+namespace avalon {
+/*
+ * trace files start with this magic string followed by the format version
+ */
+static const char trace_magic[8] = {'A', 'V', 'L', 'T', 'R', 'A', 'C', 'E'};
+static const std::uint32_t trace_version = 2;
+
+/**
+ * now
+ * returns a monotonic time in nanoseconds
+ */
+static std::uint64_t now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * write_json_string
+ * writes the given string as a JSON string
+ */
+static void write_json_string(std::ostream& os, const std::string& str) {
+    os << '"';
+    for(char c : str) {
+        if(c == '"' || c == '\\')
+            os << '\\' << c;
+        else if(static_cast<unsigned char>(c) < 0x20)
+            os << ' ';
+        else
+            os << c;
+    }
+    os << '"';
+}
+
+bool tracer::m_enabled = false;
+
+    /**
+     * enable
+     * turns on tracing, events will be written to the given path.
+     * returns false if the trace file cannot be created.
+     */
+    bool tracer::enable(const std::string& trace_path) {
+        tracer& trc = get_instance();
+        trc.m_file.open(trace_path, std::ios::binary | std::ios::trunc);
+        if(!trc.m_file)
+            return false;
+
+        trc.m_file.write(trace_magic, sizeof(trace_magic));
+        trc.m_file.write(reinterpret_cast<const char *>(& trace_version), sizeof(trace_version));
+
+        trc.m_buffer.reset(new trace_record[m_capacity]);
+        trc.m_head = 0;
+        trc.m_size = 0;
+        trc.m_dropped = 0;
+        trc.m_name_strings.clear();
+        trc.m_gate_name = trc.define_name("gate");
+        trc.m_controlled_gate_name = trc.define_name("controlled gate");
+        trc.m_measurement_name = trc.define_name("measurement");
+        trc.m_allocation_name = trc.define_name("allocation");
+        trc.m_start = now();
+        m_enabled = true;
+        return true;
+    }
+
+    /**
+     * function_enter
+     * records entering the given function
+     */
+    void tracer::function_enter(const function& fun) {
+        tracer& trc = get_instance();
+        std::uint32_t name = trc.name_of(& fun, [&fun]() {
+            // specializations already carry a mangled name, other functions need to be mangled
+            const std::string& name = fun.get_name();
+            return name.find('(') == std::string::npos ? mangle_function(fun) : name;
+        });
+        trc.record(trace_event_kind::FUNCTION_ENTER, name, 0, 0);
+    }
+
+    /**
+     * function_leave
+     * records leaving the given function
+     */
+    void tracer::function_leave(const function& fun) {
+        tracer& trc = get_instance();
+        // the function was named when we entered it
+        trc.record(trace_event_kind::FUNCTION_LEAVE, trc.m_names[& fun], 0, 0);
+    }
+
+    /**
+     * loop_iteration
+     * records the start of the given iteration of the given while loop
+     */
+    void tracer::loop_iteration(const while_stmt& w_stmt, std::int64_t iteration) {
+        tracer& trc = get_instance();
+        std::uint32_t name = trc.name_of(& w_stmt, [&w_stmt]() {
+            const token& tok = w_stmt.get_token();
+            return "while@" + tok.get_source_path() + ":" + std::to_string(tok.get_line());
+        });
+        trc.record(trace_event_kind::LOOP_ITERATION, name, iteration, 0);
+    }
+
+    /**
+     * loop_iteration
+     * records the start of the given iteration of the given for loop
+     */
+    void tracer::loop_iteration(const for_stmt& f_stmt, std::int64_t iteration) {
+        tracer& trc = get_instance();
+        std::uint32_t name = trc.name_of(& f_stmt, [&f_stmt]() {
+            const token& tok = f_stmt.get_token();
+            return "for@" + tok.get_source_path() + ":" + std::to_string(tok.get_line());
+        });
+        trc.record(trace_event_kind::LOOP_ITERATION, name, iteration, 0);
+    }
+
+    /**
+     * gate
+     * records applying a gate to the qubits from the start index to the end index
+     */
+    void tracer::gate(std::int64_t start_index, std::int64_t end_index) {
+        tracer& trc = get_instance();
+        trc.record(trace_event_kind::GATE, trc.m_gate_name, start_index, end_index);
+    }
+
+    /**
+     * controlled_gate
+     * records applying a gate controlled by all the given control indices to the target index as a single event.
+     * the controls are packed into a mask where bit i is set if the qubit at index i is a control.
+     */
+    void tracer::controlled_gate(const std::vector<std::size_t>& control_indices, std::int64_t target_index) {
+        tracer& trc = get_instance();
+        std::uint64_t control_mask = 0;
+        for(std::size_t control_index : control_indices)
+            control_mask |= std::uint64_t(1) << control_index;
+        trc.record(trace_event_kind::CONTROLLED_GATE, trc.m_controlled_gate_name, static_cast<std::int64_t>(control_mask), target_index);
+    }
+
+    /**
+     * measurement
+     * records measuring the qubit at the given index and the outcome
+     */
+    void tracer::measurement(std::int64_t index, std::int64_t outcome) {
+        tracer& trc = get_instance();
+        trc.record(trace_event_kind::MEASUREMENT, trc.m_measurement_name, index, outcome);
+    }
+
+    /**
+     * allocation
+     * records adding qubits to the processor from the start index to the end index
+     */
+    void tracer::allocation(std::int64_t start_index, std::int64_t end_index) {
+        tracer& trc = get_instance();
+        trc.record(trace_event_kind::ALLOCATION, trc.m_allocation_name, start_index, end_index);
+    }
+
+    /**
+     * finish
+     * writes the names and the events in the ring buffer to the trace file then closes it.
+     * if events were overwritten, says how many on standard error.
+     */
+    void tracer::finish() {
+        if(m_enabled == false)
+            return;
+
+        tracer& trc = get_instance();
+        m_enabled = false;
+
+        // each name is a name record followed by the name itself
+        for(std::uint32_t id = 0; id < trc.m_name_strings.size(); id++) {
+            const std::string& name = trc.m_name_strings[id];
+            trace_record rec;
+            rec.m_time = 0;
+            rec.m_name = id;
+            rec.m_kind = static_cast<std::uint8_t>(trace_event_kind::NAME);
+            rec.m_padding[0] = rec.m_padding[1] = rec.m_padding[2] = 0;
+            rec.m_first = name.size();
+            rec.m_second = 0;
+            trc.m_file.write(reinterpret_cast<const char *>(& rec), sizeof(rec));
+            trc.m_file.write(name.data(), name.size());
+        }
+
+        // the oldest event sits right after the newest one once the ring has wrapped around
+        std::size_t oldest = (trc.m_head + m_capacity - trc.m_size) & (m_capacity - 1);
+        std::size_t first_part = std::min(trc.m_size, m_capacity - oldest);
+        trc.m_file.write(reinterpret_cast<const char *>(trc.m_buffer.get() + oldest), first_part * sizeof(trace_record));
+        trc.m_file.write(reinterpret_cast<const char *>(trc.m_buffer.get()), (trc.m_size - first_part) * sizeof(trace_record));
+        trc.m_file.close();
+        trc.m_buffer.reset();
+
+        if(trc.m_dropped > 0)
+            std::cerr << "The trace buffer holds " << m_capacity << " events, the " << trc.m_dropped << " oldest events were dropped." << std::endl;
+    }
+
+    /**
+     * convert
+     * reads the trace file at the given path and writes it as Chrome trace event JSON on the given stream.
+     * returns false and prints why on the error stream if the trace file cannot be read.
+     */
+    bool tracer::convert(const std::string& trace_path, std::ostream& os, std::ostream& err) {
+        std::ifstream file(trace_path, std::ios::binary);
+        if(!file) {
+            err << "Failed to open the trace file <" << trace_path << ">." << std::endl;
+            return false;
+        }
+
+        char magic[sizeof(trace_magic)];
+        std::uint32_t version = 0;
+        file.read(magic, sizeof(magic));
+        file.read(reinterpret_cast<char *>(& version), sizeof(version));
+        if(!file || std::memcmp(magic, trace_magic, sizeof(magic)) != 0 || version != trace_version) {
+            err << "The file <" << trace_path << "> is not a trace file this version of the compiler understands." << std::endl;
+            return false;
+        }
+
+        // names are resolved once everything is read
+        std::vector<std::string> names;
+        std::vector<trace_record> events;
+        trace_record rec;
+        while(file.read(reinterpret_cast<char *>(& rec), sizeof(rec))) {
+            if(rec.m_kind == static_cast<std::uint8_t>(trace_event_kind::NAME)) {
+                std::string name(static_cast<std::size_t>(rec.m_first), '\0');
+                if(!file.read(& name[0], rec.m_first))
+                    break;
+                if(names.size() <= rec.m_name)
+                    names.resize(rec.m_name + 1);
+                names[rec.m_name] = name;
+            }
+            else {
+                events.push_back(rec);
+            }
+        }
+
+        os << "{\"traceEvents\": [";
+        bool first = true;
+        for(auto& event : events) {
+            trace_event_kind kind = static_cast<trace_event_kind>(event.m_kind);
+            os << (first ? "\n" : ",\n") << "  {\"name\": ";
+            write_json_string(os, event.m_name < names.size() ? names[event.m_name] : "?");
+            os << ", \"pid\": 1, \"tid\": 1, \"ts\": " << event.m_time / 1000 << "." << (event.m_time % 1000) / 100;
+            switch(kind) {
+                case trace_event_kind::FUNCTION_ENTER:
+                    os << ", \"cat\": \"function\", \"ph\": \"B\"}";
+                    break;
+
+                case trace_event_kind::FUNCTION_LEAVE:
+                    os << ", \"cat\": \"function\", \"ph\": \"E\"}";
+                    break;
+
+                case trace_event_kind::LOOP_ITERATION:
+                    os << ", \"cat\": \"loop\", \"ph\": \"i\", \"s\": \"t\", \"args\": {\"iteration\": " << event.m_first << "}}";
+                    break;
+
+                case trace_event_kind::GATE:
+                    os << ", \"cat\": \"quantum\", \"ph\": \"i\", \"s\": \"t\", \"args\": {\"start\": " << event.m_first << ", \"end\": " << event.m_second << "}}";
+                    break;
+
+                case trace_event_kind::CONTROLLED_GATE: {
+                    os << ", \"cat\": \"quantum\", \"ph\": \"i\", \"s\": \"t\", \"args\": {\"controls\": [";
+                    std::uint64_t control_mask = static_cast<std::uint64_t>(event.m_first);
+                    bool first_control = true;
+                    for(std::size_t i = 0; i < 64; i++) {
+                        if(control_mask & (std::uint64_t(1) << i)) {
+                            os << (first_control ? "" : ", ") << i;
+                            first_control = false;
+                        }
+                    }
+                    os << "], \"target\": " << event.m_second << "}}";
+                    break;
+                }
+
+                case trace_event_kind::MEASUREMENT:
+                    os << ", \"cat\": \"quantum\", \"ph\": \"i\", \"s\": \"t\", \"args\": {\"qubit\": " << event.m_first << ", \"outcome\": " << event.m_second << "}}";
+                    break;
+
+                case trace_event_kind::ALLOCATION:
+                    os << ", \"cat\": \"quantum\", \"ph\": \"i\", \"s\": \"t\", \"args\": {\"start\": " << event.m_first << ", \"end\": " << event.m_second << "}}";
+                    break;
+
+                default:
+                    os << ", \"ph\": \"i\", \"s\": \"t\"}";
+                    break;
+            }
+            first = false;
+        }
+        os << "\n], \"displayTimeUnit\": \"ns\"}" << std::endl;
+        return true;
+    }
+
+    /**
+     * get_instance
+     * returns the only tracer instance
+     */
+    tracer& tracer::get_instance() {
+        static tracer instance;
+        return instance;
+    }
+
+    /**
+     * record
+     * appends an event to the ring buffer, overwriting the oldest event if it is full
+     */
+    void tracer::record(trace_event_kind kind, std::uint32_t name, std::int64_t first, std::int64_t second) {
+        trace_record& rec = m_buffer[m_head];
+        m_head = (m_head + 1) & (m_capacity - 1);
+        if(m_size < m_capacity)
+            m_size++;
+        else
+            m_dropped++;
+
+        rec.m_time = now() - m_start;
+        rec.m_name = name;
+        rec.m_kind = static_cast<std::uint8_t>(kind);
+        rec.m_padding[0] = rec.m_padding[1] = rec.m_padding[2] = 0;
+        rec.m_first = first;
+        rec.m_second = second;
+    }
+
+    /**
+     * name_of
+     * returns the identifier of the name of the given object, defining it first if needs be
+     */
+    template<typename Namer>
+    std::uint32_t tracer::name_of(const void * key, Namer namer) {
+        auto it = m_names.find(key);
+        if(it != m_names.end())
+            return it -> second;
+
+        std::uint32_t name = define_name(namer());
+        m_names.emplace(key, name);
+        return name;
+    }
+
+    /**
+     * define_name
+     * keeps the given name until the trace is written and returns the new name identifier
+     */
+    std::uint32_t tracer::define_name(const std::string& name) {
+        m_name_strings.push_back(name);
+        return static_cast<std::uint32_t>(m_name_strings.size() - 1);
+    }
+}
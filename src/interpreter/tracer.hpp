@@ -0,0 +1,250 @@
+/*
+ *  This file is part of the Avalon programming language
+ * 
+ *  Copyright (c) 2018 Ntwali Bashige Toussaint
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#ifndef AVALON_INTERPRETER_TRACER_HPP_
+#define AVALON_INTERPRETER_TRACER_HPP_
+
+#include <unordered_map>
+#include <iostream>
+#include <fstream>
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+/* AST */
+#include "representer/ast/stmt/while_stmt.hpp"
+#include "representer/ast/stmt/for_stmt.hpp"
+#include "representer/ast/decl/function.hpp"
+
+
+namespace avalon {
+    /**
+     * trace_event_kind
+     * the kinds of events the tracer records
+     */
+    enum class trace_event_kind : std::uint8_t {
+        NAME,               // not an event, defines the name of the events that use the same name identifier
+        FUNCTION_ENTER,
+        FUNCTION_LEAVE,
+        LOOP_ITERATION,
+        GATE,
+        CONTROLLED_GATE,
+        MEASUREMENT,
+        ALLOCATION
+    };
+
+    /**
+     * trace_record
+     * a single fixed size record as it is laid out in the trace file
+     */
+    struct trace_record {
+        std::uint64_t m_time;       // nanoseconds since the tracer was enabled
+        std::uint32_t m_name;       // identifier of the name of the event
+        std::uint8_t m_kind;        // one of trace_event_kind
+        std::uint8_t m_padding[3];
+        std::int64_t m_first;       // first argument, the name length for NAME records and the control mask for CONTROLLED_GATE records
+        std::int64_t m_second;      // second argument
+    };
+
+    /**
+     * tracer
+     * records interpreter and quantum processor events into a binary ring buffer that is written to a file once the program finishes.
+     * no file is written while the program runs: when the ring is full, the newest events overwrite the oldest ones.
+     * it is enabled with "--trace" and costs a single branch per hook otherwise.
+     * the trace file can later be converted to the Chrome trace event format with "--trace-json".
+     */
+    class tracer {
+    public:
+        /**
+         * enable
+         * turns on tracing, events will be written to the given path.
+         * returns false if the trace file cannot be created.
+         */
+        static bool enable(const std::string& trace_path);
+
+        /**
+         * is_enabled
+         * returns true if events are being traced
+         */
+        static bool is_enabled() {
+            return m_enabled;
+        }
+
+        /**
+         * function_enter
+         * records entering the given function
+         */
+        static void function_enter(const function& fun);
+
+        /**
+         * function_leave
+         * records leaving the given function
+         */
+        static void function_leave(const function& fun);
+
+        /**
+         * loop_iteration
+         * records the start of the given iteration of the given while loop
+         */
+        static void loop_iteration(const while_stmt& w_stmt, std::int64_t iteration);
+
+        /**
+         * loop_iteration
+         * records the start of the given iteration of the given for loop
+         */
+        static void loop_iteration(const for_stmt& f_stmt, std::int64_t iteration);
+
+        /**
+         * gate
+         * records applying a gate to the qubits from the start index to the end index
+         */
+        static void gate(std::int64_t start_index, std::int64_t end_index);
+
+        /**
+         * controlled_gate
+         * records applying a gate controlled by all the given control indices to the target index as a single event
+         */
+        static void controlled_gate(const std::vector<std::size_t>& control_indices, std::int64_t target_index);
+
+        /**
+         * measurement
+         * records measuring the qubit at the given index and the outcome
+         */
+        static void measurement(std::int64_t index, std::int64_t outcome);
+
+        /**
+         * allocation
+         * records adding qubits to the processor from the start index to the end index
+         */
+        static void allocation(std::int64_t start_index, std::int64_t end_index);
+
+        /**
+         * finish
+         * writes the names and the events in the ring buffer to the trace file then closes it.
+         * if events were overwritten, says how many on standard error.
+         */
+        static void finish();
+
+        /**
+         * convert
+         * reads the trace file at the given path and writes it as Chrome trace event JSON on the given stream.
+         * returns false and prints why on the error stream if the trace file cannot be read.
+         */
+        static bool convert(const std::string& trace_path, std::ostream& os, std::ostream& err);
+
+    private:
+        /**
+         * get_instance
+         * returns the only tracer instance
+         */
+        static tracer& get_instance();
+
+        /**
+         * record
+         * appends an event to the ring buffer, overwriting the oldest event if it is full
+         */
+        void record(trace_event_kind kind, std::uint32_t name, std::int64_t first, std::int64_t second);
+
+        /**
+         * name_of
+         * returns the identifier of the name of the given object, defining it first if needs be
+         */
+        template<typename Namer>
+        std::uint32_t name_of(const void * key, Namer namer);
+
+        /**
+         * define_name
+         * keeps the given name until the trace is written and returns the new name identifier
+         */
+        std::uint32_t define_name(const std::string& name);
+
+        /*
+         * whether tracing is enabled
+         * this is a plain static so checking it on every hook is as cheap as it gets
+         */
+        static bool m_enabled;
+
+        /*
+         * the number of events the ring buffer holds, a power of two so wrapping around is a mask
+         */
+        static const std::size_t m_capacity = 1 << 16;
+
+        /*
+         * the trace file
+         */
+        std::ofstream m_file;
+
+        /*
+         * the ring buffer of events, where the next event goes, how many events it holds
+         * and how many events were overwritten because it was full
+         */
+        std::unique_ptr<trace_record[]> m_buffer;
+        std::size_t m_head;
+        std::size_t m_size;
+        std::uint64_t m_dropped;
+
+        /*
+         * when the tracer was enabled, in nanoseconds
+         */
+        std::uint64_t m_start;
+
+        /*
+         * names are written once, events refer to them by identifier
+         */
+        std::unordered_map<const void *, std::uint32_t> m_names;
+        std::vector<std::string> m_name_strings;
+
+        /*
+         * identifiers of the names of quantum processor events
+         */
+        std::uint32_t m_gate_name;
+        std::uint32_t m_controlled_gate_name;
+        std::uint32_t m_measurement_name;
+        std::uint32_t m_allocation_name;
+    };
+
+    /**
+     * trace_scope
+     * records entering the given function on construction and leaving it on destruction, if the tracer is enabled
+     */
+    class trace_scope {
+    public:
+        trace_scope(const std::shared_ptr<function>& fun) : m_fun(tracer::is_enabled() ? fun.get() : nullptr) {
+            if(m_fun)
+                tracer::function_enter(* m_fun);
+        }
+
+        ~trace_scope() {
+            if(m_fun)
+                tracer::function_leave(* m_fun);
+        }
+
+    private:
+        const function * m_fun;
+    };
+}
+
+#endif
@@ -0,0 +1,86 @@
+/*
+ *  This file is part of the Avalon programming language
+ * 
+ *  Copyright (c) 2018 Ntwali Bashige Toussaint
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include <unordered_map>
+#include <stdexcept>
+#include <string>
+#include <deque>
+
+#include <omp.h>
+
+#include "lexer/interner.hpp"
+
+
+namespace avalon {
+    /**
+     * intern
+     * given a string, returns the unique identifier associated with it.
+     * the string is copied into the table the first time it is seen, after which
+     * all tokens that carry the same text share that single copy.
+     * interned strings are never released so only source lexemes should be interned,
+     * tokens built at runtime must use a fixed lexeme and keep their value elsewhere.
+     * throws a std::logic_error if called from inside a parallel region.
+     */
+    symbol_id interner::intern(const std::string& text) {
+        if(omp_in_parallel())
+            throw std::logic_error("[compiler error] strings cannot be interned from inside a parallel region.");
+
+        interner& table = get_instance();
+        std::unordered_map<std::string, symbol_id>::const_iterator it = table.m_ids.find(text);
+        if(it != table.m_ids.end())
+            return it -> second;
+
+        symbol_id id = static_cast<symbol_id>(table.m_strings.size());
+        table.m_strings.push_back(text);
+        table.m_ids.emplace(text, id);
+        return id;
+    }
+
+    /**
+     * lookup
+     * given a symbol identifier, returns the string it was created from.
+     * the reference remains valid for the lifetime of the process.
+     */
+    const std::string& interner::lookup(symbol_id id) {
+        return get_instance().m_strings[id];
+    }
+
+    /**
+     * size
+     * returns the number of distinct strings interned so far
+     */
+    std::size_t interner::size() {
+        return get_instance().m_strings.size();
+    }
+
+    /**
+     * get_instance
+     * returns the process-wide interner.
+     * tokens are created during static initialization so we cannot rely on a plain global.
+     */
+    interner& interner::get_instance() {
+        static interner instance;
+        return instance;
+    }
+}
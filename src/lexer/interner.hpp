@@ -0,0 +1,91 @@
+/*
+ *  This file is part of the Avalon programming language
+ * 
+ *  Copyright (c) 2018 Ntwali Bashige Toussaint
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#ifndef AVALON_LEXER_INTERNER_HPP_
+#define AVALON_LEXER_INTERNER_HPP_
+
+#include <unordered_map>
+#include <cstdint>
+#include <string>
+#include <deque>
+
+
+namespace avalon {
+    typedef std::uint32_t symbol_id;
+
+    /**
+     * interner
+     * the table is shared by the whole process and is not synchronized,
+     * it must only be used from one thread at a time.
+     * the quantum processor runs gates on several threads but never creates tokens there,
+     * interning from inside a parallel region throws instead of corrupting the table.
+     */
+    class interner {
+    public:
+        /**
+         * intern
+         * given a string, returns the unique identifier associated with it.
+         * the string is copied into the table the first time it is seen, after which
+         * all tokens that carry the same text share that single copy.
+         * interned strings are never released so only source lexemes should be interned,
+         * tokens built at runtime must use a fixed lexeme and keep their value elsewhere.
+         * throws a std::logic_error if called from inside a parallel region.
+         */
+        static symbol_id intern(const std::string& text);
+
+        /**
+         * lookup
+         * given a symbol identifier, returns the string it was created from.
+         * the reference remains valid for the lifetime of the process.
+         */
+        static const std::string& lookup(symbol_id id);
+
+        /**
+         * size
+         * returns the number of distinct strings interned so far
+         */
+        static std::size_t size();
+
+    private:
+        /**
+         * get_instance
+         * returns the process-wide interner.
+         * tokens are created during static initialization so we cannot rely on a plain global.
+         */
+        static interner& get_instance();
+
+        /**
+         * the interned strings, indexed by their symbol identifier
+         * a deque is used because it never moves its elements when growing at the back
+         */
+        std::deque<std::string> m_strings;
+
+        /**
+         * a map from interned strings to their symbol identifier
+         */
+        std::unordered_map<std::string, symbol_id> m_ids;
+    };
+}
+
+#endif
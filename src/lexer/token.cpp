@@ -24,12 +24,16 @@
 
 #include <algorithm>
 #include <iostream>
+#include <stdexcept>
 #include <utility>
 #include <string>
 
 #include "lexer/token_type.hpp"
 #include "lexer/token.hpp"
 
+/* Utils */
+#include "utils/stats.hpp"
+
 
 namespace avalon {
 /**
@@ -45,10 +49,12 @@ token::token(
     std::size_t line,
     std::size_t column,
     const std::string& source_path
-) : m_type(tok_type), m_lexeme(lexeme), m_line(line), m_column(column), m_source_path(source_path) {
+) : m_type(tok_type), m_lexeme(0), m_source_path(interner::intern(source_path)), m_line(line), m_column(column) {
     // we remove new lines, carriage returns and empty spaces in lexemes to facilitate display
-    m_lexeme.erase(std::remove(m_lexeme.begin(), m_lexeme.end(), '\n'), m_lexeme.end());
-    m_lexeme.erase(std::remove(m_lexeme.begin(), m_lexeme.end(), '\r'), m_lexeme.end());
+    lexeme.erase(std::remove(lexeme.begin(), lexeme.end(), '\n'), lexeme.end());
+    lexeme.erase(std::remove(lexeme.begin(), lexeme.end(), '\r'), lexeme.end());
+    m_lexeme = interner::intern(lexeme);
+    stats::count_token();
 }
 
     /**
@@ -63,7 +69,16 @@ token::token(
      * get_lexeme
      * returns the string that matched this token
      */
-    std::string token::get_lexeme() const {        
+    const std::string& token::get_lexeme() const {
+        return interner::lookup(m_lexeme);
+    }
+
+    /**
+     * get_lexeme_id
+     * returns the interned identifier of the string that matched this token
+     * two tokens with the same lexeme always have the same identifier
+     */
+    symbol_id token::get_lexeme_id() const {
         return m_lexeme;
     }
 
@@ -88,7 +103,7 @@ token::token(
      * returns the path to the source file where this token was foun
      */
     const std::string& token::get_source_path() const {
-        return m_source_path;
+        return interner::lookup(m_source_path);
     }
 
     /**
@@ -126,7 +141,7 @@ number::number(
     }
 
     void number::update_lexeme(std::string lexeme) {
-        m_lexeme = lexeme;
+        m_lexeme = interner::intern(lexeme);
     }
 
     void number::update_line(std::size_t line) {
@@ -274,6 +289,7 @@ avl_string::avl_string(
  */
 token star_tok(MUL, "*", 0, 0, "__bit__");
 token type_param_a_tok(IDENTIFIER, "__a__", 0, 0, "__bit__");
+token type_param_b_tok(IDENTIFIER, "__b__", 0, 0, "__bit__");
 
 /**
  * Type tokens
@@ -348,4 +364,35 @@ token var_four_tok(IDENTIFIER, "__var_four__", 0, 0, "__biv__");
  */
 token param_a_tok(IDENTIFIER, "__param_a__", 0, 0, "__bip__");
 token param_b_tok(IDENTIFIER, "__param_a__", 0, 0, "__bip__");
+
+    /**
+     * builtin_token
+     * returns the token given to the literals created at runtime by builtin functions and the interpreter.
+     * there is one such token per literal type and its lexeme is empty: the value lives on the literal alone.
+     */
+    const token& builtin_token(token_type tok_type) {
+        static token integer_tok(INTEGER, "", 0, 0, "__bil__");
+        static token floating_point_tok(FLOATING_POINT, "", 0, 0, "__bil__");
+        static token decimal_tok(DECIMAL, "", 0, 0, "__bil__");
+        static token string_tok(STRING, "", 0, 0, "__bil__");
+        static token bits_tok(BITS, "", 0, 0, "__bil__");
+        static token qubits_tok(QUBITS, "", 0, 0, "__bil__");
+
+        switch(tok_type) {
+            case INTEGER:
+                return integer_tok;
+            case FLOATING_POINT:
+                return floating_point_tok;
+            case DECIMAL:
+                return decimal_tok;
+            case STRING:
+                return string_tok;
+            case BITS:
+                return bits_tok;
+            case QUBITS:
+                return qubits_tok;
+            default:
+                throw std::invalid_argument("[compiler error] builtin tokens only exist for literal types.");
+        }
+    }
 }
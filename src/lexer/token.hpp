@@ -27,10 +27,12 @@
 
 #include <iostream>
 #include <utility>
+#include <cstdint>
 #include <memory>
 #include <string>
 
 #include "lexer/token_type.hpp"
+#include "lexer/interner.hpp"
 
 
 namespace avalon {
@@ -52,7 +54,14 @@ namespace avalon {
          * get_lexeme
          * returns the string that matched this token
          */
-        std::string get_lexeme() const;
+        const std::string& get_lexeme() const;
+
+        /**
+         * get_lexeme_id
+         * returns the interned identifier of the string that matched this token
+         * two tokens with the same lexeme always have the same identifier
+         */
+        symbol_id get_lexeme_id() const;
 
         /**
          * get_line
@@ -79,26 +88,26 @@ namespace avalon {
         token_type m_type;
 
         /**
-         * the string that matched this token
+         * the interned string that matched this token
+         */
+        symbol_id m_lexeme;
+
+        /**
+         * the interned path to the source file where this token was found
          */
-        std::string m_lexeme;
+        symbol_id m_source_path;
 
         /**
          * the line where this token was found
          */
-        std::size_t m_line;
+        std::uint32_t m_line;
 
         /**
          * the column where this token was found.
          * the column will be at the last avl_string of the lexeme,
          * not at the beginning of the lexeme.
          */
-        std::size_t m_column;
-
-        /**
-         * the source file where this token was found
-         */
-        std::string m_source_path;
+        std::uint32_t m_column;
 
     /**
      * overloaded shift for std::cout
@@ -264,12 +273,10 @@ namespace avalon {
      *
      * compare two tokens for equality.
      * this used to compare say two type names (since we don't allow the same type names to be reused)
+     * lexemes are interned so comparing their identifiers is enough.
      */
     inline bool operator==(const token& lhs, const token& rhs) {
-        if (lhs.get_type() == rhs.get_type() && lhs.get_lexeme() == rhs.get_lexeme())
-            return true;
-        else
-            return false;
+        return lhs.get_type() == rhs.get_type() && lhs.get_lexeme_id() == rhs.get_lexeme_id();
     }
 
     inline bool operator!=(const token& lhs, const token& rhs) {
@@ -286,22 +293,10 @@ namespace avalon {
      * the less than overload is required by the map container where we use tokens as map keys
      */
     inline bool operator<(const token& lhs, const token& rhs) {
-        std::string lhs_lexeme = lhs.get_lexeme();
-        //std::size_t lhs_line = lhs.get_line();
-        //std::size_t lhs_column = lhs.get_column();
-
-        std::string rhs_lexeme = rhs.get_lexeme();
-        //std::size_t rhs_line = rhs.get_line();
-        //std::size_t rhs_column = rhs.get_column();
-
-        if(lhs_lexeme.compare(rhs_lexeme)  < 0)
-            return true;
-        if(lhs_lexeme.compare(rhs_lexeme) > 0)
+        if(lhs.get_lexeme_id() == rhs.get_lexeme_id())
             return false;
 
-        return false;
-
-        //return std::tie(lhs_line, lhs_column) < std::tie(rhs_line, rhs_column);
+        return lhs.get_lexeme().compare(rhs.get_lexeme()) < 0;
     }
 
     inline bool operator>(const token& lhs, const token& rhs) {
@@ -322,6 +317,7 @@ namespace avalon {
      */
     extern token star_tok;
     extern token type_param_a_tok;
+    extern token type_param_b_tok;
 
     /**
      * Type tokens
@@ -396,6 +392,13 @@ namespace avalon {
      */
     extern token param_a_tok;
     extern token param_b_tok;
+
+    /**
+     * builtin_token
+     * returns the token given to the literals created at runtime by builtin functions and the interpreter.
+     * there is one such token per literal type and its lexeme is empty: the value lives on the literal alone.
+     */
+    const token& builtin_token(token_type tok_type);
 }
 
 #endif
@@ -24,66 +24,199 @@
 
 #include <iostream>
 #include <cstdlib>
+#include <cstddef>
 #include <memory>
 #include <vector>
 #include <string>
 
-#include <boost/filesystem.hpp>
-
+#include "compiler/exceptions/server_error.hpp"
 #include "compiler/compiler.hpp"
+#include "compiler/server.hpp"
+#include "interpreter/output_buffer.hpp"
+#include "interpreter/qprocessor.hpp"
+#include "interpreter/profiler.hpp"
+#include "interpreter/tracer.hpp"
 #include "utils/exceptions/invalid_directory.hpp"
+#include "utils/stats.hpp"
 
 
-void compile(const std::string& source_path, std::vector<std::string>& argumemts);
+void usage();
+bool parse_size(const std::string& size_str, std::size_t& size);
+void compile(const std::string& source_path, std::vector<std::string>& argumemts, bool check_only);
 
 
 int main(int argc, char * argv[])
-{   if (argc < 2) {
-        std::cout << "Usage: avalon program [args]" << std::endl;
+{   std::string serve_path;
+    std::string client_path;
+    bool check_only = false;
+    bool show_stats = false;
+    bool stats_json = false;
+    std::string profile_path;
+    std::string trace_path;
+    std::string trace_json_path;
+    std::size_t out_buffer_size = 0;
+    bool show_qstats = false;
+    bool unbuffered = false;
+
+    // options come before the program
+    int i = 1;
+    for(; i < argc; ++i) {
+        std::string option(argv[i]);
+        if(option.compare(0, 2, "--") != 0)
+            break;
+
+        if(option == "--serve" && i + 1 < argc)
+            serve_path = argv[++i];
+        else if(option == "--client" && i + 1 < argc)
+            client_path = argv[++i];
+        else if(option == "--check")
+            check_only = true;
+        else if(option == "--stats")
+            show_stats = true;
+        else if(option == "--stats=json")
+            show_stats = stats_json = true;
+        else if(option == "--qstats")
+            show_qstats = true;
+        else if(option == "--profile")
+            profile_path = "avalon.folded";
+        else if(option.compare(0, 10, "--profile=") == 0 && option.size() > 10)
+            profile_path = option.substr(10);
+        else if(option == "--trace")
+            trace_path = "avalon.trace";
+        else if(option.compare(0, 8, "--trace=") == 0 && option.size() > 8)
+            trace_path = option.substr(8);
+        else if(option == "--trace-json" && i + 1 < argc)
+            trace_json_path = argv[++i];
+        else if(option.compare(0, 13, "--out-buffer=") == 0 && parse_size(option.substr(13), out_buffer_size))
+            unbuffered = (out_buffer_size == 0);
+        else if(option == "--unbuffered")
+            unbuffered = true;
+        else {
+            usage();
+            return 1;
+        }
+    }
+
+    // converting a trace does not need a program
+    if(trace_json_path.empty() == false)
+        return avalon::tracer::convert(trace_json_path, std::cout, std::cerr) ? 0 : 1;
+
+    // in server mode, we only return if something goes wrong
+    if(serve_path.empty() == false) {
+        try {
+            avalon::server srv(serve_path);
+            srv.serve();
+        } catch(const avalon::server_error& err) {
+            std::cerr << err.what() << std::endl;
+        }
+        return 1;
+    }
+
+    if (i >= argc) {
+        usage();
     }
     else {
-        std::string source_path(argv[1]);
+        std::string source_path(argv[i]);
 
         // get ourselves the argumemts given by the user
         std::vector<std::string> argumemts;
-        for(int i = 2; i < argc; ++i)
+        for(++i; i < argc; ++i)
             argumemts.emplace_back(argv[i]);
 
-        // compile the source
-        compile(source_path, argumemts);
+        // either have a server do the work or compile the source ourselves
+        if(client_path.empty() == false) {
+            avalon::server::request_options options;
+            options.m_check_only = check_only;
+            options.m_show_stats = show_stats;
+            options.m_stats_json = stats_json;
+            options.m_qstats = show_qstats;
+            options.m_profile_path = profile_path;
+            options.m_trace_path = trace_path;
+            options.m_out_buffer_size = out_buffer_size;
+            options.m_unbuffered = unbuffered;
+            try {
+                return avalon::server::request(client_path, options, source_path, argumemts);
+            } catch(const avalon::server_error& err) {
+                std::cerr << err.what() << std::endl;
+                return 1;
+            }
+        }
+        else {
+            if(show_stats)
+                avalon::stats::enable();
+            if(show_qstats)
+                avalon::qprocessor::enable_stats_report();
+            if(unbuffered)
+                avalon::output_buffer::set_unbuffered();
+            else if(out_buffer_size > 0)
+                avalon::output_buffer::set_capacity(out_buffer_size);
+            if(profile_path.empty() == false)
+                avalon::profiler::enable(profile_path);
+            if(trace_path.empty() == false && avalon::tracer::enable(trace_path) == false) {
+                std::cerr << "Failed to create the trace file <" << trace_path << ">." << std::endl;
+                return 1;
+            }
+
+            compile(source_path, argumemts, check_only);
+
+            if(show_stats)
+                avalon::stats::report(std::cerr, stats_json);
+            if(profile_path.empty() == false)
+                avalon::profiler::report(std::cerr);
+            avalon::tracer::finish();
+        }
     }
 
     return 0;
 }
 
-void compile(const std::string& source_path, std::vector<std::string>& argumemts) {
+void usage() {
+    std::cout << "Usage: avalon [options] program [args]" << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << "  --check            only check the program, do not run it" << std::endl;
+    std::cout << "  --stats[=json]     report time, memory and objects created by each compiler phase" << std::endl;
+    std::cout << "  --qstats           report what the quantum processor did once the program finishes" << std::endl;
+    std::cout << "  --profile[=file]   report time and allocations per function, collapsed stacks go to <avalon.folded> by default" << std::endl;
+    std::cout << "  --trace[=file]     record interpreter and quantum events, the binary trace goes to <avalon.trace> by default" << std::endl;
+    std::cout << "  --trace-json <trace>  print the given binary trace as Chrome trace event JSON" << std::endl;
+    std::cout << "  --out-buffer=<size>  buffer up to size bytes of program output before writing it, k and m suffixes are accepted" << std::endl;
+    std::cout << "  --unbuffered       write program output as soon as it is printed" << std::endl;
+    std::cout << "  --serve <socket>   keep parsed programs in memory and run programs sent to the given socket" << std::endl;
+    std::cout << "  --client <socket>  have the server listening on the given socket run the program" << std::endl;
+}
+
+bool parse_size(const std::string& size_str, std::size_t& size) {
+    std::size_t pos = 0;
+    while(pos < size_str.size() && size_str[pos] >= '0' && size_str[pos] <= '9')
+        pos++;
+    if(pos == 0 || pos > 12)
+        return false;
+
+    size = std::stoul(size_str.substr(0, pos));
+    std::string suffix = size_str.substr(pos);
+    if(suffix == "k" || suffix == "K")
+        size *= 1024;
+    else if(suffix == "m" || suffix == "M")
+        size *= 1024 * 1024;
+    else if(suffix.empty() == false)
+        return false;
+
+    return true;
+}
+
+void compile(const std::string& source_path, std::vector<std::string>& argumemts, bool check_only) {
     using namespace avalon;
-    namespace fs = boost::filesystem;
 
     compiler comp;
 
     /* 1. configure the compiler according to options given */
-    // add the current directory to the search path
-    comp.add_search_path(fs::current_path());
-
-    // we add the source path directory to the search path
-    // we leave it to later stages of the compiler to decide if the file is valid
-    fs::path s(source_path);
-    if(fs::exists(s) == true && fs::is_directory(s) == false) {
-        fs::path source_dir = s.parent_path();
-        try {
-            comp.add_search_path(source_dir);
-        } catch(const invalid_directory& err) {
-        }
-    }
-
-    // add the avalon home directory to the search path - if it exists
-    if(const char* avalon_home = std::getenv("AVALON_HOME")) {
-        fs::path p(avalon_home);
-        if(fs::exists(p) == true && fs::is_directory(p) == true)
-            comp.add_search_path(p);
-    }
+    // search the current directory, the source directory and the avalon home directory
+    const char* avalon_home = std::getenv("AVALON_HOME");
+    comp.add_default_search_paths(source_path, avalon_home ? avalon_home : "");
 
     /* 2. call the intepreter */
-    comp.interpret(source_path, argumemts);
+    if(check_only)
+        comp.check(source_path);
+    else
+        comp.interpret(source_path, argumemts);
 }
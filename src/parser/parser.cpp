@@ -49,6 +49,7 @@
 #include "representer/ast/stmt/if_stmt.hpp"
 #include "representer/ast/stmt/pass_stmt.hpp"
 #include "representer/ast/stmt/while_stmt.hpp"
+#include "representer/ast/stmt/for_stmt.hpp"
 #include "representer/ast/stmt/block_stmt.hpp"
 #include "representer/ast/stmt/break_stmt.hpp"
 #include "representer/ast/stmt/return_stmt.hpp"
@@ -704,6 +705,9 @@ parser::parser(
         if(match(WHILE)) {
             statement = while_statement(parent_scope);
         }
+        else if(match(FOR)) {
+            statement = for_statement(parent_scope);
+        }
         else if(match(IF)) {
             statement = if_statement(parent_scope);
         }
@@ -771,6 +775,55 @@ parser::parser(
         return stmt;
     }
 
+    /**
+     * for_statement
+     * match a for statement
+     */
+    std::shared_ptr<stmt> parser::for_statement(std::shared_ptr<scope>& parent_scope) {
+        std::shared_ptr<token>& tok = lookback();
+        std::shared_ptr<for_stmt> fr_stmt = std::make_shared<for_stmt>(* tok);
+
+        // a for loop introduces a new scope which will hold the loop variables
+        std::shared_ptr<scope> l_scope = std::make_shared<scope>();
+        l_scope -> set_start_line(tok -> get_line());
+        l_scope -> set_parent(parent_scope);
+        l_scope -> set_origin("for");
+        fr_stmt -> set_scope(l_scope);
+
+        // parse the loop variables, a second variable is allowed to receive the values when iterating over maps
+        do {
+            std::shared_ptr<token>& var_tok = consume(IDENTIFIER, "Expected a loop variable name after the for keyword.");
+            std::shared_ptr<variable> var_decl = std::make_shared<variable>(* var_tok, false);
+            var_decl -> check_initializer(false);
+            fr_stmt -> add_variable(var_decl);
+        } while(match(COMMA));
+
+        if(fr_stmt -> get_variables().size() > 2)
+            throw parsing_error(true, tok, "A for loop can declare at most two loop variables.");
+
+        consume(IN, "Expected the <in> keyword after the for loop variables.");
+
+        // parse the expression we are iterating over
+        std::shared_ptr<expr> iterable = parse_expression();
+        fr_stmt -> set_iterable(iterable);
+
+        consume(COLON, "Expected a colon after for loop iterable expression.");
+        consume(NEWLINE, "Expected a new line after the colon in for loop.");
+
+        if(!check(INDENT))
+            throw parsing_error(true, tok, "A for loop must have a body.");
+
+        // get the body of the loop
+        block_stmt body = block_statement(parent_scope);
+        fr_stmt -> set_block(body);
+
+        // set the end line for the new scope
+        l_scope -> set_end_line(lookback() -> get_line());
+
+        std::shared_ptr<stmt> stmt = fr_stmt;
+        return stmt;
+    }
+
     /**
      * if_statement
      * match an if statement
@@ -2049,6 +2102,7 @@ parser::parser(
                 case FUNCTION:
                 case IF:
                 case WHILE:
+                case FOR:
                 case RETURN:
                 case BREAK:
                 case CONTINUE:
@@ -239,6 +239,12 @@ namespace avalon {
          */
         std::shared_ptr<stmt> while_statement(std::shared_ptr<scope>& parent_scope);
 
+        /**
+         * for_statement
+         * match a for statement
+         */
+        std::shared_ptr<stmt> for_statement(std::shared_ptr<scope>& parent_scope);
+
         /**
          * parse_if
          * match an if statement
@@ -34,7 +34,22 @@
 #include "representer/symtable/scope.hpp"
 
 
+/* Utils */
+#include "utils/stats.hpp"
+
+
 namespace avalon {
+    /**
+     * the constructors only record the creation of the node for statistics
+     */
+    decl::decl() {
+        stats::count_node();
+    }
+
+    decl::decl(const decl& a_decl) : std::enable_shared_from_this<decl>() {
+        stats::count_node();
+    }
+
     /**
      * copy
      * copies a declaration and returns the copied one
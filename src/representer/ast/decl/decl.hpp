@@ -50,6 +50,12 @@ namespace avalon {
 
     class decl : public std::enable_shared_from_this<decl> {
     public:
+        /**
+         * the constructors only record the creation of the node for statistics
+         */
+        decl();
+        decl(const decl& a_decl);
+
         /**
          * copy
          * copies a declaration and returns the copied one
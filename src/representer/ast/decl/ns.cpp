@@ -167,11 +167,14 @@ namespace avalon {
     /**
      * set_scope
      * specify the scope of all declarations found in this namespace
+     * declarations the scope already holds, because the checker recorded them there, are left as they are
      */
     void ns::set_scope(std::shared_ptr<scope>& l_scope) {
         for(auto& m_declaration : m_declarations) {
             if(m_declaration -> is_type()) {
                 std::shared_ptr<type> type_decl = std::static_pointer_cast<type>(m_declaration);
+                if(l_scope -> type_exists(m_name, type_decl))
+                    continue;
                 try {
                     l_scope -> add_type(m_name, type_decl);
                 } catch(symbol_already_declared err) {
@@ -181,6 +184,8 @@ namespace avalon {
                 std::shared_ptr<function> function_decl = std::static_pointer_cast<function>(m_declaration);
                 std::shared_ptr<scope>& f_scope = function_decl -> get_scope();
                 f_scope -> set_parent(l_scope);
+                if(l_scope -> function_exists(m_name, function_decl))
+                    continue;
                 try {
                     l_scope -> add_function(m_name, function_decl);
                 } catch(symbol_already_declared err) {
@@ -189,6 +194,8 @@ namespace avalon {
             else if(m_declaration -> is_variable()) {
                 std::shared_ptr<variable> variable_decl = std::static_pointer_cast<variable>(m_declaration);
                 variable_decl -> set_scope(l_scope);
+                if(l_scope -> variable_exists(m_name, variable_decl))
+                    continue;
                 try {
                     l_scope -> add_variable(m_name, variable_decl);
                 } catch(symbol_already_declared err) {
@@ -91,6 +91,7 @@ namespace avalon {
         /**
          * set_scope
          * specify the scope of all declarations found in this namespace
+         * declarations the scope already holds, because the checker recorded them there, are left as they are
          */
         void set_scope(std::shared_ptr<scope>& l_scope);
 
@@ -28,6 +28,8 @@
 #include <utility>
 #include <iostream>
 #include <stdexcept>
+#include <memory>
+#include <string>
 #include <algorithm>
 #include <unordered_map>
 
@@ -390,19 +392,19 @@ type::type(token& tok, validation_state is_valid) : m_name(tok.get_lexeme()), m_
 /**
  * the default constructor expects nothing
  */
-type_instance::type_instance() : m_name(star_tok.get_lexeme()), m_tok(star_tok), m_old_tok(star_tok), m_tag(star_tok), m_category(USER), m_namespace("*"), m_type(nullptr), m_count(0), m_has_count(false), m_is_parametrized(false), m_is_reference(false) {
+type_instance::type_instance() : m_name(star_tok.get_lexeme()), m_tok(star_tok), m_old_tok(star_tok), m_tag(star_tok), m_category(USER), m_namespace("*"), m_type(nullptr), m_count(0), m_has_count(false), m_is_parametrized(false), m_is_reference(false), m_canonical(nullptr) {
 }
 
 /*
  * type instance
  */
-type_instance::type_instance(token& tok, const std::string& namespace_name) : m_name(tok.get_lexeme()), m_tok(tok), m_old_tok(tok), m_tag(star_tok), m_category(USER), m_namespace(namespace_name), m_type(nullptr), m_count(0), m_has_count(false), m_is_parametrized(false), m_is_reference(false) {
+type_instance::type_instance(token& tok, const std::string& namespace_name) : m_name(tok.get_lexeme()), m_tok(tok), m_old_tok(tok), m_tag(star_tok), m_category(USER), m_namespace(namespace_name), m_type(nullptr), m_count(0), m_has_count(false), m_is_parametrized(false), m_is_reference(false), m_canonical(nullptr) {
 }
 
 /**
  * this constructor expects the token with source code information, the type that buils this instance and the namespace where to find that type
  */
-type_instance::type_instance(token& tok, std::shared_ptr<type>& ty, const std::string& namespace_name) : m_name(tok.get_lexeme()), m_tok(tok), m_old_tok(tok), m_tag(star_tok), m_category(USER), m_namespace(namespace_name), m_type(ty), m_count(0), m_has_count(false), m_is_parametrized(false), m_is_reference(false) {
+type_instance::type_instance(token& tok, std::shared_ptr<type>& ty, const std::string& namespace_name) : m_name(tok.get_lexeme()), m_tok(tok), m_old_tok(tok), m_tag(star_tok), m_category(USER), m_namespace(namespace_name), m_type(ty), m_count(0), m_has_count(false), m_is_parametrized(false), m_is_reference(false), m_canonical(nullptr) {
 }
 
     /**
@@ -415,7 +417,8 @@ type_instance::type_instance(token& tok, std::shared_ptr<type>& ty, const std::s
         m_tag = instance.get_tag();
         m_category = instance.get_category();
         m_namespace = instance.get_namespace();
-        m_type = instance.get_type();
+        // we read the type and the parameters through the const accessors so the source keeps its interned identity
+        m_type = static_cast<const type_instance&>(instance).get_type();
         m_is_parametrized = instance.is_parametrized();
         m_is_reference = instance.is_reference();
         /*
@@ -426,10 +429,11 @@ type_instance::type_instance(token& tok, std::shared_ptr<type>& ty, const std::s
             m_has_count = instance.has_count();
         }
         */
-        std::vector<type_instance>& params = instance.get_params();
+        const std::vector<type_instance>& params = static_cast<const type_instance&>(instance).get_params();
         m_params.clear();
         for(auto& param : params)
             m_params.push_back(param);
+        m_canonical = instance.get_canonical();
         return * this;
     }
 
@@ -439,6 +443,7 @@ type_instance::type_instance(token& tok, std::shared_ptr<type>& ty, const std::s
      */
     void type_instance::set_name(const std::string& name) {
         m_name = name;
+        m_canonical = nullptr;
     }
 
     /**
@@ -475,6 +480,7 @@ type_instance::type_instance(token& tok, std::shared_ptr<type>& ty, const std::s
     void type_instance::set_token(token tok) {
         m_tok = tok;
         m_name = tok.get_lexeme();
+        m_canonical = nullptr;
     }
 
     /**
@@ -492,6 +498,7 @@ type_instance::type_instance(token& tok, std::shared_ptr<type>& ty, const std::s
      */
     void type_instance::set_old_token(token tok) {
         m_old_tok = tok;
+        m_canonical = nullptr;
     }
 
     /**
@@ -508,6 +515,7 @@ type_instance::type_instance(token& tok, std::shared_ptr<type>& ty, const std::s
      */
     void  type_instance::set_tag(token& tag) {
         m_tag = tag;
+        m_canonical = nullptr;
     }
 
     /**
@@ -524,6 +532,7 @@ type_instance::type_instance(token& tok, std::shared_ptr<type>& ty, const std::s
      */
     void type_instance::set_category(type_instance_category category) {
         m_category = category;
+        m_canonical = nullptr;
     }
 
     /**
@@ -540,6 +549,7 @@ type_instance::type_instance(token& tok, std::shared_ptr<type>& ty, const std::s
      */
     void type_instance::set_namespace(const std::string& namespace_name) {
         m_namespace = namespace_name;
+        m_canonical = nullptr;
     }
 
     /**
@@ -556,6 +566,7 @@ type_instance::type_instance(token& tok, std::shared_ptr<type>& ty, const std::s
      */
     void type_instance::set_type(std::shared_ptr<type>& ty) {
         m_type = ty;
+        m_canonical = nullptr;
     }
 
     /**
@@ -563,6 +574,8 @@ type_instance::type_instance(token& tok, std::shared_ptr<type>& ty, const std::s
      * returns the type that corresponds to this type instance
      */
     std::shared_ptr<type>& type_instance::get_type() {
+        // the caller may replace the type so we can no longer vouch for our interned identity
+        m_canonical = nullptr;
         return m_type;
     }
 
@@ -610,6 +623,7 @@ type_instance::type_instance(token& tok, std::shared_ptr<type>& ty, const std::s
      */
     void type_instance::set_count(std::size_t count) {
         m_count = count;
+        m_canonical = nullptr;
     }
 
     /**
@@ -629,6 +643,7 @@ type_instance::type_instance(token& tok, std::shared_ptr<type>& ty, const std::s
      */
     void type_instance::has_count(bool has_count_) {
         m_has_count = has_count_;
+        m_canonical = nullptr;
     }
 
     bool type_instance::has_count() {
@@ -642,6 +657,7 @@ type_instance::type_instance(token& tok, std::shared_ptr<type>& ty, const std::s
      */
     void type_instance::add_param(type_instance& param) {
         m_params.push_back(param);
+        m_canonical = nullptr;
     }
 
     /**
@@ -649,6 +665,8 @@ type_instance::type_instance(token& tok, std::shared_ptr<type>& ty, const std::s
      * returns a vector of type instances this depends on
      */
     std::vector<type_instance>& type_instance::get_params() {
+        // the caller may modify the parameters so we can no longer vouch for our interned identity
+        m_canonical = nullptr;
         return m_params;
     }
 
@@ -663,6 +681,7 @@ type_instance::type_instance(token& tok, std::shared_ptr<type>& ty, const std::s
      */
     void type_instance::is_parametrized(bool is_parametrized) {
         m_is_parametrized = is_parametrized;
+        m_canonical = nullptr;
     }
 
     bool type_instance::is_parametrized() const {
@@ -679,6 +698,7 @@ type_instance::type_instance(token& tok, std::shared_ptr<type>& ty, const std::s
      */
     void type_instance::is_reference(bool is_reference) {
         m_is_reference = is_reference;
+        m_canonical = nullptr;
     }
 
     bool type_instance::is_reference() const {
@@ -792,6 +812,81 @@ type_instance::type_instance(token& tok, std::shared_ptr<type>& ty, const std::s
             return false;
     }
 
+    /**
+     * intern
+     * replaces this type instance identity with the unique node held by the type instance interner.
+     * only complete type instances are interned; abstract or incomplete ones are left untouched.
+     */
+    void type_instance::intern() {
+        m_canonical = intern_type_instance(* this);
+    }
+
+    /**
+     * get_canonical
+     * returns the unique interned node that is structurally equal to this type instance
+     * or a null pointer if this type instance was never interned or was modified since.
+     */
+    const type_instance * type_instance::get_canonical() const {
+        return m_canonical;
+    }
+
+    /**
+     * structural_key
+     * builds a string that captures exactly what type_instance_strong_compare looks at:
+     * the category, whether we have a reference, the type namespace, name and arity and the parameters.
+     * returns false if the type instance (or one of its parameters) cannot be interned.
+     */
+    static bool structural_key(const type_instance& instance, std::string& key) {
+        const std::vector<type_instance>& params = instance.get_params();
+
+        key += std::to_string(instance.get_category());
+        if(instance.is_reference()) {
+            if(params.size() != 1)
+                return false;
+            key += "&";
+            return structural_key(params[0], key);
+        }
+
+        if(instance.is_abstract() || instance.is_parametrized())
+            return false;
+
+        const std::shared_ptr<type>& ty = instance.get_type();
+        key += ty -> get_namespace();
+        key += ".";
+        key += ty -> get_name();
+        key += "/";
+        key += std::to_string(ty -> get_params().size());
+        key += "(";
+        for(auto& param : params) {
+            if(structural_key(param, key) == false)
+                return false;
+            key += ",";
+        }
+        key += ")";
+        return true;
+    }
+
+    /**
+     * intern_type_instance
+     * given a complete type instance, returns the unique immutable node that represents it.
+     * structurally equal type instances share the same node so interned type instances compare by address.
+     * returns a null pointer if the type instance is abstract or incomplete.
+     */
+    const type_instance * intern_type_instance(const type_instance& instance) {
+        static std::unordered_map<std::string, std::unique_ptr<type_instance> > interned_instances;
+
+        std::string key;
+        if(structural_key(instance, key) == false)
+            return nullptr;
+
+        std::unique_ptr<type_instance>& node = interned_instances[key];
+        if(node == nullptr) {
+            node.reset(new type_instance(instance));
+            node -> m_canonical = node.get();
+        }
+        return node.get();
+    }
+
     /**
      * mangle_type_constructor
      * returns a string representation of a type instance
@@ -874,8 +969,12 @@ type_instance::type_instance(token& tok, std::shared_ptr<type>& ty, const std::s
      * this means that a concrete type instance cannot be equal to an abstract type instance
      */
     bool type_instance_strong_compare(type_instance& this_instance, type_instance& that_instance) {
-        const std::vector<type_instance>& this_params = this_instance.get_params();
-        const std::vector<type_instance>& that_params = that_instance.get_params();
+        // interned type instances are equal only if they are the same node
+        if(this_instance.get_canonical() != nullptr && that_instance.get_canonical() != nullptr)
+            return this_instance.get_canonical() == that_instance.get_canonical();
+
+        const std::vector<type_instance>& this_params = static_cast<const type_instance&>(this_instance).get_params();
+        const std::vector<type_instance>& that_params = static_cast<const type_instance&>(that_instance).get_params();
 
         // if the type instances belong to different categories, they are not equal
         if(this_instance.get_category() != that_instance.get_category())
@@ -951,8 +1050,12 @@ type_instance::type_instance(token& tok, std::shared_ptr<type>& ty, const std::s
      * this means that a concrete type instance cann be equal to an abstract type instance
      */
     bool type_instance_weak_compare(type_instance& this_instance, type_instance& that_instance) {
-        const std::vector<type_instance>& this_params = this_instance.get_params();
-        const std::vector<type_instance>& that_params = that_instance.get_params();
+        // interned type instances are complete so there is no abstract parameter to be lenient about
+        if(this_instance.get_canonical() != nullptr && that_instance.get_canonical() != nullptr)
+            return this_instance.get_canonical() == that_instance.get_canonical();
+
+        const std::vector<type_instance>& this_params = static_cast<const type_instance&>(this_instance).get_params();
+        const std::vector<type_instance>& that_params = static_cast<const type_instance&>(that_instance).get_params();
 
         // if the type instances belong to different categories, they are not equal
         if(this_instance.get_category() != that_instance.get_category())
@@ -1221,6 +1324,18 @@ record_constructor::record_constructor(token& tok, std::shared_ptr<type>& ty) :
         return m_params_vector;
     }
 
+    /**
+     * get_param_index
+     * returns the position of the given parameter inside values built by this constructor.
+     * values store their fields in the order of the parameters map so this position is the same for all of them.
+     */
+    std::size_t record_constructor::get_param_index(const token& param_name) {
+        auto it = m_params.find(param_name);
+        if(it == m_params.end())
+            throw std::out_of_range("The record constructor <" + m_name + "> has no parameter named <" + param_name.get_lexeme() + ">.");
+        return std::distance(m_params.begin(), it);
+    }
+
     /**
      * set_is_parametrized
      * if the constructor relies on an unknown type,
@@ -1306,4 +1421,54 @@ std::string mangle_constructor(const std::string& name, std::vector<type_instanc
     mangled_name += mangle_type_instance(builder_instance);
     return mangled_name;
 }
+
+/**
+ * get_record_field
+ * if values of the given type instance are all built by the same record constructor and that constructor has the given field,
+ * sets the position of the field inside those values and the type instance of the field then returns true.
+ */
+bool get_record_field(type_instance& instance, const token& field_name, std::size_t& index, type_instance& field_instance) {
+    if(instance.get_category() != USER || instance.is_reference())
+        return false;
+
+    std::shared_ptr<type>& type_decl = instance.get_type();
+    if(type_decl == nullptr || type_decl -> get_default_constructors().size() > 0)
+        return false;
+
+    std::vector<record_constructor> rec_constructors = type_decl -> get_record_constructors();
+    if(rec_constructors.size() != 1)
+        return false;
+
+    record_constructor& rec_cons = rec_constructors[0];
+    std::map<token,type_instance>& cons_params = rec_cons.get_params();
+    auto param_it = cons_params.find(field_name);
+    if(param_it == cons_params.end())
+        return false;
+
+    // abstract fields take the type instance the instance we were given binds to their type parameter
+    type_instance& param_instance = param_it -> second;
+    if(param_instance.is_abstract()) {
+        const std::vector<type_instance>& instance_params = static_cast<const type_instance&>(instance).get_params();
+        bool found = false;
+        for(auto& instance_param : instance_params) {
+            if(instance_param.get_old_token() == param_instance.get_token()) {
+                field_instance = instance_param;
+                found = true;
+                break;
+            }
+        }
+        if(found == false)
+            return false;
+    }
+    // fields whose type instance depends on type parameters without being one are left to __getattr__ functions
+    else if(param_instance.is_parametrized()) {
+        return false;
+    }
+    else {
+        field_instance = param_instance;
+    }
+
+    index = rec_cons.get_param_index(field_name);
+    return true;
+}
 }
@@ -367,9 +367,10 @@ namespace avalon {
     /**
      * operator==
      * compares two types for equality
+     * same-named types declared in different namespaces are different types
      */
     inline bool operator==(const type& lhs, const type& rhs) {
-        if (lhs.get_name() == rhs.get_name() && lhs.get_params().size() == rhs.get_params().size())
+        if (lhs.get_name() == rhs.get_name() && lhs.get_params().size() == rhs.get_params().size() && lhs.get_namespace() == rhs.get_namespace())
             return true;
         else
             return false;
@@ -506,6 +507,7 @@ namespace avalon {
         /**
          * get_type
          * returns the type that corresponds to this type instance
+         * the non-const accessor lets the caller replace the type so it drops the interned identity
          */
         std::shared_ptr<type>& get_type();
         const std::shared_ptr<type>& get_type() const;
@@ -610,6 +612,20 @@ namespace avalon {
         bool is_star();
         bool is_star() const;
 
+        /**
+         * intern
+         * replaces this type instance identity with the unique node held by the type instance interner.
+         * only complete type instances are interned; abstract or incomplete ones are left untouched.
+         */
+        void intern();
+
+        /**
+         * get_canonical
+         * returns the unique interned node that is structurally equal to this type instance
+         * or a null pointer if this type instance was never interned or was modified since.
+         */
+        const type_instance * get_canonical() const;
+
     private:
         /*
          * the name of the type
@@ -676,10 +692,21 @@ namespace avalon {
          */
         bool m_is_reference;
 
+        /*
+         * the interned node this type instance is structurally equal to
+         * any change that can affect the structure of this type instance resets it
+         */
+        const type_instance * m_canonical;
+
     /**
      * a friend function that helps us std::cout type instances
      */
     friend std::ostream& operator<<(std::ostream& os, const type_instance& instance);
+
+    /**
+     * the interner marks the nodes it owns as their own canonical representative
+     */
+    friend const type_instance * intern_type_instance(const type_instance& instance);
     };
 
     /**
@@ -694,6 +721,14 @@ namespace avalon {
      */
     std::ostream& operator<<(std::ostream& os, const type_instance& instance);
 
+    /**
+     * intern_type_instance
+     * given a complete type instance, returns the unique immutable node that represents it.
+     * structurally equal type instances share the same node so interned type instances compare by address.
+     * returns a null pointer if the type instance is abstract or incomplete.
+     */
+    const type_instance * intern_type_instance(const type_instance& instance);
+
     /**
      * strong_compare
      * does a strong comparison of type instances
@@ -872,6 +907,13 @@ namespace avalon {
          */
         std::vector<type_instance>& get_params_as_vector();
 
+        /**
+         * get_param_index
+         * returns the position of the given parameter inside values built by this constructor.
+         * values store their fields in the order of the parameters map so this position is the same for all of them.
+         */
+        std::size_t get_param_index(const token& param_name);
+
         /**
          * set_is_parametrized
          * if the constructor relies on an unknown type,
@@ -925,6 +967,13 @@ namespace avalon {
     std::string mangle_constructor(record_constructor& rec_cons);
     std::string mangle_constructor(const std::string& name, std::vector<type_instance>& params);
     std::string mangle_constructor(const std::string& name, std::vector<type_instance>& params, type_instance& parent_type_instance);
+
+    /**
+     * get_record_field
+     * if values of the given type instance are all built by the same record constructor and that constructor has the given field,
+     * sets the position of the field inside those values and the type instance of the field then returns true.
+     */
+    bool get_record_field(type_instance& instance, const token& field_name, std::size_t& index, type_instance& field_instance);
 }
 
 #endif
@@ -49,7 +49,7 @@ namespace avalon {
      * - the token with source code information, including the variable name
      * - whether the variable is mutable
      */
-    variable::variable(token& tok, bool is_mutable) : m_name(tok.get_lexeme()), m_tok(tok), m_is_mutable(is_mutable), m_namespace("*"), m_parent_scope(nullptr), m_value(nullptr), m_is_valid(UNKNOWN), m_check_initializer(true), m_is_public(true), m_is_global(false), m_is_used(false), m_is_reference(false), m_is_temporary(false), m_reachable(false), m_terminates(false) {
+    variable::variable(token& tok, bool is_mutable) : m_name(tok.get_lexeme()), m_tok(tok), m_is_mutable(is_mutable), m_namespace("*"), m_parent_scope(nullptr), m_value(nullptr), m_is_valid(UNKNOWN), m_check_initializer(true), m_is_public(true), m_is_global(false), m_is_used(false), m_is_reference(false), m_is_temporary(false), m_is_interpreted(false), m_reachable(false), m_terminates(false) {
     }
 
     /**
@@ -58,7 +58,7 @@ namespace avalon {
      * - whether the variable is mutable
      * - the validation state of the variable
      */
-    variable::variable(token& tok, bool is_mutable, validation_state is_valid) : m_name(tok.get_lexeme()), m_tok(tok), m_is_mutable(is_mutable), m_namespace("*"), m_parent_scope(nullptr), m_value(nullptr), m_is_valid(is_valid), m_is_public(true), m_is_global(false), m_is_used(false), m_is_reference(false), m_is_temporary(false), m_is_interpreted(false), m_reachable(false), m_terminates(false) {        
+    variable::variable(token& tok, bool is_mutable, validation_state is_valid) : m_name(tok.get_lexeme()), m_tok(tok), m_is_mutable(is_mutable), m_namespace("*"), m_parent_scope(nullptr), m_value(nullptr), m_is_valid(is_valid), m_check_initializer(true), m_is_public(true), m_is_global(false), m_is_used(false), m_is_reference(false), m_is_temporary(false), m_is_interpreted(false), m_reachable(false), m_terminates(false) {        
     }
 
     /**
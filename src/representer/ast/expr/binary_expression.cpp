@@ -22,6 +22,7 @@
  *  SOFTWARE.
  */
 
+#include <cstddef>
 #include <memory>
 
 #include "representer/ast/expr/binary_expression.hpp"
@@ -37,13 +38,13 @@ namespace avalon {
      * - the left operand to the binary operator
      * - and the right operand to the binary operator
      */
-    binary_expression::binary_expression(token& tok, binary_expression_type expr_type, std::shared_ptr<expr>& lval, std::shared_ptr<expr>& rval) : m_tok(tok), m_expr_type(expr_type), m_lval(lval), m_rval(rval), m_callee("") {
+    binary_expression::binary_expression(token& tok, binary_expression_type expr_type, std::shared_ptr<expr>& lval, std::shared_ptr<expr>& rval) : m_tok(tok), m_expr_type(expr_type), m_lval(lval), m_rval(rval), m_callee(""), m_element_index(0), m_has_element_index(false) {
     }
 
     /**
      * copy constructor
      */
-    binary_expression::binary_expression(const std::shared_ptr<binary_expression>& bin_expr) : m_tok(bin_expr -> get_token()), m_instance(bin_expr -> get_type_instance()), m_expr_type(bin_expr -> get_expression_type()), m_lval(bin_expr -> get_lval() -> copy()), m_rval(bin_expr -> get_rval() -> copy()), m_callee(bin_expr -> get_callee()) {
+    binary_expression::binary_expression(const std::shared_ptr<binary_expression>& bin_expr) : m_tok(bin_expr -> get_token()), m_instance(bin_expr -> get_type_instance()), m_expr_type(bin_expr -> get_expression_type()), m_lval(bin_expr -> get_lval() -> copy()), m_rval(bin_expr -> get_rval() -> copy()), m_callee(bin_expr -> get_callee()), m_element_index(bin_expr -> get_element_index()), m_has_element_index(bin_expr -> has_element_index()) {
     }
 
     /**
@@ -56,6 +57,8 @@ namespace avalon {
         m_lval = bin_expr -> get_lval() -> copy();
         m_rval = bin_expr -> get_rval() -> copy();
         m_callee = bin_expr -> get_callee();
+        m_element_index = bin_expr -> get_element_index();
+        m_has_element_index = bin_expr -> has_element_index();
         return * this;
     }
 
@@ -133,4 +136,29 @@ namespace avalon {
     const std::string& binary_expression::get_callee() {
         return m_callee;
     }
+
+    /**
+     * set_element_index
+     * sets the position of the element this dot or subscript expression reads inside the value of its lval
+     */
+    void binary_expression::set_element_index(std::size_t index) {
+        m_element_index = index;
+        m_has_element_index = true;
+    }
+
+    /**
+     * get_element_index
+     * returns the position of the element this dot or subscript expression reads inside the value of its lval
+     */
+    std::size_t binary_expression::get_element_index() {
+        return m_element_index;
+    }
+
+    /**
+     * has_element_index
+     * returns true if the element this dot or subscript expression reads was resolved to a position during checking
+     */
+    bool binary_expression::has_element_index() {
+        return m_has_element_index;
+    }
 }
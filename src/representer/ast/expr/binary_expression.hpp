@@ -26,6 +26,7 @@
 #define AVALON_AST_EXPR_BINARY_EXPRESSION_HPP_
 
 #include <utility>
+#include <cstddef>
 #include <memory>
 
 #include "representer/ast/expr/expr.hpp"
@@ -138,6 +139,24 @@ namespace avalon {
          */
         const std::string& get_callee();
 
+        /**
+         * set_element_index
+         * sets the position of the element this dot or subscript expression reads inside the value of its lval
+         */
+        void set_element_index(std::size_t index);
+
+        /**
+         * get_element_index
+         * returns the position of the element this dot or subscript expression reads inside the value of its lval
+         */
+        std::size_t get_element_index();
+
+        /**
+         * has_element_index
+         * returns true if the element this dot or subscript expression reads was resolved to a position during checking
+         */
+        bool has_element_index();
+
         /**
          * token
          * returns this expression token
@@ -208,6 +227,16 @@ namespace avalon {
          * the final name of the function to call
          */        
         std::string m_callee;
+
+        /*
+         * the position of the element read by a dot or subscript expression
+         */
+        std::size_t m_element_index;
+
+        /*
+         * flag set to true if the element read by a dot or subscript expression was resolved to a position
+         */
+        bool m_has_element_index;
     };
 }
 
@@ -27,6 +27,8 @@
 #include <string>
 #include <tuple>
 
+#include <Eigen/Dense>
+
 #include "representer/ast/expr/call_expression.hpp"
 #include "representer/ast/expr/expr.hpp"
 #include "representer/ast/decl/type.hpp"
@@ -43,8 +45,9 @@ namespace avalon {
     /**
      * copy constructor
      */
-    call_expression::call_expression(const std::shared_ptr<call_expression>& call_expr) : m_tok(call_expr -> get_token()), m_namespace(call_expr -> get_namespace()), m_name(call_expr -> get_name()), m_instance(call_expr -> get_type_instance()), m_expr_type(call_expr -> get_expression_type()), m_type_instance_from_parser(call_expr -> type_instance_from_parser()), m_return_type(call_expr -> get_return_type_instance()), m_callee(call_expr -> get_callee()) {
+    call_expression::call_expression(const std::shared_ptr<call_expression>& call_expr) : m_tok(call_expr -> get_token()), m_namespace(call_expr -> get_namespace()), m_name(call_expr -> get_name()), m_instance(call_expr -> get_type_instance()), m_expr_type(call_expr -> get_expression_type()), m_type_instance_from_parser(call_expr -> type_instance_from_parser()), m_return_type(call_expr -> get_return_type_instance()), m_callee(call_expr -> get_callee()), m_unitary(call_expr -> m_unitary) {
         m_specializations = call_expr -> get_specializations();
+        m_evaluation_order = call_expr -> get_evaluation_order();
         std::vector<std::pair<token, std::shared_ptr<expr> > >& arguments = call_expr -> get_arguments();
         for(const auto& argument : arguments)
             m_arguments.emplace_back(argument.first, argument.second -> copy());
@@ -64,8 +67,10 @@ namespace avalon {
         std::vector<std::pair<token, std::shared_ptr<expr> > >& arguments = call_expr -> get_arguments();
         for(const auto& argument : arguments)
             m_arguments.emplace_back(argument.first, argument.second -> copy());
+        m_evaluation_order = call_expr -> get_evaluation_order();
         m_return_type = call_expr -> get_return_type_instance();
         m_callee = call_expr -> get_callee();
+        m_unitary = call_expr -> m_unitary;
         return * this;
     }
 
@@ -195,6 +200,23 @@ namespace avalon {
         return m_arguments;
     }
 
+    /**
+     * set_evaluation_order
+     * record constructor arguments are stored in the order of the constructor parameters,
+     * this sets the positions of the stored arguments in the order the source gave them so they are evaluated in that order
+     */
+    void call_expression::set_evaluation_order(const std::vector<std::size_t>& order) {
+        m_evaluation_order = order;
+    }
+
+    /**
+     * get_evaluation_order
+     * returns the positions of the arguments in the order they must be evaluated, empty if it is the order they are stored in
+     */
+    const std::vector<std::size_t>& call_expression::get_evaluation_order() const {
+        return m_evaluation_order;
+    }
+
     /**
      * set_return_type_instance
      * set the expected return type instance of the function that corresponds to this function call
@@ -276,4 +298,28 @@ namespace avalon {
     const std::tuple<std::string, std::string, std::size_t>& call_expression::get_callee() {
         return m_callee;
     }
+
+    /**
+     * set_unitary
+     * caches the unitary matrix computed from the arguments of a gate constructor
+     */
+    void call_expression::set_unitary(const Eigen::Matrix2cd& unitary) {
+        m_unitary = std::allocate_shared<Eigen::Matrix2cd>(Eigen::aligned_allocator<Eigen::Matrix2cd>(), unitary);
+    }
+
+    /**
+     * has_unitary
+     * returns true if the unitary matrix of this gate constructor was already computed
+     */
+    bool call_expression::has_unitary() const {
+        return m_unitary != nullptr;
+    }
+
+    /**
+     * get_unitary
+     * returns the unitary matrix computed from the arguments of this gate constructor
+     */
+    const Eigen::Matrix2cd& call_expression::get_unitary() const {
+        return * m_unitary;
+    }
 }
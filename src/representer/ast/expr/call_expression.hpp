@@ -30,6 +30,8 @@
 #include <string>
 #include <tuple>
 
+#include <Eigen/Dense>
+
 #include "representer/ast/expr/expr.hpp"
 #include "representer/ast/decl/type.hpp"
 #include "lexer/token.hpp"
@@ -151,6 +153,19 @@ namespace avalon {
          */
         std::vector<std::pair<token, std::shared_ptr<expr> > >& get_arguments();
 
+        /**
+         * set_evaluation_order
+         * record constructor arguments are stored in the order of the constructor parameters,
+         * this sets the positions of the stored arguments in the order the source gave them so they are evaluated in that order
+         */
+        void set_evaluation_order(const std::vector<std::size_t>& order);
+
+        /**
+         * get_evaluation_order
+         * returns the positions of the arguments in the order they must be evaluated, empty if it is the order they are stored in
+         */
+        const std::vector<std::size_t>& get_evaluation_order() const;
+
         /**
          * set_return_type_instance
          * set the expected return type instance of the function that corresponds to this function call
@@ -193,6 +208,24 @@ namespace avalon {
          */
         const std::tuple<std::string, std::string, std::size_t>& get_callee();
 
+        /**
+         * set_unitary
+         * caches the unitary matrix computed from the arguments of a gate constructor
+         */
+        void set_unitary(const Eigen::Matrix2cd& unitary);
+
+        /**
+         * has_unitary
+         * returns true if the unitary matrix of this gate constructor was already computed
+         */
+        bool has_unitary() const;
+
+        /**
+         * get_unitary
+         * returns the unitary matrix computed from the arguments of this gate constructor
+         */
+        const Eigen::Matrix2cd& get_unitary() const;
+
         /**
          * token
          * returns this expression token
@@ -275,6 +308,11 @@ namespace avalon {
          */
         std::vector<std::pair<token, std::shared_ptr<expr> > > m_arguments;
 
+        /*
+         * the positions of the arguments in the order they were given in the source, empty if it is the order they are stored in
+         */
+        std::vector<std::size_t> m_evaluation_order;
+
         /*
          * the return type of the function call
          */
@@ -284,6 +322,11 @@ namespace avalon {
          * the namespace, name and arity of the constructor/function that resolves to this expression
          */
         std::tuple<std::string, std::string, std::size_t> m_callee;
+
+        /*
+         * the unitary matrix of a gate constructor, computed once then reused every time the gate is applied
+         */
+        std::shared_ptr<Eigen::Matrix2cd> m_unitary;
     };
 }
 
@@ -45,7 +45,22 @@
 #include "representer/ast/expr/expr.hpp"
 
 
+/* Utils */
+#include "utils/stats.hpp"
+
+
 namespace avalon {
+    /**
+     * the constructors only record the creation of the node for statistics
+     */
+    expr::expr() {
+        stats::count_node();
+    }
+
+    expr::expr(const expr& an_expr) : std::enable_shared_from_this<expr>() {
+        stats::count_node();
+    }
+
     /**
      * copy
      * creates a copy of an expression and returns it.
@@ -33,6 +33,12 @@
 namespace avalon {
     class expr : public std::enable_shared_from_this<expr> {
     public:
+        /**
+         * the constructors only record the creation of the node for statistics
+         */
+        expr();
+        expr(const expr& an_expr);
+
         /**
          * copy
          * creates a copy of an expression and returns it.
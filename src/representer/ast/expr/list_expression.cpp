@@ -34,7 +34,7 @@ namespace avalon {
     /**
      * the constructor expects the token with source code information
      */
-    list_expression::list_expression(token& tok) : m_tok(tok), m_type_instance_from_parser(false) {
+    list_expression::list_expression(const token& tok) : m_tok(tok), m_type_instance_from_parser(false) {
     }
 
     /**
@@ -39,7 +39,7 @@ namespace avalon {
         /**
          * the constructor expects the token with source code information
          */
-        list_expression(token& tok);
+        list_expression(const token& tok);
 
         /**
          * get_token
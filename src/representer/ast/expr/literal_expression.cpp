@@ -26,7 +26,6 @@
 #include <iterator>
 #include <cstdlib>
 #include <memory>
-#include <bitset>
 #include <vector>
 #include <string>
 
@@ -36,6 +35,8 @@
 #include "representer/exceptions/value_error.hpp"
 #include "representer/ast/expr/expr.hpp"
 #include "representer/ast/decl/type.hpp"
+#include "utils/shared_string.hpp"
+#include "utils/bit_vector.hpp"
 #include "lexer/token.hpp"
 
 
@@ -43,13 +44,31 @@ namespace avalon {
     /**
      * the constructor expects the operand of the literal operator
      */
-    literal_expression::literal_expression(token& tok, literal_expression_type expr_type, const std::string& val) : m_tok(tok), m_type_instance_from_parser(false), m_expr_type(expr_type), m_val(val), m_start_index(0), m_end_index(0), m_was_measured(false) {
+    literal_expression::literal_expression(const token& tok, literal_expression_type expr_type, const std::string& val) : m_tok(tok), m_type_instance_from_parser(false), m_expr_type(expr_type), m_val(val), m_has_bits(false), m_has_string(false), m_int(0), m_has_int(false), m_val_stale(false), m_start_index(0), m_end_index(0), m_was_measured(false) {
+    }
+
+    /**
+     * this constructor expects the bits held by a bit literal, the string representation is only built if asked for
+     */
+    literal_expression::literal_expression(const token& tok, const bit_vector& bits) : m_tok(tok), m_type_instance_from_parser(false), m_expr_type(BIT_EXPR), m_bits(bits), m_has_bits(true), m_has_string(false), m_int(0), m_has_int(false), m_val_stale(true), m_start_index(0), m_end_index(0), m_was_measured(false) {
+    }
+
+    /**
+     * this constructor expects the string held by a string literal, the flat string is only built if asked for
+     */
+    literal_expression::literal_expression(const token& tok, const shared_string& str) : m_tok(tok), m_type_instance_from_parser(false), m_expr_type(STRING_EXPR), m_has_bits(false), m_string(str), m_has_string(true), m_int(0), m_has_int(false), m_val_stale(true), m_start_index(0), m_end_index(0), m_was_measured(false) {
+    }
+
+    /**
+     * this constructor expects the value held by an integer literal, the string representation is only built if asked for
+     */
+    literal_expression::literal_expression(const token& tok, long long int value) : m_tok(tok), m_type_instance_from_parser(false), m_expr_type(INTEGER_EXPR), m_has_bits(false), m_has_string(false), m_int(value), m_has_int(true), m_val_stale(true), m_start_index(0), m_end_index(0), m_was_measured(false) {
     }
 
     /**
      * copy constructor
      */
-    literal_expression::literal_expression(const std::shared_ptr<literal_expression>& lit_expr) : m_tok(lit_expr -> get_token()), m_instance(lit_expr -> get_type_instance()), m_type_instance_from_parser(lit_expr -> type_instance_from_parser()), m_expr_type(lit_expr -> get_expression_type()), m_val(lit_expr -> get_value()) {
+    literal_expression::literal_expression(const std::shared_ptr<literal_expression>& lit_expr) : m_tok(lit_expr -> get_token()), m_instance(lit_expr -> get_type_instance()), m_type_instance_from_parser(lit_expr -> type_instance_from_parser()), m_expr_type(lit_expr -> get_expression_type()), m_val(lit_expr -> m_val), m_bits(lit_expr -> m_bits), m_has_bits(lit_expr -> m_has_bits), m_string(lit_expr -> m_string), m_has_string(lit_expr -> m_has_string), m_int(lit_expr -> m_int), m_has_int(lit_expr -> m_has_int), m_val_stale(lit_expr -> m_val_stale) {
         if(lit_expr -> get_expression_type() == QUBIT_EXPR) {
             m_ket = lit_expr -> get_qubit_value();
             m_start_index = lit_expr -> get_start_index();
@@ -66,7 +85,14 @@ namespace avalon {
         m_instance = lit_expr -> get_type_instance();
         m_type_instance_from_parser = lit_expr -> type_instance_from_parser();
         m_expr_type = lit_expr -> get_expression_type();
-        m_val = lit_expr -> get_value();
+        m_val = lit_expr -> m_val;
+        m_bits = lit_expr -> m_bits;
+        m_has_bits = lit_expr -> m_has_bits;
+        m_string = lit_expr -> m_string;
+        m_has_string = lit_expr -> m_has_string;
+        m_int = lit_expr -> m_int;
+        m_has_int = lit_expr -> m_has_int;
+        m_val_stale = lit_expr -> m_val_stale;
         if(lit_expr -> get_expression_type() == QUBIT_EXPR) {
             m_ket = lit_expr -> get_qubit_value();
             m_start_index = lit_expr -> get_start_index();
@@ -143,6 +169,15 @@ namespace avalon {
      * returns the literal operator operand
      */
     const std::string& literal_expression::get_value() const {
+        if(m_val_stale) {
+            if(m_has_bits)
+                m_val = m_bits.to_string();
+            else if(m_has_int)
+                m_val = std::to_string(m_int);
+            else
+                m_val = m_string.str();
+            m_val_stale = false;
+        }
         return m_val;
     }
 
@@ -151,7 +186,11 @@ namespace avalon {
      * returns the length of the string representation of the literal within this expression
      */
     std::size_t literal_expression::get_length() const {
-        return m_val.length();
+        if(m_has_bits)
+            return m_bits.size();
+        if(m_has_string)
+            return m_string.length();
+        return get_value().length();
     }
 
     /**
@@ -161,6 +200,8 @@ namespace avalon {
      */
     long long int literal_expression::get_int_value() {
         if(m_expr_type == INTEGER_EXPR) {
+            if(m_has_int)
+                return m_int;
             char * end = NULL;
             long long int value = std::strtoll(m_val.c_str(), &end, 10);
             return value;
@@ -192,7 +233,7 @@ namespace avalon {
      */
     std::string literal_expression::get_string_value() {
         if(m_expr_type == STRING_EXPR) {
-            return m_val;
+            return get_value();
         }
         else {
             throw value_error("This literal expression doesn't contain a string.");
@@ -200,59 +241,37 @@ namespace avalon {
     }
 
     /**
-     * get_bit_value
-     * returns the 1 bit bitset representating of this literal
+     * get_shared_string_value
+     * returns the shared string held by this literal, which can be concatenated, sliced and reversed without copying
      * throws a value_error exception if it contains a different literal type
      */
-    std::bitset<1> literal_expression::get_bit_value() {
-        if(m_expr_type == BIT_EXPR) {
-            std::bitset<1> bitstring(m_val);
-            return bitstring;
-        }
-        else {
-            throw value_error("This literal expression doesn't contain a bit string.");
-        }
-    }
-
-    /**
-     * get_bit2_value
-     * returns the 2 bits bitset representating of this literal
-     * throws a value_error exception if it contains a different literal type
-     */
-    std::bitset<2> literal_expression::get_bit2_value() {
-        if(m_expr_type == BIT_EXPR) {
-            std::bitset<2> bitstring(m_val);
-            return bitstring;
-        }
-        else {
-            throw value_error("This literal expression doesn't contain a bit string.");
-        }
-    }
-
-    /**
-     * get_bit4_value
-     * returns the 4 bits bitset representating of this literal
-     * throws a value_error exception if it contains a different literal type
-     */
-    std::bitset<4> literal_expression::get_bit4_value() {
-        if(m_expr_type == BIT_EXPR) {
-            std::bitset<4> bitstring(m_val);
-            return bitstring;
+    const shared_string& literal_expression::get_shared_string_value() {
+        if(m_expr_type == STRING_EXPR) {
+            // literals coming from the source are only shared the first time they are used
+            if(m_has_string == false) {
+                m_string = shared_string(m_val);
+                m_has_string = true;
+            }
+            return m_string;
         }
         else {
-            throw value_error("This literal expression doesn't contain a bit string.");
+            throw value_error("This literal expression doesn't contain a string.");
         }
     }
 
     /**
-     * get_bit8_value
-     * returns the 8 bits bitset representating of this literal
+     * get_bits_value
+     * returns the packed bits held by this literal
      * throws a value_error exception if it contains a different literal type
      */
-    std::bitset<8> literal_expression::get_bit8_value() {
+    const bit_vector& literal_expression::get_bits_value() {
         if(m_expr_type == BIT_EXPR) {
-            std::bitset<8> bitstring(m_val);
-            return bitstring;
+            // literals coming from the source are only packed the first time they are used
+            if(m_has_bits == false) {
+                m_bits = bit_vector(m_val);
+                m_has_bits = true;
+            }
+            return m_bits;
         }
         else {
             throw value_error("This literal expression doesn't contain a bit string.");
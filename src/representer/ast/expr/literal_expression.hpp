@@ -28,13 +28,14 @@
 #include <cstddef>
 #include <memory>
 #include <string>
-#include <bitset>
 #include <vector>
 
 #include "qpp.h"
 
 #include "representer/ast/expr/expr.hpp"
 #include "representer/ast/decl/type.hpp"
+#include "utils/shared_string.hpp"
+#include "utils/bit_vector.hpp"
 #include "lexer/token.hpp"
 
 
@@ -58,7 +59,22 @@ namespace avalon {
         /**
          * the constructor expects the token with source code information
          */
-        literal_expression(token& tok, literal_expression_type expr_type, const std::string& val);
+        literal_expression(const token& tok, literal_expression_type expr_type, const std::string& val);
+
+        /**
+         * this constructor expects the bits held by a bit literal, the string representation is only built if asked for
+         */
+        literal_expression(const token& tok, const bit_vector& bits);
+
+        /**
+         * this constructor expects the string held by a string literal, the flat string is only built if asked for
+         */
+        literal_expression(const token& tok, const shared_string& str);
+
+        /**
+         * this constructor expects the value held by an integer literal, the string representation is only built if asked for
+         */
+        literal_expression(const token& tok, long long int value);
 
         /**
          * copy constructor
@@ -148,32 +164,18 @@ namespace avalon {
         std::string get_string_value();
 
         /**
-         * get_bit_value
-         * returns the 1 bit bitset representating of this literal
+         * get_shared_string_value
+         * returns the shared string held by this literal, which can be concatenated, sliced and reversed without copying
          * throws a value_error exception if it contains a different literal type
          */
-        std::bitset<1> get_bit_value();
+        const shared_string& get_shared_string_value();
 
         /**
-         * get_bit2_value
-         * returns the 2 bits bitset representating of this literal
+         * get_bits_value
+         * returns the packed bits held by this literal
          * throws a value_error exception if it contains a different literal type
          */
-        std::bitset<2> get_bit2_value();
-
-        /**
-         * get_bit4_value
-         * returns the 4 bits bitset representating of this literal
-         * throws a value_error exception if it contains a different literal type
-         */
-        std::bitset<4> get_bit4_value();
-
-        /**
-         * get_bit8_value
-         * returns the 8 bits bitset representating of this literal
-         * throws a value_error exception if it contains a different literal type
-         */
-        std::bitset<8> get_bit8_value();
+        const bit_vector& get_bits_value();
 
         /**
          * get_qubit_value
@@ -289,7 +291,33 @@ namespace avalon {
         /*
          * the string representation of the literal
          */
-        std::string m_val;
+        mutable std::string m_val;
+
+        /*
+         * Bits special case:
+         * bitwise operations work on the packed bits kept here and the string representation is rebuilt only when asked for.
+         */
+        bit_vector m_bits;
+        bool m_has_bits;
+
+        /*
+         * Strings special case:
+         * string builtins work on the shared string kept here and the flat string is rebuilt only when asked for.
+         */
+        shared_string m_string;
+        bool m_has_string;
+
+        /*
+         * Integers special case:
+         * integers created by the interpreter keep their value here and the string representation is rebuilt only when asked for.
+         */
+        long long int m_int;
+        bool m_has_int;
+
+        /*
+         * true if the string representation has to be rebuilt from the packed bits, the shared string or the integer
+         */
+        mutable bool m_val_stale;
 
         /*
          * Qubits special case:
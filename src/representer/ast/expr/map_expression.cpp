@@ -22,27 +22,32 @@
  *  SOFTWARE.
  */
 
+#include <functional>
+#include <cstddef>
 #include <utility>
 #include <memory>
 #include <string>
 
 #include "representer/ast/expr/map_expression.hpp"
 #include "representer/ast/expr/expr.hpp"
+#include "representer/ast/decl/function.hpp"
 #include "representer/ast/decl/type.hpp"
 #include "lexer/token.hpp"
 
 
 namespace avalon {
+    const std::size_t map_expression::npos = static_cast<std::size_t>(-1);
+
     /**
      * the constructor expects the token with source code information
      */
-    map_expression::map_expression(token& tok) : m_tok(tok), m_type_instance_from_parser(false), m_callee(""), m_comp_callee("") {
+    map_expression::map_expression(token& tok) : m_tok(tok), m_type_instance_from_parser(false), m_callee(""), m_comp_callee(""), m_hash_function(nullptr), m_comp_function(nullptr) {
     }
 
     /**
      * copy constructor
      */
-    map_expression::map_expression(const std::shared_ptr<map_expression>& map_expr) : m_tok(map_expr -> get_token()), m_instance(map_expr -> get_type_instance()), m_type_instance_from_parser(map_expr -> type_instance_from_parser()), m_callee(map_expr -> get_callee()), m_comp_callee(map_expr -> get_comparator_callee()) {
+    map_expression::map_expression(const std::shared_ptr<map_expression>& map_expr) : m_tok(map_expr -> get_token()), m_instance(map_expr -> get_type_instance()), m_type_instance_from_parser(map_expr -> type_instance_from_parser()), m_callee(map_expr -> get_callee()), m_comp_callee(map_expr -> get_comparator_callee()), m_hash_function(map_expr -> get_hash_function()), m_comp_function(map_expr -> get_comparator_function()), m_hashes(map_expr -> m_hashes), m_slots(map_expr -> m_slots) {
         std::vector<std::pair<std::shared_ptr<expr>, std::shared_ptr<expr> > >& elements = map_expr -> get_elements();
         for(const auto& element : elements)
             m_elements.emplace_back(element.first -> copy(), element.second -> copy());
@@ -52,14 +57,26 @@ namespace avalon {
      * assignment copy operator
      */
     map_expression& map_expression::operator=(const std::shared_ptr<map_expression>& map_expr) {
+        if(map_expr.get() == this)
+            return * this;
+
         m_tok = map_expr -> get_token();
         m_instance = map_expr -> get_type_instance();
         m_type_instance_from_parser = map_expr -> type_instance_from_parser();
         m_callee = map_expr -> get_callee();
         m_comp_callee = map_expr -> get_comparator_callee();
+        m_hash_function = map_expr -> get_hash_function();
+        m_comp_function = map_expr -> get_comparator_function();
+        m_elements.clear();
         std::vector<std::pair<std::shared_ptr<expr>, std::shared_ptr<expr> > >& elements = map_expr -> get_elements();
         for(const auto& element : elements)
             m_elements.emplace_back(element.first -> copy(), element.second -> copy());
+
+        // the copied keys hash the same as the originals so the index is rebuilt over the copied elements from their hashes
+        m_hashes.clear();
+        m_slots.clear();
+        if(map_expr -> is_indexed())
+            build_index(map_expr -> m_hashes);
         return * this;
     }
 
@@ -123,6 +140,9 @@ namespace avalon {
      */
     void map_expression::add_element(std::shared_ptr<expr>& key, std::shared_ptr<expr>& value) {
         m_elements.emplace_back(key, value);
+        // we don't know the hash of the new key so the index will have to be rebuilt
+        m_hashes.clear();
+        m_slots.clear();
     }
 
     /**
@@ -165,6 +185,38 @@ namespace avalon {
         return m_comp_callee;
     }
 
+    /**
+     * set_hash_function
+     * sets the resolved function to hash keys, it is only set for keys of custom types
+     */
+    void map_expression::set_hash_function(std::shared_ptr<function>& hash_function) {
+        m_hash_function = hash_function;
+    }
+
+    /**
+     * get_hash_function
+     * returns the resolved function to hash keys, null when keys are hashed natively
+     */
+    std::shared_ptr<function>& map_expression::get_hash_function() {
+        return m_hash_function;
+    }
+
+    /**
+     * set_comparator_function
+     * sets the resolved function to compare keys, it is only set for keys of custom types that have an __eq__ function
+     */
+    void map_expression::set_comparator_function(std::shared_ptr<function>& comp_function) {
+        m_comp_function = comp_function;
+    }
+
+    /**
+     * get_comparator_function
+     * returns the resolved function to compare keys, null when keys are compared natively or by their hash
+     */
+    std::shared_ptr<function>& map_expression::get_comparator_function() {
+        return m_comp_function;
+    }
+
     /**
      * get_length
      * returns the length of the map
@@ -172,4 +224,130 @@ namespace avalon {
     std::size_t map_expression::get_length() const {
         return m_elements.size();
     }
+
+    /**
+     * is_indexed
+     * returns true if the hash index over the elements has been built
+     */
+    bool map_expression::is_indexed() const {
+        return m_slots.empty() == false;
+    }
+
+    /**
+     * build_index
+     * builds the hash index given the hash of the key of every element, in the order of the elements
+     */
+    void map_expression::build_index(const std::vector<std::size_t>& hashes) {
+        m_hashes = hashes;
+        resize_index(m_hashes.size());
+    }
+
+    /**
+     * find_element
+     * returns the position of the element whose key has the given hash and satisfies the given predicate
+     * returns npos if there is no such element
+     */
+    std::size_t map_expression::find_element(std::size_t hash, const std::function<bool(std::shared_ptr<expr>&)>& is_key) {
+        std::size_t mask = m_slots.size() - 1;
+        for(std::size_t slot = home_slot(hash); m_slots[slot] != 0; slot = (slot + 1) & mask) {
+            std::size_t position = m_slots[slot] - 1;
+            // we only call the predicate (which might be a user function) when the hashes match
+            if(m_hashes[position] == hash && is_key(m_elements[position].first))
+                return position;
+        }
+        return npos;
+    }
+
+    /**
+     * insert_element
+     * adds a new key/value pair to the map and to its index, the key must not already be in the map
+     */
+    void map_expression::insert_element(std::shared_ptr<expr>& key, std::shared_ptr<expr>& value, std::size_t hash) {
+        if((m_elements.size() + 1) * 2 > m_slots.size())
+            resize_index(m_elements.size() + 1);
+
+        m_elements.emplace_back(key, value);
+        m_hashes.push_back(hash);
+
+        std::size_t mask = m_slots.size() - 1;
+        std::size_t slot = home_slot(hash);
+        while(m_slots[slot] != 0)
+            slot = (slot + 1) & mask;
+        m_slots[slot] = m_elements.size();
+    }
+
+    /**
+     * remove_element
+     * removes the element at the given position, the last element takes its place
+     */
+    void map_expression::remove_element(std::size_t position) {
+        std::size_t mask = m_slots.size() - 1;
+
+        // empty the slot of the removed element then shift back the elements that follow it in the same probe sequence
+        // this keeps every element reachable from its home slot without leaving tombstones behind
+        std::size_t hole = find_slot(position);
+        m_slots[hole] = 0;
+        for(std::size_t slot = (hole + 1) & mask; m_slots[slot] != 0; slot = (slot + 1) & mask) {
+            std::size_t home = home_slot(m_hashes[m_slots[slot] - 1]);
+            bool can_move = (hole <= slot) ? (home <= hole || home > slot) : (home <= hole && home > slot);
+            if(can_move) {
+                m_slots[hole] = m_slots[slot];
+                m_slots[slot] = 0;
+                hole = slot;
+            }
+        }
+
+        // move the last element into the position left free
+        std::size_t last = m_elements.size() - 1;
+        if(position != last) {
+            m_slots[find_slot(last)] = position + 1;
+            m_elements[position] = m_elements[last];
+            m_hashes[position] = m_hashes[last];
+        }
+        m_elements.pop_back();
+        m_hashes.pop_back();
+    }
+
+    /*
+     * home_slot
+     * returns the slot where probing for the given hash starts
+     */
+    std::size_t map_expression::home_slot(std::size_t hash) const {
+        // user hashes can be poorly distributed (sequential integers for instance) so we mix the bits before masking
+        std::size_t mixed = hash * static_cast<std::size_t>(0x9E3779B97F4A7C15ULL);
+        mixed = mixed ^ (mixed >> 29);
+        return mixed & (m_slots.size() - 1);
+    }
+
+    /*
+     * find_slot
+     * returns the slot that holds the element at the given position
+     */
+    std::size_t map_expression::find_slot(std::size_t position) const {
+        std::size_t mask = m_slots.size() - 1;
+        std::size_t slot = home_slot(m_hashes[position]);
+        while(m_slots[slot] != position + 1)
+            slot = (slot + 1) & mask;
+        return slot;
+    }
+
+    /*
+     * resize_index
+     * sizes the table for the given number of elements and reinserts every element
+     */
+    void map_expression::resize_index(std::size_t count) {
+        // we keep the table at most half full so probe sequences stay short
+        std::size_t capacity = 8;
+        while(capacity < count * 2)
+            capacity = capacity * 2;
+
+        m_slots.assign(capacity, 0);
+        std::size_t mask = capacity - 1;
+        for(std::size_t position = 0; position < m_hashes.size(); position++) {
+            std::size_t slot = home_slot(m_hashes[position]);
+            while(m_slots[slot] != 0)
+                slot = (slot + 1) & mask;
+            m_slots[slot] = position + 1;
+        }
+    }
 }
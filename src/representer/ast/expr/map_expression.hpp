@@ -25,6 +25,8 @@
 #ifndef AVALON_AST_EXPR_MAP_EXPRESSION_HPP_
 #define AVALON_AST_EXPR_MAP_EXPRESSION_HPP_
 
+#include <functional>
+#include <cstddef>
 #include <utility>
 #include <memory>
 #include <vector>
@@ -35,6 +37,8 @@
 
 
 namespace avalon {
+    class function;
+
     class map_expression : public expr {
     public:
         /**
@@ -126,12 +130,72 @@ namespace avalon {
          */
         const std::string& get_comparator_callee();
 
+        /**
+         * set_hash_function
+         * sets the resolved function to hash keys, it is only set for keys of custom types
+         */
+        void set_hash_function(std::shared_ptr<function>& hash_function);
+
+        /**
+         * get_hash_function
+         * returns the resolved function to hash keys, null when keys are hashed natively
+         */
+        std::shared_ptr<function>& get_hash_function();
+
+        /**
+         * set_comparator_function
+         * sets the resolved function to compare keys, it is only set for keys of custom types that have an __eq__ function
+         */
+        void set_comparator_function(std::shared_ptr<function>& comp_function);
+
+        /**
+         * get_comparator_function
+         * returns the resolved function to compare keys, null when keys are compared natively or by their hash
+         */
+        std::shared_ptr<function>& get_comparator_function();
+
         /**
          * get_length
          * returns the length of the map
          */
         std::size_t get_length() const;
 
+        /**
+         * is_indexed
+         * returns true if the hash index over the elements has been built
+         */
+        bool is_indexed() const;
+
+        /**
+         * build_index
+         * builds the hash index given the hash of the key of every element, in the order of the elements
+         */
+        void build_index(const std::vector<std::size_t>& hashes);
+
+        /**
+         * find_element
+         * returns the position of the element whose key has the given hash and satisfies the given predicate
+         * returns npos if there is no such element
+         */
+        std::size_t find_element(std::size_t hash, const std::function<bool(std::shared_ptr<expr>&)>& is_key);
+
+        /**
+         * insert_element
+         * adds a new key/value pair to the map and to its index, the key must not already be in the map
+         */
+        void insert_element(std::shared_ptr<expr>& key, std::shared_ptr<expr>& value, std::size_t hash);
+
+        /**
+         * remove_element
+         * removes the element at the given position, the last element takes its place
+         */
+        void remove_element(std::size_t position);
+
+        /*
+         * position returned when an element is not found
+         */
+        static const std::size_t npos;
+
         /**
          * token
          * returns this expression token
@@ -201,6 +265,45 @@ namespace avalon {
          * the equality comparator function
          */
         std::string m_comp_callee;
+
+        /*
+         * the resolved hash function
+         */
+        std::shared_ptr<function> m_hash_function;
+
+        /*
+         * the resolved equality comparator function
+         */
+        std::shared_ptr<function> m_comp_function;
+
+        /*
+         * the hash of the key of every element, in the same order as the elements
+         */
+        std::vector<std::size_t> m_hashes;
+
+        /*
+         * the open addressing table (with linear probing) over the elements
+         * each slot holds the position of an element plus one, zero marks an empty slot
+         */
+        std::vector<std::size_t> m_slots;
+
+        /*
+         * home_slot
+         * returns the slot where probing for the given hash starts
+         */
+        std::size_t home_slot(std::size_t hash) const;
+
+        /*
+         * find_slot
+         * returns the slot that holds the element at the given position
+         */
+        std::size_t find_slot(std::size_t position) const;
+
+        /*
+         * resize_index
+         * sizes the table for the given number of elements and reinserts every element
+         */
+        void resize_index(std::size_t count);
     };
 }
 
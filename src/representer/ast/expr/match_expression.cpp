@@ -23,12 +23,22 @@
  */
 
 #include <memory>
+#include <vector>
 
 /* AST */
+#include "representer/ast/expr/identifier_expression.hpp"
+#include "representer/ast/expr/literal_expression.hpp"
+#include "representer/ast/expr/binary_expression.hpp"
 #include "representer/ast/expr/match_expression.hpp"
+#include "representer/ast/expr/call_expression.hpp"
+#include "representer/ast/expr/match_pattern.hpp"
 #include "representer/ast/expr/expr.hpp"
+#include "representer/ast/decl/variable.hpp"
 #include "representer/ast/decl/type.hpp"
 
+/* Symbol table */
+#include "representer/symtable/scope.hpp"
+
 /* Builtins */
 #include "representer/builtins/lang/avalon_bool.hpp"
 
@@ -43,7 +53,7 @@ namespace avalon {
      * - the left operand to the match operator
      * - and the right operand to match operator
      */
-    match_expression::match_expression(token& tok, match_expression_type expr_type, std::shared_ptr<expr>& lval, std::shared_ptr<expr>& rval) : m_tok(tok), m_expr_type(expr_type), m_lval(lval), m_rval(rval) {
+    match_expression::match_expression(token& tok, match_expression_type expr_type, std::shared_ptr<expr>& lval, std::shared_ptr<expr>& rval) : m_tok(tok), m_expr_type(expr_type), m_lval(lval), m_rval(rval), m_pattern(nullptr) {
         avalon_bool avl_bool;
         m_instance = avl_bool.get_type_instance();
     }
@@ -51,7 +61,7 @@ namespace avalon {
     /**
      * copy constructor
      */
-    match_expression::match_expression(const std::shared_ptr<match_expression>& match_expr) : m_tok(match_expr -> get_token()), m_instance(match_expr -> get_type_instance()), m_expr_type(match_expr -> get_expression_type()), m_lval(match_expr -> get_lval() -> copy()), m_rval(match_expr -> get_rval() -> copy()) {
+    match_expression::match_expression(const std::shared_ptr<match_expression>& match_expr) : m_tok(match_expr -> get_token()), m_instance(match_expr -> get_type_instance()), m_expr_type(match_expr -> get_expression_type()), m_lval(match_expr -> get_lval() -> copy()), m_rval(match_expr -> get_rval() -> copy()), m_pattern(nullptr) {
     }
 
     /**
@@ -63,6 +73,7 @@ namespace avalon {
         m_instance = match_expr -> get_type_instance();
         m_lval = match_expr -> get_lval() -> copy();
         m_rval = match_expr -> get_rval() -> copy();
+        m_pattern = nullptr;
         return * this;
     }
 
@@ -105,4 +116,95 @@ namespace avalon {
     std::shared_ptr<expr>& match_expression::get_rval() {
         return m_rval;
     }
+
+    /**
+     * compile_pattern
+     * turns the right operand into the list of tests to perform on the left operand.
+     * the checker calls this once the right operand is checked, capture variables are looked up in the given scope.
+     */
+    void match_expression::compile_pattern(std::shared_ptr<scope>& l_scope) {
+        m_pattern = std::make_shared<match_pattern>();
+
+        // at the top, only literals, identifiers and constructor calls can match anything
+        if(m_rval -> is_literal_expression() || m_rval -> is_identifier_expression() || m_rval -> is_call_expression()) {
+            compile_pattern_node(m_rval, l_scope, m_pattern -> m_nodes, true);
+        }
+        else {
+            pattern_node node;
+            node.m_kind = pattern_node_kind::NONE;
+            m_pattern -> m_nodes.push_back(node);
+        }
+    }
+
+    /**
+     * compile_pattern_node
+     * appends the tests to perform for the given part of the right operand
+     */
+    void match_expression::compile_pattern_node(std::shared_ptr<expr>& rval, std::shared_ptr<scope>& l_scope, std::vector<pattern_node>& nodes, bool top_level) {
+        pattern_node node;
+        node.m_kind = pattern_node_kind::ANY;
+        node.m_arity = 0;
+        node.m_is_call = false;
+
+        // literals are compared by value, we parse them once here
+        if(rval -> is_literal_expression()) {
+            std::shared_ptr<literal_expression> const & rval_lit = std::static_pointer_cast<literal_expression>(rval);
+            node.m_kind = pattern_node_kind::LITERAL;
+            node.m_literal_type = rval_lit -> get_expression_type();
+            if(node.m_literal_type == INTEGER_EXPR)
+                node.m_int = rval_lit -> get_int_value();
+            else if(node.m_literal_type == FLOATING_POINT_EXPR)
+                node.m_float = rval_lit -> get_float_value();
+            else
+                node.m_string = rval_lit -> get_shared_string_value();
+            nodes.push_back(node);
+        }
+        // an identifier is either a constructor or a variable to capture the value into
+        // at the top, it is always compared by name
+        else if(rval -> is_identifier_expression()) {
+            std::shared_ptr<identifier_expression> const & rval_id = std::static_pointer_cast<identifier_expression>(rval);
+            if(top_level || rval_id -> get_expression_type() == CONSTRUCTOR_EXPR) {
+                node.m_kind = pattern_node_kind::CONSTRUCTOR;
+                node.m_name = rval_id -> get_name();
+            }
+            else {
+                node.m_kind = pattern_node_kind::CAPTURE;
+                node.m_variable = l_scope -> get_variable(rval_id -> get_namespace(), rval_id -> get_name());
+            }
+            nodes.push_back(node);
+        }
+        // a constructor call is followed by the patterns of its arguments
+        else if(rval -> is_call_expression()) {
+            std::shared_ptr<call_expression> const & rval_call = std::static_pointer_cast<call_expression>(rval);
+            std::vector<std::pair<token, std::shared_ptr<expr> > >& rval_args = rval_call -> get_arguments();
+            node.m_kind = pattern_node_kind::CONSTRUCTOR;
+            node.m_name = rval_call -> get_name();
+            node.m_arity = rval_args.size();
+            node.m_is_call = true;
+            nodes.push_back(node);
+
+            for(auto& rval_arg : rval_args)
+                compile_pattern_node(rval_arg.second, l_scope, nodes, false);
+        }
+        // a namespaced constructor, the lval of the binary expression is just the namespace
+        // the checker made sure its rval is an identifier or a call
+        else if(rval -> is_binary_expression()) {
+            std::shared_ptr<binary_expression> const & rval_bin = std::static_pointer_cast<binary_expression>(rval);
+            node.m_kind = pattern_node_kind::NAMESPACED;
+            nodes.push_back(node);
+            compile_pattern_node(rval_bin -> get_rval(), l_scope, nodes, true);
+        }
+        // underscores and anything else match everything
+        else {
+            nodes.push_back(node);
+        }
+    }
+
+    /**
+     * get_pattern
+     * returns the right operand as compiled by the checker, a null pointer if it was not compiled
+     */
+    std::shared_ptr<match_pattern>& match_expression::get_pattern() {
+        return m_pattern;
+    }
 }
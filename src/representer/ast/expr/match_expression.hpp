@@ -26,6 +26,7 @@
 #define AVALON_AST_EXPR_MATCH_EXPRESSION_HPP_
 
 #include <memory>
+#include <vector>
 
 #include "representer/ast/expr/expr.hpp"
 #include "representer/ast/decl/type.hpp"
@@ -33,6 +34,10 @@
 
 
 namespace avalon {
+    class scope;
+    struct match_pattern;
+    struct pattern_node;
+
     enum match_expression_type {
         MATCH_EXPR,
         NOT_MATCH_EXPR,
@@ -88,6 +93,19 @@ namespace avalon {
          */
         std::shared_ptr<expr>& get_rval();
 
+        /**
+         * compile_pattern
+         * turns the right operand into the list of tests to perform on the left operand.
+         * the checker calls this once the right operand is checked, capture variables are looked up in the given scope.
+         */
+        void compile_pattern(std::shared_ptr<scope>& l_scope);
+
+        /**
+         * get_pattern
+         * returns the right operand as compiled by the checker, a null pointer if it was not compiled
+         */
+        std::shared_ptr<match_pattern>& get_pattern();
+
         /**
          * token
          * returns this expression token
@@ -123,6 +141,12 @@ namespace avalon {
         }
 
     private:
+        /**
+         * compile_pattern_node
+         * appends the tests to perform for the given part of the right operand
+         */
+        void compile_pattern_node(std::shared_ptr<expr>& rval, std::shared_ptr<scope>& l_scope, std::vector<pattern_node>& nodes, bool top_level);
+
         /*
          * the equal sign token to be used to show errors
          */
@@ -147,6 +171,11 @@ namespace avalon {
          * the right operand to the match operator
          */
         std::shared_ptr<expr> m_rval;
+
+        /*
+         * the compiled right operand, copies are checked and compiled on their own
+         */
+        std::shared_ptr<match_pattern> m_pattern;
     };
 }
 
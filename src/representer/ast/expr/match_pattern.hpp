@@ -0,0 +1,90 @@
+/*
+ *  This file is part of the Avalon programming language
+ * 
+ *  Copyright (c) 2018 Ntwali Bashige Toussaint
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#ifndef AVALON_AST_EXPR_MATCH_PATTERN_HPP_
+#define AVALON_AST_EXPR_MATCH_PATTERN_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <string>
+
+/* AST */
+#include "representer/ast/expr/literal_expression.hpp"
+#include "representer/ast/decl/variable.hpp"
+
+/* Utilities */
+#include "utils/shared_string.hpp"
+
+
+namespace avalon {
+    /**
+     * pattern_node_kind
+     * the test a pattern node performs on the value at its position
+     */
+    enum class pattern_node_kind {
+        ANY,            // an underscore, always matches
+        NONE,           // something no value can match
+        LITERAL,        // the value must be a literal equal to the one in the pattern
+        CONSTRUCTOR,    // the value must be built by the constructor with the same name, the argument patterns follow
+        CAPTURE,        // always matches and stores the value in a variable
+        NAMESPACED      // the value must be a namespaced constructor, the constructor pattern follows
+    };
+
+    /**
+     * pattern_node
+     * a single test of a compiled pattern
+     */
+    struct pattern_node {
+        pattern_node_kind m_kind;
+
+        // literals
+        literal_expression_type m_literal_type;
+        long long int m_int;
+        double m_float;
+        shared_string m_string;
+
+        // constructors
+        std::string m_name;
+        std::size_t m_arity;
+        bool m_is_call;
+
+        // captures
+        std::shared_ptr<variable> m_variable;
+    };
+
+    /**
+     * match_pattern
+     * the right hand side of a match expression compiled into the list of tests it performs, in the order the interpreter walks the value.
+     * a constructor node is followed by the nodes of its arguments so matching is a single pass over the list that stops at the first failed test.
+     */
+    struct match_pattern {
+        /*
+         * the tests to perform
+         */
+        std::vector<pattern_node> m_nodes;
+    };
+}
+
+#endif
@@ -0,0 +1,124 @@
+/*
+ *  This file is part of the Avalon programming language
+ * 
+ *  Copyright (c) 2018 Ntwali Bashige Toussaint
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "representer/ast/stmt/block_stmt.hpp"
+#include "representer/ast/stmt/for_stmt.hpp"
+#include "representer/symtable/scope.hpp"
+#include "representer/ast/decl/variable.hpp"
+#include "representer/ast/expr/expr.hpp"
+#include "lexer/token.hpp"
+
+
+namespace avalon {
+    /**
+     * the constructor expects the token with source code information
+     */
+    for_stmt::for_stmt(token& tok) : m_tok(tok), m_iterable(nullptr) {
+    }
+
+    /**
+     * copy constructor
+     */
+    for_stmt::for_stmt(const std::shared_ptr<for_stmt>& fr_stmt, std::shared_ptr<scope>& parent_scope) : m_tok(fr_stmt -> get_token()), m_scope(std::make_shared<scope>(*(fr_stmt -> get_scope()))), m_iterable(fr_stmt -> get_iterable() -> copy()), m_blc(fr_stmt -> get_block(), m_scope) {
+        m_scope -> set_parent(parent_scope);
+        for(auto& var_decl : fr_stmt -> get_variables())
+            m_variables.push_back(std::make_shared<variable>(var_decl));
+    }
+
+    /**
+     * get_token
+     * returns a token with type source information
+     */
+    const token& for_stmt::get_token() const {
+        return m_tok;
+    }
+
+    /**
+     * set_scope
+     * specify the scope bound to this for statement
+     */
+    void for_stmt::set_scope(std::shared_ptr<scope>& l_scope) {
+        m_scope = l_scope;
+    }
+
+    /**
+     * get_scope
+     * return the scope bound to this for statement
+     */
+    std::shared_ptr<scope>& for_stmt::get_scope() {
+        return m_scope;
+    }
+
+    /**
+     * add_variable
+     * adds a loop variable, the first one receives the current element (or key for maps) and the second one the value for maps
+     */
+    void for_stmt::add_variable(std::shared_ptr<variable>& var_decl) {
+        m_variables.push_back(var_decl);
+    }
+
+    /**
+     * get_variables
+     * returns the loop variables
+     */
+    std::vector<std::shared_ptr<variable> >& for_stmt::get_variables() {
+        return m_variables;
+    }
+
+    /**
+     * set_iterable
+     * sets the expression whose elements the loop will iterate over
+     */
+    void for_stmt::set_iterable(std::shared_ptr<expr>& iterable) {
+        m_iterable = iterable;
+    }
+
+    /**
+     * get_iterable
+     * returns the expression whose elements the loop will iterate over
+     */
+    std::shared_ptr<expr>& for_stmt::get_iterable() {
+        return m_iterable;
+    }
+
+    /**
+     * set_block
+     * set the block of statements to execute
+     */
+    void for_stmt::set_block(block_stmt& blc) {
+        m_blc = blc;
+    }
+
+    /**
+     * get_block
+     * returns the block of statements that are to be executed for this loop
+     */
+    block_stmt& for_stmt::get_block() {
+        return m_blc;
+    }
+}
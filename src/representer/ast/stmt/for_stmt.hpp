@@ -0,0 +1,150 @@
+/*
+ *  This file is part of the Avalon programming language
+ * 
+ *  Copyright (c) 2018 Ntwali Bashige Toussaint
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#ifndef AVALON_AST_STMT_FOR_STMT_HPP_
+#define AVALON_AST_STMT_FOR_STMT_HPP_
+
+#include <memory>
+#include <vector>
+
+#include "representer/ast/stmt/block_stmt.hpp"
+#include "representer/symtable/scope.hpp"
+#include "representer/ast/decl/variable.hpp"
+#include "representer/ast/stmt/stmt.hpp"
+#include "representer/ast/expr/expr.hpp"
+#include "lexer/token.hpp"
+
+
+namespace avalon {
+    class for_stmt : public stmt {
+    public:
+        /**
+         * the constructor expects the token with source code information
+         */
+        for_stmt(token& tok);
+
+        /**
+         * copy constructor
+         */
+        for_stmt(const std::shared_ptr<for_stmt>& fr_stmt, std::shared_ptr<scope>& parent_scope);
+
+        /**
+         * get_token
+         * returns a token with type source information
+         */
+        const token& get_token() const;
+
+        /**
+         * set_scope
+         * specify the scope bound to this for statement
+         */
+        void set_scope(std::shared_ptr<scope>& l_scope);
+
+        /**
+         * get_scope
+         * return the scope bound to this for statement
+         */
+        std::shared_ptr<scope>& get_scope();
+
+        /**
+         * add_variable
+         * adds a loop variable, the first one receives the current element (or key for maps) and the second one the value for maps
+         */
+        void add_variable(std::shared_ptr<variable>& var_decl);
+
+        /**
+         * get_variables
+         * returns the loop variables
+         */
+        std::vector<std::shared_ptr<variable> >& get_variables();
+
+        /**
+         * set_iterable
+         * sets the expression whose elements the loop will iterate over
+         */
+        void set_iterable(std::shared_ptr<expr>& iterable);
+
+        /**
+         * get_iterable
+         * returns the expression whose elements the loop will iterate over
+         */
+        std::shared_ptr<expr>& get_iterable();
+
+        /**
+         * set_block
+         * set the block of statements to execute
+         */
+        void set_block(block_stmt& blc);
+
+        /**
+         * get_block
+         * returns the block of statements that are to be executed for this loop
+         */
+        block_stmt& get_block();
+
+        /**
+         * token
+         * returns this statement token
+         */
+        virtual const token& stmt_token() const {
+            return m_tok;
+        }
+
+        /**
+         * is_for
+         * returns true as this is a for statement
+         */
+        virtual bool is_for() {
+            return true;
+        }
+
+    private:
+        /*
+         * token with source code information
+         */
+        token m_tok;
+
+        /*
+         * scope introduced by this loop, it holds the loop variables
+         */
+        std::shared_ptr<scope> m_scope;
+
+        /*
+         * the variables bound to each element on every iteration
+         */
+        std::vector<std::shared_ptr<variable> > m_variables;
+
+        /*
+         * the list, map, string or integer range to iterate over
+         */
+        std::shared_ptr<expr> m_iterable;
+
+        /*
+         * the body of the loop
+         */
+        block_stmt m_blc;
+    };
+}
+
+#endif
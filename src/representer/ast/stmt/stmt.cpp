@@ -31,6 +31,7 @@
 #include "representer/ast/stmt/return_stmt.hpp"
 #include "representer/ast/stmt/block_stmt.hpp"
 #include "representer/ast/stmt/while_stmt.hpp"
+#include "representer/ast/stmt/for_stmt.hpp"
 #include "representer/ast/stmt/break_stmt.hpp"
 #include "representer/ast/stmt/pass_stmt.hpp"
 #include "representer/ast/stmt/if_stmt.hpp"
@@ -40,7 +41,22 @@
 #include "representer/symtable/scope.hpp"
 
 
+/* Utils */
+#include "utils/stats.hpp"
+
+
 namespace avalon {
+    /**
+     * the constructors only record the creation of the node for statistics
+     */
+    stmt::stmt() {
+        stats::count_node();
+    }
+
+    stmt::stmt(const stmt& a_stmt) : std::enable_shared_from_this<stmt>() {
+        stats::count_node();
+    }
+
     /**
      * copy
      * copies a declaration and returns the copied one
@@ -55,6 +71,12 @@ namespace avalon {
             std::shared_ptr<stmt> new_statement = l_wh_stmt;
             return new_statement;
         }
+        else if(this -> is_for()) {
+            std::shared_ptr<for_stmt> const & fr_stmt = std::static_pointer_cast<for_stmt>(shared_from_this());
+            std::shared_ptr<for_stmt> l_fr_stmt = std::make_shared<for_stmt>(fr_stmt, parent_scope);
+            std::shared_ptr<stmt> new_statement = l_fr_stmt;
+            return new_statement;
+        }
         else if(this -> is_if()) {
             std::shared_ptr<if_stmt> const & f_stmt = std::static_pointer_cast<if_stmt>(shared_from_this());
             std::shared_ptr<if_stmt> l_f_stmt = std::make_shared<if_stmt>(f_stmt, parent_scope);
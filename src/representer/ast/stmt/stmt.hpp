@@ -32,6 +32,12 @@
 namespace avalon {
     class stmt : public std::enable_shared_from_this<stmt> {
     public:
+        /**
+         * the constructors only record the creation of the node for statistics
+         */
+        stmt();
+        stmt(const stmt& a_stmt);
+
         /**
          * copy
          * copies a statement and returns the copied one
@@ -47,6 +53,9 @@ namespace avalon {
         virtual bool is_while() {
             return false;
         }
+        virtual bool is_for() {
+            return false;
+        }
         virtual bool is_if() {
             return false;
         }
@@ -43,6 +43,8 @@
 
 /* Builtin types */
 #include "representer/builtins/lang/avalon_string.hpp"
+#include "representer/builtins/lang/avalon_list.hpp"
+#include "representer/builtins/lang/avalon_void.hpp"
 #include "representer/builtins/lang/avalon_int.hpp"
 
 /* Builtin OS interface programs */
@@ -71,6 +73,15 @@ namespace avalon {
         program& string_prog = avl_string.get_program();
         type_instance string_instance = avl_string.get_type_instance();
 
+        // list of strings type
+        avalon_list avl_list(string_instance);
+        type_instance list_instance = avl_list.get_type_instance();
+
+        // void type
+        avalon_void avl_void;
+        program& void_prog = avl_void.get_program();
+        type_instance void_instance = avl_void.get_type_instance();
+
         /* the program FQN */
         fqn l_fqn("__bifqn_io__", "__bifqn_io__");
         m_io_prog.set_fqn(l_fqn);
@@ -82,7 +93,7 @@ namespace avalon {
         l_scope -> set_end_line(0);
         m_io_prog.set_scope(l_scope);
 
-        /* import int and string programs into io */
+        /* import int, string and void programs into io */
         token import_tok(IDENTIFIER, "import", 0, 0, "__bid__");
         // import int program
         std::shared_ptr<import> int_import = std::make_shared<import>(import_tok, int_prog.get_fqn().get_name());
@@ -92,6 +103,10 @@ namespace avalon {
         std::shared_ptr<import> string_import = std::make_shared<import>(import_tok, string_prog.get_fqn().get_name());
         std::shared_ptr<decl> final_string_import = string_import;
         m_io_prog.add_declaration(final_string_import);
+        // import void program
+        std::shared_ptr<import> void_import = std::make_shared<import>(import_tok, void_prog.get_fqn().get_name());
+        std::shared_ptr<decl> final_void_import = void_import;
+        m_io_prog.add_declaration(final_void_import);
 
         /* create the namespace for the program */
         std::shared_ptr<ns> l_namespace = std::make_shared<ns>(star_tok);
@@ -101,6 +116,12 @@ namespace avalon {
         // variables
         variable param_one(var_one_tok, false);
         param_one.set_type_instance(string_instance);
+        variable handle_param(var_one_tok, false);
+        handle_param.set_type_instance(int_instance);
+        variable offset_param(var_two_tok, false);
+        offset_param.set_type_instance(int_instance);
+        variable count_param(var_three_tok, false);
+        count_param.set_type_instance(int_instance);
 
         // print
         token print_tok(IDENTIFIER, "__print__", 0, 0, "__bif__");
@@ -146,6 +167,136 @@ namespace avalon {
         std::shared_ptr<decl> readln_function_decl = readln_function;
         l_namespace -> add_declaration(readln_function_decl);
 
+        // fopen
+        // maps a file in memory and returns its handle
+        token fopen_tok(IDENTIFIER, "__fopen__", 0, 0, "__bif__");
+        std::shared_ptr<function> fopen_function = std::make_shared<function>(fopen_tok);
+        fopen_function -> set_fqn(l_fqn);
+        fopen_function -> is_public(true);
+        fopen_function -> is_builtin(true);
+        fopen_function -> set_namespace(l_namespace -> get_name());
+        std::shared_ptr<scope> fopen_scope = std::make_shared<scope>();
+        fopen_scope -> set_parent(l_scope);
+        fopen_function -> set_scope(fopen_scope);
+        fopen_function -> add_param(param_one);
+        fopen_function -> set_return_type_instance(int_instance);
+        std::shared_ptr<decl> fopen_function_decl = fopen_function;
+        l_namespace -> add_declaration(fopen_function_decl);
+
+        // fsize
+        // returns the size of an open file
+        token fsize_tok(IDENTIFIER, "__fsize__", 0, 0, "__bif__");
+        std::shared_ptr<function> fsize_function = std::make_shared<function>(fsize_tok);
+        fsize_function -> set_fqn(l_fqn);
+        fsize_function -> is_public(true);
+        fsize_function -> is_builtin(true);
+        fsize_function -> set_namespace(l_namespace -> get_name());
+        std::shared_ptr<scope> fsize_scope = std::make_shared<scope>();
+        fsize_scope -> set_parent(l_scope);
+        fsize_function -> set_scope(fsize_scope);
+        fsize_function -> add_param(handle_param);
+        fsize_function -> set_return_type_instance(int_instance);
+        std::shared_ptr<decl> fsize_function_decl = fsize_function;
+        l_namespace -> add_declaration(fsize_function_decl);
+
+        // fread
+        // returns a view over a range of an open file
+        token fread_tok(IDENTIFIER, "__fread__", 0, 0, "__bif__");
+        std::shared_ptr<function> fread_function = std::make_shared<function>(fread_tok);
+        fread_function -> set_fqn(l_fqn);
+        fread_function -> is_public(true);
+        fread_function -> is_builtin(true);
+        fread_function -> set_namespace(l_namespace -> get_name());
+        std::shared_ptr<scope> fread_scope = std::make_shared<scope>();
+        fread_scope -> set_parent(l_scope);
+        fread_function -> set_scope(fread_scope);
+        fread_function -> add_param(handle_param);
+        fread_function -> add_param(offset_param);
+        fread_function -> add_param(count_param);
+        fread_function -> set_return_type_instance(string_instance);
+        std::shared_ptr<decl> fread_function_decl = fread_function;
+        l_namespace -> add_declaration(fread_function_decl);
+
+        // ftell
+        // returns the position of the next line to read from an open file
+        token ftell_tok(IDENTIFIER, "__ftell__", 0, 0, "__bif__");
+        std::shared_ptr<function> ftell_function = std::make_shared<function>(ftell_tok);
+        ftell_function -> set_fqn(l_fqn);
+        ftell_function -> is_public(true);
+        ftell_function -> is_builtin(true);
+        ftell_function -> set_namespace(l_namespace -> get_name());
+        std::shared_ptr<scope> ftell_scope = std::make_shared<scope>();
+        ftell_scope -> set_parent(l_scope);
+        ftell_function -> set_scope(ftell_scope);
+        ftell_function -> add_param(handle_param);
+        ftell_function -> set_return_type_instance(int_instance);
+        std::shared_ptr<decl> ftell_function_decl = ftell_function;
+        l_namespace -> add_declaration(ftell_function_decl);
+
+        // freadln
+        // returns a view over the next line of an open file
+        token freadln_tok(IDENTIFIER, "__freadln__", 0, 0, "__bif__");
+        std::shared_ptr<function> freadln_function = std::make_shared<function>(freadln_tok);
+        freadln_function -> set_fqn(l_fqn);
+        freadln_function -> is_public(true);
+        freadln_function -> is_builtin(true);
+        freadln_function -> set_namespace(l_namespace -> get_name());
+        std::shared_ptr<scope> freadln_scope = std::make_shared<scope>();
+        freadln_scope -> set_parent(l_scope);
+        freadln_function -> set_scope(freadln_scope);
+        freadln_function -> add_param(handle_param);
+        freadln_function -> set_return_type_instance(string_instance);
+        std::shared_ptr<decl> freadln_function_decl = freadln_function;
+        l_namespace -> add_declaration(freadln_function_decl);
+
+        // flines
+        // returns views over the lines of an open file
+        token flines_tok(IDENTIFIER, "__flines__", 0, 0, "__bif__");
+        std::shared_ptr<function> flines_function = std::make_shared<function>(flines_tok);
+        flines_function -> set_fqn(l_fqn);
+        flines_function -> is_public(true);
+        flines_function -> is_builtin(true);
+        flines_function -> set_namespace(l_namespace -> get_name());
+        std::shared_ptr<scope> flines_scope = std::make_shared<scope>();
+        flines_scope -> set_parent(l_scope);
+        flines_function -> set_scope(flines_scope);
+        flines_function -> add_param(handle_param);
+        flines_function -> set_return_type_instance(list_instance);
+        std::shared_ptr<decl> flines_function_decl = flines_function;
+        l_namespace -> add_declaration(flines_function_decl);
+
+        // fclose
+        // closes an open file
+        token fclose_tok(IDENTIFIER, "__fclose__", 0, 0, "__bif__");
+        std::shared_ptr<function> fclose_function = std::make_shared<function>(fclose_tok);
+        fclose_function -> set_fqn(l_fqn);
+        fclose_function -> is_public(true);
+        fclose_function -> is_builtin(true);
+        fclose_function -> set_namespace(l_namespace -> get_name());
+        std::shared_ptr<scope> fclose_scope = std::make_shared<scope>();
+        fclose_scope -> set_parent(l_scope);
+        fclose_function -> set_scope(fclose_scope);
+        fclose_function -> add_param(handle_param);
+        fclose_function -> set_return_type_instance(void_instance);
+        std::shared_ptr<decl> fclose_function_decl = fclose_function;
+        l_namespace -> add_declaration(fclose_function_decl);
+
+        // fresolve
+        // resolves a path against the directory of the program being run
+        token fresolve_tok(IDENTIFIER, "__fresolve__", 0, 0, "__bif__");
+        std::shared_ptr<function> fresolve_function = std::make_shared<function>(fresolve_tok);
+        fresolve_function -> set_fqn(l_fqn);
+        fresolve_function -> is_public(true);
+        fresolve_function -> is_builtin(true);
+        fresolve_function -> set_namespace(l_namespace -> get_name());
+        std::shared_ptr<scope> fresolve_scope = std::make_shared<scope>();
+        fresolve_scope -> set_parent(l_scope);
+        fresolve_function -> set_scope(fresolve_scope);
+        fresolve_function -> add_param(param_one);
+        fresolve_function -> set_return_type_instance(string_instance);
+        std::shared_ptr<decl> fresolve_function_decl = fresolve_function;
+        l_namespace -> add_declaration(fresolve_function_decl);
+
         /* add the namespace to the program */
         std::shared_ptr<decl> namespace_decl = l_namespace;
         m_io_prog.add_declaration(namespace_decl);
@@ -54,6 +54,7 @@ namespace avalon {
      * the default constructor expects nothing
      */
     avalon_bit2::avalon_bit2() : m_bit2_type(std::make_shared<type>(bit2_type_tok, VALID)), m_bit2_instance(bit2_type_tok, m_bit2_type, "*") {
+        m_bit2_instance.intern();
     }
 
     /**
@@ -277,6 +278,21 @@ namespace avalon {
         std::shared_ptr<decl> ne_function_decl = bit_ne_function;
         l_namespace -> add_declaration(ne_function_decl);
 
+        // number of bits set
+        token bit_popcount_tok(IDENTIFIER, "popcount", 0, 0, "__bif__");
+        std::shared_ptr<function> bit_popcount_function = std::make_shared<function>(bit_popcount_tok);
+        bit_popcount_function -> set_fqn(l_fqn);
+        bit_popcount_function -> is_public(true);
+        bit_popcount_function -> is_builtin(true);
+        bit_popcount_function -> set_namespace(l_namespace -> get_name());
+        std::shared_ptr<scope> bit_popcount_scope = std::make_shared<scope>();
+        bit_popcount_scope -> set_parent(l_scope);
+        bit_popcount_function -> set_scope(bit_popcount_scope);
+        bit_popcount_function -> add_param(param_one);
+        bit_popcount_function -> set_return_type_instance(int_instance);
+        std::shared_ptr<decl> popcount_function_decl = bit_popcount_function;
+        l_namespace -> add_declaration(popcount_function_decl);
+
         // bit2 subscript access by reference
         token refitem_function_tok(IDENTIFIER, "__refitem__", 0, 0, "__bif__");
         std::shared_ptr<function> bit2_refitem_function = std::make_shared<function>(refitem_function_tok);
@@ -54,6 +54,8 @@ namespace avalon {
         default_constructor false_cons(false_cons_tok, m_bool_type);
         m_bool_type -> add_constructor(true_cons);
         m_bool_type -> add_constructor(false_cons);
+
+        m_bool_instance.intern();
     }
 
     /**
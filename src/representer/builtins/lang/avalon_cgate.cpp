@@ -62,6 +62,8 @@ namespace avalon {
         // set the category of the type instance
         m_cgate_instance.set_category(USER);
         m_cgate_instance.is_parametrized(false);
+
+        m_cgate_instance.intern();
     }
 
     /**
@@ -50,6 +50,7 @@ namespace avalon {
      * the default constructor expects nothing
      */
     avalon_float::avalon_float() : m_float_type(std::make_shared<type>(float_type_tok, VALID)), m_float_instance(float_type_tok, m_float_type, "*") {
+        m_float_instance.intern();
     }
 
     /**
@@ -22,7 +22,12 @@
  *  SOFTWARE.
  */
 
+#include <complex>
 #include <memory>
+#include <vector>
+#include <cmath>
+
+#include <Eigen/Dense>
 
 /* Lexer */
 #include "lexer/token.hpp"
@@ -35,6 +40,9 @@
 #include "representer/ast/decl/decl.hpp"
 #include "representer/ast/decl/ns.hpp"
 #include "representer/ast/program.hpp"
+#include "representer/ast/expr/literal_expression.hpp"
+#include "representer/ast/expr/call_expression.hpp"
+#include "representer/ast/expr/expr.hpp"
 
 /* Symbol table */
 #include "representer/symtable/scope.hpp"
@@ -46,6 +54,34 @@
 
 
 namespace avalon {
+    static std::complex<double> get_00(double theta, double phi, double lambda) {
+        std::complex<double> i(0, 1);
+        std::complex<double> e = std::exp(i * ((-phi - lambda)/2));
+        double c = cos(theta / 2);
+        return e * c;
+    }
+
+    static std::complex<double> get_10(double theta, double phi, double lambda) {
+        std::complex<double> i(0, 1);
+        std::complex<double> e = std::exp(i * ((phi - lambda)/2));
+        double s = sin(theta / 2);
+        return e * s;
+    }
+
+    static std::complex<double> get_01(double theta, double phi, double lambda) {
+        std::complex<double> i(0, 1);
+        std::complex<double> e = -std::exp(i * ((-phi + lambda)/2));
+        double s = sin(theta / 2);
+        return e * s;
+    }
+
+    static std::complex<double> get_11(double theta, double phi, double lambda) {
+        std::complex<double> i(0, 1);
+        std::complex<double> e = std::exp(i * ((phi + lambda)/2));
+        double c = cos(theta / 2);
+        return e * c;
+    }
+
     /**
      * the default constructor expects the dependent type instance parameter
      */
@@ -64,6 +100,8 @@ namespace avalon {
         // set the category of the type instance
         m_gate_instance.set_category(USER);
         m_gate_instance.is_parametrized(false);
+
+        m_gate_instance.intern();
     }
 
     /**
@@ -125,4 +163,47 @@ namespace avalon {
 
         return m_gate_prog;
     }
+
+    /**
+     * is_constant
+     * returns true if the parameters of the given gate constructor are all float literals
+     */
+    bool avalon_gate::is_constant(std::shared_ptr<call_expression> const & gate_expr) {
+        std::vector<std::pair<token, std::shared_ptr<expr> > >& gate_args = gate_expr -> get_arguments();
+        for(auto& gate_arg : gate_args) {
+            if(gate_arg.second -> is_literal_expression() == false)
+                return false;
+
+            std::shared_ptr<literal_expression> const & arg_lit = std::static_pointer_cast<literal_expression>(gate_arg.second);
+            if(arg_lit -> get_expression_type() != FLOATING_POINT_EXPR)
+                return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * get_unitary
+     * returns the unitary matrix of the given gate constructor.
+     * the matrix is computed from the gate parameters the first time then cached on the constructor expression.
+     */
+    const Eigen::Matrix2cd& avalon_gate::get_unitary(std::shared_ptr<call_expression> const & gate_expr) {
+        if(gate_expr -> has_unitary())
+            return gate_expr -> get_unitary();
+
+        // the gate parameters are float literals by the time the gate is applied
+        std::vector<std::pair<token, std::shared_ptr<expr> > >& gate_args = gate_expr -> get_arguments();
+        double theta = std::static_pointer_cast<literal_expression>(gate_args[0].second) -> get_float_value();
+        double phi = std::static_pointer_cast<literal_expression>(gate_args[1].second) -> get_float_value();
+        double lambda = std::static_pointer_cast<literal_expression>(gate_args[2].second) -> get_float_value();
+
+        Eigen::Matrix2cd unitary;
+        unitary(0, 0) = get_00(theta, phi, lambda);
+        unitary(1, 0) = get_10(theta, phi, lambda);
+        unitary(0, 1) = get_01(theta, phi, lambda);
+        unitary(1, 1) = get_11(theta, phi, lambda);
+        gate_expr -> set_unitary(unitary);
+
+        return gate_expr -> get_unitary();
+    }
 }
@@ -27,10 +27,13 @@
 
 #include <memory>
 
+#include <Eigen/Dense>
+
 /* Lexer */
 #include "lexer/token.hpp"
 
 /* AST */
+#include "representer/ast/expr/call_expression.hpp"
 #include "representer/ast/decl/type.hpp"
 #include "representer/ast/program.hpp"
 
@@ -61,6 +64,19 @@ namespace avalon {
          */
         program& get_program();
 
+        /**
+         * is_constant
+         * returns true if the parameters of the given gate constructor are all float literals
+         */
+        static bool is_constant(std::shared_ptr<call_expression> const & gate_expr);
+
+        /**
+         * get_unitary
+         * returns the unitary matrix of the given gate constructor.
+         * the matrix is computed from the gate parameters the first time then cached on the constructor expression.
+         */
+        static const Eigen::Matrix2cd& get_unitary(std::shared_ptr<call_expression> const & gate_expr);
+
     private:
         /*
          * the gate type
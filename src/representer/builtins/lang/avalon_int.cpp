@@ -53,6 +53,7 @@ namespace avalon {
      * the default constructor expects nothing
      */
     avalon_int::avalon_int() : m_int_type(std::make_shared<type>(int_type_tok, VALID)), m_int_instance(int_type_tok, m_int_type, "*") {
+        m_int_instance.intern();
     }
 
     /**
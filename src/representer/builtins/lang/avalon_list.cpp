@@ -30,6 +30,7 @@
 /* AST */
 #include "representer/ast/decl/function.hpp"
 #include "representer/ast/decl/variable.hpp"
+#include "representer/ast/decl/import.hpp"
 #include "representer/ast/decl/type.hpp"
 #include "representer/ast/decl/decl.hpp"
 #include "representer/ast/decl/ns.hpp"
@@ -40,7 +41,12 @@
 #include "representer/symtable/fqn.hpp"
 
 /* Builtins */
+#include "representer/builtins/lang/avalon_maybe.hpp"
 #include "representer/builtins/lang/avalon_list.hpp"
+#include "representer/builtins/lang/avalon_bool.hpp"
+#include "representer/builtins/lang/avalon_void.hpp"
+#include "representer/builtins/lang/avalon_int.hpp"
+#include "representer/builtins/lang/avalon_ref.hpp"
 
 
 namespace avalon {
@@ -79,6 +85,33 @@ namespace avalon {
      * returns a program that defines the list type and all functions that operate on lists
      */
     program& avalon_list::get_program() {
+        // element type, the list functions are generic over it
+        type_instance param_instance = m_list_instance.get_params()[0];
+
+        // bool type
+        avalon_bool avl_bool;
+        program& bool_prog = avl_bool.get_program();
+        type_instance bool_instance = avl_bool.get_type_instance();
+
+        // int type
+        avalon_int avl_int;
+        program& int_prog = avl_int.get_program();
+        type_instance int_instance = avl_int.get_type_instance();
+
+        // void type
+        avalon_void avl_void;
+        program& void_prog = avl_void.get_program();
+        type_instance void_instance = avl_void.get_type_instance();
+
+        // maybe type
+        avalon_maybe avl_maybe;
+        program& maybe_prog = avl_maybe.get_program();
+        type_instance maybe_param_instance = avl_maybe.get_type_instance(param_instance);
+
+        // reference to list type
+        avalon_ref avl_ref;
+        type_instance ref_list_instance = avl_ref.get_type_instance(m_list_instance);
+
         /* the program FQN */
         fqn l_fqn("__bifqn_list__", "__bifqn_list__");
         m_list_prog.set_fqn(l_fqn);
@@ -90,6 +123,25 @@ namespace avalon {
         l_scope -> set_end_line(0);
         m_list_prog.set_scope(l_scope);
 
+        /* import bool, int, void and maybe programs into list */
+        token import_tok(IDENTIFIER, "import", 0, 0, "__bid__");
+        // import bool program
+        std::shared_ptr<import> bool_import = std::make_shared<import>(import_tok, bool_prog.get_fqn().get_name());
+        std::shared_ptr<decl> final_bool_import = bool_import;
+        m_list_prog.add_declaration(final_bool_import);
+        // import int program
+        std::shared_ptr<import> int_import = std::make_shared<import>(import_tok, int_prog.get_fqn().get_name());
+        std::shared_ptr<decl> final_int_import = int_import;
+        m_list_prog.add_declaration(final_int_import);
+        // import void program
+        std::shared_ptr<import> void_import = std::make_shared<import>(import_tok, void_prog.get_fqn().get_name());
+        std::shared_ptr<decl> final_void_import = void_import;
+        m_list_prog.add_declaration(final_void_import);
+        // import maybe program
+        std::shared_ptr<import> maybe_import = std::make_shared<import>(import_tok, maybe_prog.get_fqn().get_name());
+        std::shared_ptr<decl> final_maybe_import = maybe_import;
+        m_list_prog.add_declaration(final_maybe_import);
+
         /* create the namespace to the program */
         std::shared_ptr<ns> l_namespace = std::make_shared<ns>(star_tok);
         l_namespace -> set_fqn(l_fqn);
@@ -100,7 +152,122 @@ namespace avalon {
         l_namespace -> add_declaration(type_decl);
 
         /* add function declarations to the namespace */
-        // functions to be added later        
+        // variables
+        // the list parameter of mutating functions is a mutable reference so only references to mutable variables can be passed
+        variable ref_list_param(var_one_tok, true);
+        ref_list_param.set_type_instance(ref_list_instance);
+        variable list_param(var_one_tok, false);
+        list_param.set_type_instance(m_list_instance);
+        variable element_param(var_two_tok, false);
+        element_param.set_type_instance(param_instance);
+        variable index_param(var_two_tok, false);
+        index_param.set_type_instance(int_instance);
+        variable value_param(var_three_tok, false);
+        value_param.set_type_instance(param_instance);
+        variable stop_param(var_three_tok, false);
+        stop_param.set_type_instance(int_instance);
+
+        // append an element at the end of the list
+        token list_append_tok(IDENTIFIER, "append", 0, 0, "__bif__");
+        std::shared_ptr<function> list_append_function = std::make_shared<function>(list_append_tok);
+        list_append_function -> set_fqn(l_fqn);
+        list_append_function -> is_public(true);
+        list_append_function -> is_builtin(true);
+        list_append_function -> set_namespace(l_namespace -> get_name());
+        list_append_function -> add_constraint(type_param_a_tok);
+        std::shared_ptr<scope> list_append_scope = std::make_shared<scope>();
+        list_append_scope -> set_parent(l_scope);
+        list_append_function -> set_scope(list_append_scope);
+        list_append_function -> add_param(ref_list_param);
+        list_append_function -> add_param(element_param);
+        list_append_function -> set_return_type_instance(void_instance);
+        std::shared_ptr<decl> list_append_function_decl = list_append_function;
+        l_namespace -> add_declaration(list_append_function_decl);
+
+        // remove the last element of the list and return it
+        token list_pop_tok(IDENTIFIER, "pop", 0, 0, "__bif__");
+        std::shared_ptr<function> list_pop_function = std::make_shared<function>(list_pop_tok);
+        list_pop_function -> set_fqn(l_fqn);
+        list_pop_function -> is_public(true);
+        list_pop_function -> is_builtin(true);
+        list_pop_function -> set_namespace(l_namespace -> get_name());
+        list_pop_function -> add_constraint(type_param_a_tok);
+        std::shared_ptr<scope> list_pop_scope = std::make_shared<scope>();
+        list_pop_scope -> set_parent(l_scope);
+        list_pop_function -> set_scope(list_pop_scope);
+        list_pop_function -> add_param(ref_list_param);
+        list_pop_function -> set_return_type_instance(maybe_param_instance);
+        std::shared_ptr<decl> list_pop_function_decl = list_pop_function;
+        l_namespace -> add_declaration(list_pop_function_decl);
+
+        // replace the element at the given index
+        token list_set_tok(IDENTIFIER, "set", 0, 0, "__bif__");
+        std::shared_ptr<function> list_set_function = std::make_shared<function>(list_set_tok);
+        list_set_function -> set_fqn(l_fqn);
+        list_set_function -> is_public(true);
+        list_set_function -> is_builtin(true);
+        list_set_function -> set_namespace(l_namespace -> get_name());
+        list_set_function -> add_constraint(type_param_a_tok);
+        std::shared_ptr<scope> list_set_scope = std::make_shared<scope>();
+        list_set_scope -> set_parent(l_scope);
+        list_set_function -> set_scope(list_set_scope);
+        list_set_function -> add_param(ref_list_param);
+        list_set_function -> add_param(index_param);
+        list_set_function -> add_param(value_param);
+        list_set_function -> set_return_type_instance(bool_instance);
+        std::shared_ptr<decl> list_set_function_decl = list_set_function;
+        l_namespace -> add_declaration(list_set_function_decl);
+
+        // reserve capacity for the given number of elements
+        token list_reserve_tok(IDENTIFIER, "reserve", 0, 0, "__bif__");
+        std::shared_ptr<function> list_reserve_function = std::make_shared<function>(list_reserve_tok);
+        list_reserve_function -> set_fqn(l_fqn);
+        list_reserve_function -> is_public(true);
+        list_reserve_function -> is_builtin(true);
+        list_reserve_function -> set_namespace(l_namespace -> get_name());
+        list_reserve_function -> add_constraint(type_param_a_tok);
+        std::shared_ptr<scope> list_reserve_scope = std::make_shared<scope>();
+        list_reserve_scope -> set_parent(l_scope);
+        list_reserve_function -> set_scope(list_reserve_scope);
+        list_reserve_function -> add_param(ref_list_param);
+        list_reserve_function -> add_param(index_param);
+        list_reserve_function -> set_return_type_instance(void_instance);
+        std::shared_ptr<decl> list_reserve_function_decl = list_reserve_function;
+        l_namespace -> add_declaration(list_reserve_function_decl);
+
+        // length of the list
+        token list_len_tok(IDENTIFIER, "len", 0, 0, "__bif__");
+        std::shared_ptr<function> list_len_function = std::make_shared<function>(list_len_tok);
+        list_len_function -> set_fqn(l_fqn);
+        list_len_function -> is_public(true);
+        list_len_function -> is_builtin(true);
+        list_len_function -> set_namespace(l_namespace -> get_name());
+        list_len_function -> add_constraint(type_param_a_tok);
+        std::shared_ptr<scope> list_len_scope = std::make_shared<scope>();
+        list_len_scope -> set_parent(l_scope);
+        list_len_function -> set_scope(list_len_scope);
+        list_len_function -> add_param(list_param);
+        list_len_function -> set_return_type_instance(int_instance);
+        std::shared_ptr<decl> list_len_function_decl = list_len_function;
+        l_namespace -> add_declaration(list_len_function_decl);
+
+        // new list made of the elements between the start (inclusive) and stop (exclusive) indices
+        token list_slice_tok(IDENTIFIER, "slice", 0, 0, "__bif__");
+        std::shared_ptr<function> list_slice_function = std::make_shared<function>(list_slice_tok);
+        list_slice_function -> set_fqn(l_fqn);
+        list_slice_function -> is_public(true);
+        list_slice_function -> is_builtin(true);
+        list_slice_function -> set_namespace(l_namespace -> get_name());
+        list_slice_function -> add_constraint(type_param_a_tok);
+        std::shared_ptr<scope> list_slice_scope = std::make_shared<scope>();
+        list_slice_scope -> set_parent(l_scope);
+        list_slice_function -> set_scope(list_slice_scope);
+        list_slice_function -> add_param(list_param);
+        list_slice_function -> add_param(index_param);
+        list_slice_function -> add_param(stop_param);
+        list_slice_function -> set_return_type_instance(m_list_instance);
+        std::shared_ptr<decl> list_slice_function_decl = list_slice_function;
+        l_namespace -> add_declaration(list_slice_function_decl);
 
         /* add the namespace to the program */
         std::shared_ptr<decl> namespace_decl = l_namespace;
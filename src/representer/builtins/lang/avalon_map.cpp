@@ -30,6 +30,7 @@
 /* AST */
 #include "representer/ast/decl/function.hpp"
 #include "representer/ast/decl/variable.hpp"
+#include "representer/ast/decl/import.hpp"
 #include "representer/ast/decl/type.hpp"
 #include "representer/ast/decl/decl.hpp"
 #include "representer/ast/decl/ns.hpp"
@@ -40,7 +41,11 @@
 #include "representer/symtable/fqn.hpp"
 
 /* Builtins */
+#include "representer/builtins/lang/avalon_list.hpp"
+#include "representer/builtins/lang/avalon_bool.hpp"
 #include "representer/builtins/lang/avalon_map.hpp"
+#include "representer/builtins/lang/avalon_int.hpp"
+#include "representer/builtins/lang/avalon_ref.hpp"
 
 
 namespace avalon {
@@ -74,6 +79,30 @@ namespace avalon {
      * returns a program that defines the map type and all functions that operate on maps
      */
     program& avalon_map::get_program() {
+        // key and value types, the map functions are generic over them
+        type_instance key_instance = m_map_instance.get_params()[0];
+        type_instance value_instance = m_map_instance.get_params()[1];
+
+        // bool type
+        avalon_bool avl_bool;
+        program& bool_prog = avl_bool.get_program();
+        type_instance bool_instance = avl_bool.get_type_instance();
+
+        // int type
+        avalon_int avl_int;
+        program& int_prog = avl_int.get_program();
+        type_instance int_instance = avl_int.get_type_instance();
+
+        // list of keys and list of values types
+        avalon_list avl_key_list(key_instance);
+        type_instance key_list_instance = avl_key_list.get_type_instance();
+        avalon_list avl_value_list(value_instance);
+        type_instance value_list_instance = avl_value_list.get_type_instance();
+
+        // reference to map type
+        avalon_ref avl_ref;
+        type_instance ref_map_instance = avl_ref.get_type_instance(m_map_instance);
+
         /* the program FQN */
         fqn l_fqn("__bifqn_map__", "__bifqn_map__");
         m_map_prog.set_fqn(l_fqn);
@@ -85,6 +114,17 @@ namespace avalon {
         l_scope -> set_end_line(0);
         m_map_prog.set_scope(l_scope);
 
+        /* import bool and int programs into map */
+        token import_tok(IDENTIFIER, "import", 0, 0, "__bid__");
+        // import bool program
+        std::shared_ptr<import> bool_import = std::make_shared<import>(import_tok, bool_prog.get_fqn().get_name());
+        std::shared_ptr<decl> final_bool_import = bool_import;
+        m_map_prog.add_declaration(final_bool_import);
+        // import int program
+        std::shared_ptr<import> int_import = std::make_shared<import>(import_tok, int_prog.get_fqn().get_name());
+        std::shared_ptr<decl> final_int_import = int_import;
+        m_map_prog.add_declaration(final_int_import);
+
         /* create the namespace to the program */
         std::shared_ptr<ns> l_namespace = std::make_shared<ns>(star_tok);
         l_namespace -> set_fqn(l_fqn);
@@ -95,7 +135,141 @@ namespace avalon {
         l_namespace -> add_declaration(type_decl);
 
         /* add function declarations to the namespace */
-        // functions to be added later        
+        // variables
+        // the map parameter of mutating functions is a mutable reference so only references to mutable variables can be passed
+        variable ref_map_param(var_one_tok, true);
+        ref_map_param.set_type_instance(ref_map_instance);
+        variable map_param(var_one_tok, false);
+        map_param.set_type_instance(m_map_instance);
+        variable key_param(var_two_tok, false);
+        key_param.set_type_instance(key_instance);
+        variable value_param(var_three_tok, false);
+        value_param.set_type_instance(value_instance);
+
+        // insert a key/value pair, replacing the value if the key is already present
+        token map_insert_tok(IDENTIFIER, "insert", 0, 0, "__bif__");
+        std::shared_ptr<function> map_insert_function = std::make_shared<function>(map_insert_tok);
+        map_insert_function -> set_fqn(l_fqn);
+        map_insert_function -> is_public(true);
+        map_insert_function -> is_builtin(true);
+        map_insert_function -> set_namespace(l_namespace -> get_name());
+        map_insert_function -> add_constraint(type_param_a_tok);
+        map_insert_function -> add_constraint(type_param_b_tok);
+        std::shared_ptr<scope> map_insert_scope = std::make_shared<scope>();
+        map_insert_scope -> set_parent(l_scope);
+        map_insert_function -> set_scope(map_insert_scope);
+        map_insert_function -> add_param(ref_map_param);
+        map_insert_function -> add_param(key_param);
+        map_insert_function -> add_param(value_param);
+        map_insert_function -> set_return_type_instance(bool_instance);
+        std::shared_ptr<decl> map_insert_function_decl = map_insert_function;
+        l_namespace -> add_declaration(map_insert_function_decl);
+
+        // replace the value of a key already present in the map
+        token map_update_tok(IDENTIFIER, "update", 0, 0, "__bif__");
+        std::shared_ptr<function> map_update_function = std::make_shared<function>(map_update_tok);
+        map_update_function -> set_fqn(l_fqn);
+        map_update_function -> is_public(true);
+        map_update_function -> is_builtin(true);
+        map_update_function -> set_namespace(l_namespace -> get_name());
+        map_update_function -> add_constraint(type_param_a_tok);
+        map_update_function -> add_constraint(type_param_b_tok);
+        std::shared_ptr<scope> map_update_scope = std::make_shared<scope>();
+        map_update_scope -> set_parent(l_scope);
+        map_update_function -> set_scope(map_update_scope);
+        map_update_function -> add_param(ref_map_param);
+        map_update_function -> add_param(key_param);
+        map_update_function -> add_param(value_param);
+        map_update_function -> set_return_type_instance(bool_instance);
+        std::shared_ptr<decl> map_update_function_decl = map_update_function;
+        l_namespace -> add_declaration(map_update_function_decl);
+
+        // remove a key and its value from the map
+        token map_remove_tok(IDENTIFIER, "remove", 0, 0, "__bif__");
+        std::shared_ptr<function> map_remove_function = std::make_shared<function>(map_remove_tok);
+        map_remove_function -> set_fqn(l_fqn);
+        map_remove_function -> is_public(true);
+        map_remove_function -> is_builtin(true);
+        map_remove_function -> set_namespace(l_namespace -> get_name());
+        map_remove_function -> add_constraint(type_param_a_tok);
+        map_remove_function -> add_constraint(type_param_b_tok);
+        std::shared_ptr<scope> map_remove_scope = std::make_shared<scope>();
+        map_remove_scope -> set_parent(l_scope);
+        map_remove_function -> set_scope(map_remove_scope);
+        map_remove_function -> add_param(ref_map_param);
+        map_remove_function -> add_param(key_param);
+        map_remove_function -> set_return_type_instance(bool_instance);
+        std::shared_ptr<decl> map_remove_function_decl = map_remove_function;
+        l_namespace -> add_declaration(map_remove_function_decl);
+
+        // whether the key is present in the map
+        token map_contains_tok(IDENTIFIER, "contains", 0, 0, "__bif__");
+        std::shared_ptr<function> map_contains_function = std::make_shared<function>(map_contains_tok);
+        map_contains_function -> set_fqn(l_fqn);
+        map_contains_function -> is_public(true);
+        map_contains_function -> is_builtin(true);
+        map_contains_function -> set_namespace(l_namespace -> get_name());
+        map_contains_function -> add_constraint(type_param_a_tok);
+        map_contains_function -> add_constraint(type_param_b_tok);
+        std::shared_ptr<scope> map_contains_scope = std::make_shared<scope>();
+        map_contains_scope -> set_parent(l_scope);
+        map_contains_function -> set_scope(map_contains_scope);
+        map_contains_function -> add_param(map_param);
+        map_contains_function -> add_param(key_param);
+        map_contains_function -> set_return_type_instance(bool_instance);
+        std::shared_ptr<decl> map_contains_function_decl = map_contains_function;
+        l_namespace -> add_declaration(map_contains_function_decl);
+
+        // number of key/value pairs in the map
+        token map_len_tok(IDENTIFIER, "len", 0, 0, "__bif__");
+        std::shared_ptr<function> map_len_function = std::make_shared<function>(map_len_tok);
+        map_len_function -> set_fqn(l_fqn);
+        map_len_function -> is_public(true);
+        map_len_function -> is_builtin(true);
+        map_len_function -> set_namespace(l_namespace -> get_name());
+        map_len_function -> add_constraint(type_param_a_tok);
+        map_len_function -> add_constraint(type_param_b_tok);
+        std::shared_ptr<scope> map_len_scope = std::make_shared<scope>();
+        map_len_scope -> set_parent(l_scope);
+        map_len_function -> set_scope(map_len_scope);
+        map_len_function -> add_param(map_param);
+        map_len_function -> set_return_type_instance(int_instance);
+        std::shared_ptr<decl> map_len_function_decl = map_len_function;
+        l_namespace -> add_declaration(map_len_function_decl);
+
+        // list of the keys in the map
+        token map_keys_tok(IDENTIFIER, "keys", 0, 0, "__bif__");
+        std::shared_ptr<function> map_keys_function = std::make_shared<function>(map_keys_tok);
+        map_keys_function -> set_fqn(l_fqn);
+        map_keys_function -> is_public(true);
+        map_keys_function -> is_builtin(true);
+        map_keys_function -> set_namespace(l_namespace -> get_name());
+        map_keys_function -> add_constraint(type_param_a_tok);
+        map_keys_function -> add_constraint(type_param_b_tok);
+        std::shared_ptr<scope> map_keys_scope = std::make_shared<scope>();
+        map_keys_scope -> set_parent(l_scope);
+        map_keys_function -> set_scope(map_keys_scope);
+        map_keys_function -> add_param(map_param);
+        map_keys_function -> set_return_type_instance(key_list_instance);
+        std::shared_ptr<decl> map_keys_function_decl = map_keys_function;
+        l_namespace -> add_declaration(map_keys_function_decl);
+
+        // list of the values in the map
+        token map_values_tok(IDENTIFIER, "values", 0, 0, "__bif__");
+        std::shared_ptr<function> map_values_function = std::make_shared<function>(map_values_tok);
+        map_values_function -> set_fqn(l_fqn);
+        map_values_function -> is_public(true);
+        map_values_function -> is_builtin(true);
+        map_values_function -> set_namespace(l_namespace -> get_name());
+        map_values_function -> add_constraint(type_param_a_tok);
+        map_values_function -> add_constraint(type_param_b_tok);
+        std::shared_ptr<scope> map_values_scope = std::make_shared<scope>();
+        map_values_scope -> set_parent(l_scope);
+        map_values_function -> set_scope(map_values_scope);
+        map_values_function -> add_param(map_param);
+        map_values_function -> set_return_type_instance(value_list_instance);
+        std::shared_ptr<decl> map_values_function_decl = map_values_function;
+        l_namespace -> add_declaration(map_values_function_decl);
 
         /* add the namespace to the program */
         std::shared_ptr<decl> namespace_decl = l_namespace;
@@ -41,9 +41,11 @@
 #include "representer/symtable/fqn.hpp"
 
 /* Builtins */
+#include "representer/builtins/lang/avalon_string.hpp"
 #include "representer/builtins/lang/avalon_qubit.hpp"
 #include "representer/builtins/lang/avalon_cgate.hpp"
 #include "representer/builtins/lang/avalon_gate.hpp"
+#include "representer/builtins/lang/avalon_list.hpp"
 #include "representer/builtins/lang/avalon_void.hpp"
 #include "representer/builtins/lang/avalon_bit.hpp"
 
@@ -54,6 +56,8 @@ namespace avalon {
      */
     avalon_qubit::avalon_qubit() : m_qubit_type(std::make_shared<type>(qubit_type_tok, VALID)), m_qubit_instance(qubit_type_tok, m_qubit_type, "*") {
         m_qubit_type -> is_quantum(true);
+
+        m_qubit_instance.intern();
     }
 
     /**
@@ -97,11 +101,20 @@ namespace avalon {
         program& bit_prog = avl_bit.get_program();
         type_instance bit_instance = avl_bit.get_type_instance();
 
+        // string program
+        avalon_string avl_string;
+        program& string_prog = avl_string.get_program();
+        type_instance string_instance = avl_string.get_type_instance();
+
         // reference to qubits
         type_instance ref_qubit_instance(ref_type_instance_tok, "*");
         ref_qubit_instance.add_param(m_qubit_instance);
         ref_qubit_instance.is_reference(true);
 
+        // list of references to qubits
+        avalon_list avl_list(ref_qubit_instance);
+        type_instance list_ref_qubit_instance = avl_list.get_type_instance();
+
         /* the program FQN */
         fqn l_fqn("__bifqn_qubit__", "__bifqn_qubit__");
         m_qubit_prog.set_fqn(l_fqn);
@@ -131,6 +144,10 @@ namespace avalon {
         std::shared_ptr<import> bit_import = std::make_shared<import>(import_tok, bit_prog.get_fqn().get_name());
         std::shared_ptr<decl> final_bit_import = bit_import;
         m_qubit_prog.add_declaration(final_bit_import);
+        // import string program
+        std::shared_ptr<import> string_import = std::make_shared<import>(import_tok, string_prog.get_fqn().get_name());
+        std::shared_ptr<decl> final_string_import = string_import;
+        m_qubit_prog.add_declaration(final_string_import);
 
         /* create the namespace to the program */
         std::shared_ptr<ns> l_namespace = std::make_shared<ns>(star_tok);
@@ -151,6 +168,8 @@ namespace avalon {
         param_three.set_type_instance(ref_qubit_instance);        
         variable param_four(var_four_tok, false);
         param_four.set_type_instance(ref_qubit_instance);
+        variable param_five(var_three_tok, false);
+        param_five.set_type_instance(list_ref_qubit_instance);
 
         // functions
         // apply
@@ -184,6 +203,21 @@ namespace avalon {
         qubit_capply_function -> set_return_type_instance(void_instance);
         std::shared_ptr<decl> capply_function_decl = qubit_capply_function;
         l_namespace -> add_declaration(capply_function_decl);
+        // multi-controlled version
+        std::shared_ptr<function> qubit_mcapply_function = std::make_shared<function>(qubit_apply_tok);
+        qubit_mcapply_function -> set_fqn(l_fqn);
+        qubit_mcapply_function -> is_public(true);
+        qubit_mcapply_function -> is_builtin(true);
+        qubit_mcapply_function -> set_namespace(l_namespace -> get_name());
+        std::shared_ptr<scope> qubit_mcapply_scope = std::make_shared<scope>();
+        qubit_mcapply_scope -> set_parent(l_scope);
+        qubit_mcapply_function -> set_scope(qubit_mcapply_scope);
+        qubit_mcapply_function -> add_param(param_two);
+        qubit_mcapply_function -> add_param(param_five);
+        qubit_mcapply_function -> add_param(param_four);
+        qubit_mcapply_function -> set_return_type_instance(void_instance);
+        std::shared_ptr<decl> mcapply_function_decl = qubit_mcapply_function;
+        l_namespace -> add_declaration(mcapply_function_decl);
 
         // measurement
         // function version
@@ -215,6 +249,21 @@ namespace avalon {
         std::shared_ptr<decl> cast_function_decl = qubit_cast_function;
         l_namespace -> add_declaration(cast_function_decl);
 
+        // telemetry
+        // returns the quantum processor counters as a json string
+        token qstats_tok(IDENTIFIER, "qstats", 0, 0, "__bif__");
+        std::shared_ptr<function> qstats_function = std::make_shared<function>(qstats_tok);
+        qstats_function -> set_fqn(l_fqn);
+        qstats_function -> is_public(true);
+        qstats_function -> is_builtin(true);
+        qstats_function -> set_namespace(l_namespace -> get_name());
+        std::shared_ptr<scope> qstats_scope = std::make_shared<scope>();
+        qstats_scope -> set_parent(l_scope);
+        qstats_function -> set_scope(qstats_scope);
+        qstats_function -> set_return_type_instance(string_instance);
+        std::shared_ptr<decl> qstats_function_decl = qstats_function;
+        l_namespace -> add_declaration(qstats_function_decl);
+
         /* add the namespace to the program */
         std::shared_ptr<decl> namespace_decl = l_namespace;
         m_qubit_prog.add_declaration(namespace_decl);
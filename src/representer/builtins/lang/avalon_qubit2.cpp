@@ -53,6 +53,8 @@ namespace avalon {
      */
     avalon_qubit2::avalon_qubit2() : m_qubit2_type(std::make_shared<type>(qubit2_type_tok, VALID)), m_qubit2_instance(qubit2_type_tok, m_qubit2_type, "*") {
         m_qubit2_type -> is_quantum(true);
+
+        m_qubit2_instance.intern();
     }
 
     /**
@@ -53,6 +53,8 @@ namespace avalon {
      */
     avalon_qubit4::avalon_qubit4() : m_qubit4_type(std::make_shared<type>(qubit4_type_tok, VALID)), m_qubit4_instance(qubit4_type_tok, m_qubit4_type, "*") {
         m_qubit4_type -> is_quantum(true);
+
+        m_qubit4_instance.intern();
     }
 
     /**
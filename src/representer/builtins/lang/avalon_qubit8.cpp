@@ -53,6 +53,8 @@ namespace avalon {
      */
     avalon_qubit8::avalon_qubit8() : m_qubit8_type(std::make_shared<type>(qubit8_type_tok, VALID)), m_qubit8_instance(qubit8_type_tok, m_qubit8_type, "*") {
         m_qubit8_type -> is_quantum(true);
+
+        m_qubit8_instance.intern();
     }
 
     /**
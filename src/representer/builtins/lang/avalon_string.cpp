@@ -53,6 +53,7 @@ namespace avalon {
      * the default constructor expects nothing
      */
     avalon_string::avalon_string() : m_string_type(std::make_shared<type>(string_type_tok, VALID)), m_string_instance(string_type_tok, m_string_type, "*") {
+        m_string_instance.intern();
     }
 
     /**
@@ -48,6 +48,7 @@ namespace avalon {
      * the default constructor expects nothing
      */
     avalon_void::avalon_void() : m_void_type(std::make_shared<type>(void_type_tok, VALID)), m_void_instance(void_type_tok, m_void_type, "*") {
+        m_void_instance.intern();
     }
 
     /**
@@ -0,0 +1,221 @@
+/*
+ *  This file is part of the Avalon programming language
+ * 
+ *  Copyright (c) 2018 Ntwali Bashige Toussaint
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include <stdexcept>
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <vector>
+#include <string>
+
+#include "utils/bit_vector.hpp"
+
+
+namespace avalon {
+/**
+ * the default constructor creates an empty bit vector
+ */
+bit_vector::bit_vector() : m_width(0), m_word(0) {
+}
+
+/**
+ * this constructor creates a bit vector of the given width with all bits cleared
+ */
+bit_vector::bit_vector(std::size_t width) : m_width(width), m_word(0) {
+    if(m_width > 64)
+        m_words.assign(word_count(), 0);
+}
+
+/**
+ * this constructor expects a string of zeros and ones, the most significant bit first.
+ * throws std::invalid_argument if the string contains anything else.
+ */
+bit_vector::bit_vector(const std::string& bits) : bit_vector(bits.length()) {
+    std::uint64_t * data = words();
+    for(std::size_t i = 0; i < m_width; i++) {
+        char c = bits[m_width - i - 1];
+        if(c == '1')
+            data[i / 64] |= std::uint64_t(1) << (i % 64);
+        else if(c != '0')
+            throw std::invalid_argument("bit_vector expects a string made of zeros and ones.");
+    }
+}
+
+    /**
+     * set
+     * sets the bit at the given position to the given value
+     */
+    void bit_vector::set(std::size_t pos, bool value) {
+        std::uint64_t mask = std::uint64_t(1) << (pos % 64);
+        if(value)
+            words()[pos / 64] |= mask;
+        else
+            words()[pos / 64] &= ~mask;
+    }
+
+    /**
+     * count
+     * returns the number of bits set
+     */
+    std::size_t bit_vector::count() const {
+        const std::uint64_t * data = words();
+        const std::size_t n = word_count();
+        std::size_t total = 0;
+        #pragma omp simd reduction(+:total)
+        for(std::size_t i = 0; i < n; i++)
+            total += __builtin_popcountll(data[i]);
+        return total;
+    }
+
+    /**
+     * compare
+     * compares both vectors as unsigned integers, returns a negative number, zero or a positive number
+     * if this vector is respectively less than, equal to or greater than the other one.
+     * throws std::invalid_argument if the widths differ.
+     */
+    int bit_vector::compare(const bit_vector& other) const {
+        check_width(other);
+        const std::uint64_t * lhs = words();
+        const std::uint64_t * rhs = other.words();
+        for(std::size_t i = word_count(); i > 0; i--) {
+            if(lhs[i - 1] != rhs[i - 1])
+                return lhs[i - 1] < rhs[i - 1] ? -1 : 1;
+        }
+        return 0;
+    }
+
+    /**
+     * bitwise operators
+     * both operands must have the same width, std::invalid_argument is thrown otherwise
+     */
+    bit_vector& bit_vector::operator&=(const bit_vector& other) {
+        check_width(other);
+        std::uint64_t * lhs = words();
+        const std::uint64_t * rhs = other.words();
+        const std::size_t n = word_count();
+        #pragma omp simd
+        for(std::size_t i = 0; i < n; i++)
+            lhs[i] &= rhs[i];
+        return * this;
+    }
+
+    bit_vector& bit_vector::operator|=(const bit_vector& other) {
+        check_width(other);
+        std::uint64_t * lhs = words();
+        const std::uint64_t * rhs = other.words();
+        const std::size_t n = word_count();
+        #pragma omp simd
+        for(std::size_t i = 0; i < n; i++)
+            lhs[i] |= rhs[i];
+        return * this;
+    }
+
+    bit_vector& bit_vector::operator^=(const bit_vector& other) {
+        check_width(other);
+        std::uint64_t * lhs = words();
+        const std::uint64_t * rhs = other.words();
+        const std::size_t n = word_count();
+        #pragma omp simd
+        for(std::size_t i = 0; i < n; i++)
+            lhs[i] ^= rhs[i];
+        return * this;
+    }
+
+    bit_vector bit_vector::operator~() const {
+        bit_vector res(* this);
+        std::uint64_t * data = res.words();
+        const std::size_t n = word_count();
+        #pragma omp simd
+        for(std::size_t i = 0; i < n; i++)
+            data[i] = ~data[i];
+        res.trim();
+        return res;
+    }
+
+    /**
+     * to_string
+     * returns the string representation of this vector, the most significant bit first
+     */
+    std::string bit_vector::to_string() const {
+        std::string bits(m_width, '0');
+        for(std::size_t i = 0; i < m_width; i++) {
+            if(test(i))
+                bits[m_width - i - 1] = '1';
+        }
+        return bits;
+    }
+
+    /**
+     * hash
+     * returns a hash of the width and the words holding the bits
+     * bits past the width are always cleared so equal vectors have equal hashes
+     */
+    std::size_t bit_vector::hash() const {
+        const std::uint64_t * data = words();
+        const std::size_t n = word_count();
+        std::size_t seed = std::hash<std::size_t>()(m_width);
+        for(std::size_t i = 0; i < n; i++)
+            seed ^= std::hash<std::uint64_t>()(data[i]) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+        return seed;
+    }
+
+    /**
+     * trim
+     * clears the bits past the width in the last word
+     */
+    void bit_vector::trim() {
+        std::size_t used = m_width % 64;
+        if(used != 0)
+            words()[word_count() - 1] &= (std::uint64_t(1) << used) - 1;
+    }
+
+    /**
+     * check_width
+     * throws std::invalid_argument if the other vector has a different width
+     */
+    void bit_vector::check_width(const bit_vector& other) const {
+        if(m_width != other.m_width)
+            throw std::invalid_argument("bit_vector operands must have the same width.");
+    }
+
+bit_vector operator&(bit_vector lhs, const bit_vector& rhs) {
+    return lhs &= rhs;
+}
+
+bit_vector operator|(bit_vector lhs, const bit_vector& rhs) {
+    return lhs |= rhs;
+}
+
+bit_vector operator^(bit_vector lhs, const bit_vector& rhs) {
+    return lhs ^= rhs;
+}
+
+bool operator==(const bit_vector& lhs, const bit_vector& rhs) {
+    return lhs.m_width == rhs.m_width && lhs.compare(rhs) == 0;
+}
+
+bool operator!=(const bit_vector& lhs, const bit_vector& rhs) {
+    return !(lhs == rhs);
+}
+}
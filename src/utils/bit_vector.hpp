@@ -0,0 +1,175 @@
+/*
+ *  This file is part of the Avalon programming language
+ * 
+ *  Copyright (c) 2018 Ntwali Bashige Toussaint
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#ifndef AVALON_UTILS_BIT_VECTOR_HPP_
+#define AVALON_UTILS_BIT_VECTOR_HPP_
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <string>
+
+
+namespace avalon {
+    /**
+     * bit_vector
+     * a bitset whose width is only known at runtime, stored as packed 64 bits words.
+     * bit 0 is the least significant bit, and the string representation starts with the most significant bit just like std::bitset.
+     * widths up to 64 bits live inside the object itself, wider vectors spill into the heap.
+     * bits past the width in the last word are always kept at zero so words can be compared and counted directly.
+     */
+    class bit_vector {
+    public:
+        /**
+         * the default constructor creates an empty bit vector
+         */
+        bit_vector();
+
+        /**
+         * this constructor creates a bit vector of the given width with all bits cleared
+         */
+        explicit bit_vector(std::size_t width);
+
+        /**
+         * this constructor expects a string of zeros and ones, the most significant bit first.
+         * throws std::invalid_argument if the string contains anything else.
+         */
+        explicit bit_vector(const std::string& bits);
+
+        /**
+         * size
+         * returns the number of bits in this vector
+         */
+        std::size_t size() const {
+            return m_width;
+        }
+
+        /**
+         * test
+         * returns the bit at the given position
+         */
+        bool test(std::size_t pos) const {
+            return (words()[pos / 64] >> (pos % 64)) & 1;
+        }
+
+        /**
+         * set
+         * sets the bit at the given position to the given value
+         */
+        void set(std::size_t pos, bool value);
+
+        /**
+         * count
+         * returns the number of bits set
+         */
+        std::size_t count() const;
+
+        /**
+         * compare
+         * compares both vectors as unsigned integers, returns a negative number, zero or a positive number
+         * if this vector is respectively less than, equal to or greater than the other one.
+         * throws std::invalid_argument if the widths differ.
+         */
+        int compare(const bit_vector& other) const;
+
+        /**
+         * bitwise operators
+         * both operands must have the same width, std::invalid_argument is thrown otherwise
+         */
+        bit_vector& operator&=(const bit_vector& other);
+        bit_vector& operator|=(const bit_vector& other);
+        bit_vector& operator^=(const bit_vector& other);
+        bit_vector operator~() const;
+
+        /**
+         * to_string
+         * returns the string representation of this vector, the most significant bit first
+         */
+        std::string to_string() const;
+
+        /**
+         * hash
+         * returns a hash of the width and the words holding the bits
+         */
+        std::size_t hash() const;
+
+        friend bool operator==(const bit_vector& lhs, const bit_vector& rhs);
+
+    private:
+        /**
+         * words
+         * returns the words holding the bits
+         */
+        std::uint64_t * words() {
+            return m_width <= 64 ? & m_word : m_words.data();
+        }
+
+        const std::uint64_t * words() const {
+            return m_width <= 64 ? & m_word : m_words.data();
+        }
+
+        /**
+         * word_count
+         * returns the number of words holding the bits
+         */
+        std::size_t word_count() const {
+            return (m_width + 63) / 64;
+        }
+
+        /**
+         * trim
+         * clears the bits past the width in the last word
+         */
+        void trim();
+
+        /**
+         * check_width
+         * throws std::invalid_argument if the other vector has a different width
+         */
+        void check_width(const bit_vector& other) const;
+
+        /*
+         * the number of bits
+         */
+        std::size_t m_width;
+
+        /*
+         * vectors of up to 64 bits are stored here
+         */
+        std::uint64_t m_word;
+
+        /*
+         * wider vectors are stored here
+         */
+        std::vector<std::uint64_t> m_words;
+    };
+
+    bit_vector operator&(bit_vector lhs, const bit_vector& rhs);
+    bit_vector operator|(bit_vector lhs, const bit_vector& rhs);
+    bit_vector operator^(bit_vector lhs, const bit_vector& rhs);
+    bool operator==(const bit_vector& lhs, const bit_vector& rhs);
+    bool operator!=(const bit_vector& lhs, const bit_vector& rhs);
+}
+
+#endif
@@ -22,6 +22,8 @@
  *  SOFTWARE.
  */
 
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <string>
 
@@ -37,7 +39,9 @@ namespace avalon {
     /**
      * the constructor expects the possible search paths where to check for files
      */
-    file_util::file_util(std::vector<std::string>& search_paths) : m_search_paths(search_paths) {        
+    file_util::file_util(std::vector<std::string>& search_paths) : m_search_paths(search_paths) {
+        for(auto it = m_search_paths.begin(); it != m_search_paths.end(); ++it)
+            m_search_key += (* it) + '\0';
     }
 
     /**
@@ -46,13 +50,12 @@ namespace avalon {
      * one of the search paths.
      */
     bool file_util::source_exists(const std::string& source_path) {
-        for(auto it = m_search_paths.begin(); it != m_search_paths.end(); ++it) {
-            fs::path p((*it) + "/" + source_path);
-            if(fs::exists(p) && fs::is_regular_file(p))
-                return true;
+        try {
+            get_source_path(source_path);
+            return true;
+        } catch(const file_not_found& err) {
+            return false;
         }
-
-        return false;
     }
 
     /**
@@ -62,13 +65,92 @@ namespace avalon {
      * in case the file was not found, throw "file_not_found" exception.
      */
     std::string file_util::get_source_path(const std::string& source_path) {
+        // every file is resolved once per process
+        std::unordered_map<std::string, std::string>& resolved = get_resolved();
+        std::string key = m_search_key + source_path;
+        auto it = resolved.find(key);
+        if(it != resolved.end())
+            return it -> second;
+
+        // the file may have been created after we listed the directories so we list them again before giving up
+        std::string abs_path = find_source_path(source_path);
+        if(abs_path.empty()) {
+            for(auto sit = m_search_paths.begin(); sit != m_search_paths.end(); ++sit)
+                get_listings().erase(fs::path((* sit) + "/" + source_path).parent_path().string());
+            abs_path = find_source_path(source_path);
+        }
+
+        if(abs_path.empty())
+            throw file_not_found("Failed to open file: <" + source_path + ">. Possible reasons: file does not exist or file is not available for reading.");
+
+        resolved.emplace(key, abs_path);
+        return abs_path;
+    }
+
+    /**
+     * clear_cache
+     * forgets every resolved source path and every directory listing.
+     * long running processes call this when files may have been added or removed since the last lookup.
+     */
+    void file_util::clear_cache() {
+        get_resolved().clear();
+        get_listings().clear();
+    }
+
+    /**
+     * find_source_path
+     * looks for the source file in the search paths using the directory listings.
+     * returns the absolute path to the file or an empty string if the file was not found.
+     */
+    std::string file_util::find_source_path(const std::string& source_path) {
         for(auto it = m_search_paths.begin(); it != m_search_paths.end(); ++it) {
             fs::path p((*it) + "/" + source_path);
-            if(fs::exists(p) && fs::is_regular_file(p)) {
+            const std::unordered_set<std::string>& files = list_directory(p.parent_path().string());
+            if(files.count(p.filename().string()) > 0)
                 return p.string();
-            }
         }
 
-        throw file_not_found("Failed to open file: <" + source_path + ">. Possible reasons: file does not exist or file is not available for reading.");
+        return "";
+    }
+
+    /**
+     * list_directory
+     * returns the names of the regular files inside the given directory, reading the directory only the first time
+     */
+    const std::unordered_set<std::string>& file_util::list_directory(const std::string& directory) {
+        std::unordered_map<std::string, std::unordered_set<std::string> >& listings = get_listings();
+        auto it = listings.find(directory);
+        if(it != listings.end())
+            return it -> second;
+
+        // directories that do not exist or that we cannot read are remembered as empty
+        std::unordered_set<std::string>& files = listings[directory];
+        boost::system::error_code ec;
+        fs::directory_iterator dit(directory, ec), end;
+        for(; !ec && dit != end; dit.increment(ec)) {
+            boost::system::error_code status_ec;
+            if(fs::is_regular_file(dit -> status(status_ec)))
+                files.insert(dit -> path().filename().string());
+        }
+
+        return files;
+    }
+
+    /**
+     * get_resolved
+     * returns the map of resolved source paths, keyed by the search paths then the path as given to us
+     */
+    std::unordered_map<std::string, std::string>& file_util::get_resolved() {
+        static std::unordered_map<std::string, std::string> resolved;
+        return resolved;
+    }
+
+    /**
+     * get_listings
+     * returns the map of directory listings, keyed by the directory path
+     */
+    std::unordered_map<std::string, std::unordered_set<std::string> >& file_util::get_listings() {
+        static std::unordered_map<std::string, std::unordered_set<std::string> > listings;
+        return listings;
     }
 }
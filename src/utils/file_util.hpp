@@ -25,6 +25,8 @@
 #ifndef AVALON_UTILS_FILE_HPP_
 #define AVALON_UTILS_FILE_HPP_
 
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <string>
 
@@ -54,11 +56,48 @@ namespace avalon {
          */
         std::string get_source_path(const std::string& source_path);
 
+        /**
+         * clear_cache
+         * forgets every resolved source path and every directory listing.
+         * long running processes call this when files may have been added or removed since the last lookup.
+         */
+        static void clear_cache();
+
     private:
+        /**
+         * find_source_path
+         * looks for the source file in the search paths using the directory listings.
+         * returns the absolute path to the file or an empty string if the file was not found.
+         */
+        std::string find_source_path(const std::string& source_path);
+
+        /**
+         * list_directory
+         * returns the names of the regular files inside the given directory, reading the directory only the first time
+         */
+        static const std::unordered_set<std::string>& list_directory(const std::string& directory);
+
+        /**
+         * get_resolved
+         * returns the map of resolved source paths, keyed by the search paths then the path as given to us
+         */
+        static std::unordered_map<std::string, std::string>& get_resolved();
+
+        /**
+         * get_listings
+         * returns the map of directory listings, keyed by the directory path
+         */
+        static std::unordered_map<std::string, std::unordered_set<std::string> >& get_listings();
+
         /**
          * a vector of possible search paths
          */
         std::vector<std::string> m_search_paths;
+
+        /**
+         * the search paths joined together, used to prefix the keys of resolved source paths
+         */
+        std::string m_search_key;
     };
 }
 
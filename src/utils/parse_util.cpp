@@ -22,8 +22,14 @@
  *  SOFTWARE.
  */
 
+#include <unordered_map>
+#include <functional>
+#include <cstddef>
 #include <memory>
 #include <vector>
+#include <cstdint>
+
+#include <sys/stat.h>
 
 /* Error */
 #include "error/error.hpp"
@@ -45,12 +51,17 @@
 /* Utils */
 #include "utils/exceptions/file_not_found.hpp"
 #include "utils/parse_util.hpp"
+#include "utils/stats.hpp"
 #include "utils/file_util.hpp"
 
 
 namespace avalon {
+    /**
+     * parse
+     * given a source path, this function calls the parser to parse
+     * then returns the resulting parsed program.
+     */
     program parse_util::parse(const std::string& source_path, std::vector<std::string>& search_paths) {
-        error error_handler(source_path);
         file_util futil(search_paths);
 
         // make sure the file given exists and the absolute path to it
@@ -61,21 +72,75 @@ namespace avalon {
             throw err;
         }
 
-        // scan the file for content
-        scanner scr(source_abs_path);
+        // if caching is disabled, we just do the work
+        if(cache_enabled() == false) {
+            std::string source;
+            {
+                phase_timer timer("scan");
+                scanner scr(source_abs_path);
+                source = scr.scan();
+            }
+            return parse_source(source_path, source);
+        }
+
+        // if the file didn't change since we last parsed it, we are done
+        std::unordered_map<std::string, cache_entry>& cache = get_cache();
+        std::string key = source_abs_path + ":" + source_path;
+        std::int64_t mtime = get_mtime(source_abs_path);
+        auto it = cache.find(key);
+        if(it != cache.end() && it -> second.m_mtime == mtime)
+            return it -> second.m_program;
+
+        // the file was touched, we only parse it again if its content actually changed
         std::string source;
-        try {
+        {
+            phase_timer timer("scan");
+            scanner scr(source_abs_path);
             source = scr.scan();
-        } catch(file_not_found err) {
-            throw err;
         }
+        std::size_t hash = std::hash<std::string>()(source);
+        if(it != cache.end() && it -> second.m_hash == hash) {
+            it -> second.m_mtime = mtime;
+            return it -> second.m_program;
+        }
+
+        // programs that fail to parse are not cached so errors are reported each time
+        program prog = parse_source(source_path, source);
+        cache_entry entry;
+        entry.m_mtime = mtime;
+        entry.m_hash = hash;
+        entry.m_program = prog;
+        cache[key] = entry;
+        return prog;
+    }
+
+    /**
+     * enable_cache
+     * when enabled, parsed programs are kept in memory and a file is only scanned, lexed and parsed again
+     * if its modification time and content changed since the last time it was parsed.
+     */
+    void parse_util::enable_cache(bool enable) {
+        cache_enabled() = enable;
+        if(enable == false)
+            get_cache().clear();
+    }
+
+    /**
+     * parse_source
+     * lexes and parses the given source text
+     */
+    program parse_util::parse_source(const std::string& source_path, const std::string& source) {
+        error error_handler(source_path);
 
         // tokenize the file
         lexer lxr(source_path, source, error_handler);
         try {
+            phase_timer lex_timer("lex");
             std::vector<std::shared_ptr<token> >& tokens = lxr.lex();
-            
+            lex_timer.stop();
+
             // parse the file
+            phase_timer parse_timer("parse");
             parser psr(tokens, source_path, error_handler);
             program prog;
             try {
@@ -88,4 +153,34 @@ namespace avalon {
             throw err;
         }
     }
+
+    /**
+     * get_mtime
+     * returns the modification time of the given file in nanoseconds.
+     * seconds are not precise enough since a file can be edited more than once within the same second.
+     */
+    std::int64_t parse_util::get_mtime(const std::string& source_abs_path) {
+        struct stat st;
+        if(::stat(source_abs_path.c_str(), &st) != 0)
+            return -1;
+        return static_cast<std::int64_t>(st.st_mtim.tv_sec) * 1000000000 + st.st_mtim.tv_nsec;
+    }
+
+    /**
+     * get_cache
+     * returns the map of cached programs, keyed by the absolute path of the file then the path as given to us
+     */
+    std::unordered_map<std::string, parse_util::cache_entry>& parse_util::get_cache() {
+        static std::unordered_map<std::string, cache_entry> cache;
+        return cache;
+    }
+
+    /**
+     * cache_enabled
+     * returns a reference to the flag telling whether parsed programs are cached
+     */
+    bool& parse_util::cache_enabled() {
+        static bool enabled = false;
+        return enabled;
+    }
 }
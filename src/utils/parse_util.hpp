@@ -25,7 +25,11 @@
 #ifndef AVALON_UTILS_PARSE_HPP_
 #define AVALON_UTILS_PARSE_HPP_
 
+#include <unordered_map>
+#include <cstddef>
 #include <string>
+#include <vector>
+#include <cstdint>
 
 #include "representer/ast/program.hpp"
 
@@ -39,6 +43,58 @@ namespace avalon {
          * then returns the resulting parsed program.
          */
         static program parse(const std::string& source_path, std::vector<std::string>& search_paths);
+
+        /**
+         * enable_cache
+         * when enabled, parsed programs are kept in memory and a file is only scanned, lexed and parsed again
+         * if its modification time and content changed since the last time it was parsed.
+         * the cached programs are handed out as is so this must only be enabled when the caller
+         * works on a private copy of them, as the server does by forking a worker per request.
+         */
+        static void enable_cache(bool enable);
+
+    private:
+        struct cache_entry {
+            /*
+             * the modification time of the file, in nanoseconds, when it was last parsed
+             */
+            std::int64_t m_mtime;
+
+            /*
+             * the hash of the content of the file when it was last parsed
+             */
+            std::size_t m_hash;
+
+            /*
+             * the program that resulted from parsing the file
+             */
+            program m_program;
+        };
+
+        /**
+         * parse_source
+         * lexes and parses the given source text
+         */
+        static program parse_source(const std::string& source_path, const std::string& source);
+
+        /**
+         * get_mtime
+         * returns the modification time of the given file in nanoseconds.
+         * seconds are not precise enough since a file can be edited more than once within the same second.
+         */
+        static std::int64_t get_mtime(const std::string& source_abs_path);
+
+        /**
+         * get_cache
+         * returns the map of cached programs, keyed by the absolute path of the file then the path as given to us
+         */
+        static std::unordered_map<std::string, cache_entry>& get_cache();
+
+        /**
+         * cache_enabled
+         * returns a reference to the flag telling whether parsed programs are cached
+         */
+        static bool& cache_enabled();
     };
 }
 
@@ -0,0 +1,210 @@
+/*
+ *  This file is part of the Avalon programming language
+ * 
+ *  Copyright (c) 2018 Ntwali Bashige Toussaint
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include <algorithm>
+#include <functional>
+#include <cstddef>
+#include <cstring>
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include "utils/shared_string.hpp"
+
+
+namespace avalon {
+/**
+ * the default constructor creates an empty string
+ * no buffer is allocated until something is appended, every literal carries an empty shared string
+ */
+shared_string::shared_string() : m_buffer(nullptr), m_offset(0), m_length(0), m_reversed(false) {
+}
+
+/**
+ * this constructor copies the given string into a new buffer
+ */
+shared_string::shared_string(const std::string& str) : m_buffer(std::make_shared<std::string>(str)), m_offset(0), m_length(str.length()), m_reversed(false) {
+}
+
+/**
+ * this constructor creates a view over memory owned by someone else, such as a memory mapped file.
+ * the memory is never written to and concatenating onto such a string copies it into a new buffer.
+ */
+shared_string::shared_string(const std::shared_ptr<const char>& data, std::size_t length) : m_buffer(nullptr), m_external(data), m_offset(0), m_length(length), m_reversed(false) {
+}
+
+    /**
+     * find
+     * returns the position of the first occurence of the given character at or after the given position, or the length of the string if there is none
+     */
+    std::size_t shared_string::find(char c, std::size_t pos) const {
+        if(pos >= m_length)
+            return m_length;
+
+        if(m_reversed) {
+            for(; pos < m_length; pos++)
+                if(at(pos) == c)
+                    return pos;
+            return m_length;
+        }
+
+        const char * start = data() + m_offset;
+        const void * found = std::memchr(start + pos, c, m_length - pos);
+        return found == nullptr ? m_length : static_cast<const char *>(found) - start;
+    }
+
+    /**
+     * substr
+     * returns a view over the given range of this string, the range is clamped to the length of the string
+     */
+    shared_string shared_string::substr(std::size_t pos, std::size_t len) const {
+        shared_string res(* this);
+        pos = std::min(pos, m_length);
+        len = std::min(len, m_length - pos);
+        res.m_offset = m_reversed ? m_offset + m_length - pos - len : m_offset + pos;
+        res.m_length = len;
+        return res;
+    }
+
+    /**
+     * reversed
+     * returns a view over this string that reads it backwards
+     */
+    shared_string shared_string::reversed() const {
+        shared_string res(* this);
+        res.m_reversed = !m_reversed;
+        return res;
+    }
+
+    /**
+     * concat
+     * returns the concatenation of both strings, appending to the buffer of the first one when possible
+     */
+    shared_string shared_string::concat(const shared_string& lhs, const shared_string& rhs) {
+        if(rhs.m_length == 0)
+            return lhs;
+        if(lhs.m_length == 0)
+            return rhs;
+
+        shared_string res(lhs);
+        res.m_length = lhs.m_length + rhs.m_length;
+
+        // if nothing was appended after the left string, its buffer can grow in place
+        // std::string grows geometrically so appending costs amortized constant time per character
+        if(lhs.m_buffer != nullptr && lhs.m_reversed == false && lhs.m_offset + lhs.m_length == lhs.m_buffer -> length()) {
+            if(rhs.m_reversed == false && rhs.m_buffer != lhs.m_buffer)
+                res.m_buffer -> append(rhs.data() + rhs.m_offset, rhs.m_length);
+            else
+                res.m_buffer -> append(rhs.str());
+            return res;
+        }
+
+        // otherwise we start a new buffer
+        std::shared_ptr<std::string> buffer = std::make_shared<std::string>();
+        buffer -> reserve(res.m_length);
+        buffer -> append(lhs.str());
+        buffer -> append(rhs.str());
+        res.m_buffer = buffer;
+        res.m_external = nullptr;
+        res.m_offset = 0;
+        res.m_reversed = false;
+        return res;
+    }
+
+    /**
+     * str
+     * returns a copy of this string as a contiguous std::string
+     */
+    std::string shared_string::str() const {
+        if(m_length == 0)
+            return std::string();
+
+        std::string res(data() + m_offset, m_length);
+        if(m_reversed)
+            std::reverse(res.begin(), res.end());
+        return res;
+    }
+
+    /**
+     * copy
+     * copies at most count characters starting at the given position into dest and returns the number of characters copied
+     */
+    std::size_t shared_string::copy(char * dest, std::size_t count, std::size_t pos) const {
+        if(pos >= m_length)
+            return 0;
+
+        count = std::min(count, m_length - pos);
+        if(m_reversed) {
+            for(std::size_t i = 0; i < count; i++)
+                dest[i] = at(pos + i);
+        }
+        else {
+            std::memcpy(dest, data() + m_offset + pos, count);
+        }
+        return count;
+    }
+
+    /**
+     * compare
+     * compares both strings character by character like std::string::compare does
+     */
+    int shared_string::compare(const shared_string& other) const {
+        std::size_t common = std::min(m_length, other.m_length);
+        if(m_reversed == false && other.m_reversed == false) {
+            int res = common == 0 ? 0 : std::memcmp(data() + m_offset, other.data() + other.m_offset, common);
+            if(res != 0)
+                return res;
+        }
+        else {
+            for(std::size_t i = 0; i < common; i++) {
+                unsigned char lhs = at(i), rhs = other.at(i);
+                if(lhs != rhs)
+                    return lhs < rhs ? -1 : 1;
+            }
+        }
+
+        if(m_length == other.m_length)
+            return 0;
+        return m_length < other.m_length ? -1 : 1;
+    }
+
+    /**
+     * hash
+     * returns the same hash std::hash<std::string> would return for this string
+     */
+    std::size_t shared_string::hash() const {
+        std::hash<std::string> hasher;
+        if(m_buffer != nullptr && m_reversed == false && m_offset == 0 && m_length == m_buffer -> length())
+            return hasher(* m_buffer);
+        return hasher(str());
+    }
+
+bool operator==(const shared_string& lhs, const shared_string& rhs) {
+    return lhs.length() == rhs.length() && lhs.compare(rhs) == 0;
+}
+
+bool operator!=(const shared_string& lhs, const shared_string& rhs) {
+    return !(lhs == rhs);
+}
+}
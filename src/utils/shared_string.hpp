@@ -0,0 +1,159 @@
+/*
+ *  This file is part of the Avalon programming language
+ * 
+ *  Copyright (c) 2018 Ntwali Bashige Toussaint
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#ifndef AVALON_UTILS_SHARED_STRING_HPP_
+#define AVALON_UTILS_SHARED_STRING_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+
+namespace avalon {
+    /**
+     * shared_string
+     * an immutable string that is a view over a reference counted buffer.
+     * concatenating onto a string whose view ends where its buffer ends appends to the buffer in place,
+     * so building a string with repeated "+" costs amortized constant time per character instead of copying the whole prefix every time.
+     * earlier views never see the appended characters since they only look at their own range.
+     * substrings and reversed strings are views over the same buffer and are only copied out when a contiguous std::string is needed.
+     */
+    class shared_string {
+    public:
+        /**
+         * the default constructor creates an empty string
+         */
+        shared_string();
+
+        /**
+         * this constructor copies the given string into a new buffer
+         */
+        explicit shared_string(const std::string& str);
+
+        /**
+         * this constructor creates a view over memory owned by someone else, such as a memory mapped file.
+         * the memory is never written to and concatenating onto such a string copies it into a new buffer.
+         */
+        shared_string(const std::shared_ptr<const char>& data, std::size_t length);
+
+        /**
+         * length
+         * returns the number of characters in this string
+         */
+        std::size_t length() const {
+            return m_length;
+        }
+
+        /**
+         * at
+         * returns the character at the given position
+         */
+        char at(std::size_t pos) const {
+            return data()[m_reversed ? m_offset + m_length - 1 - pos : m_offset + pos];
+        }
+
+        /**
+         * find
+         * returns the position of the first occurence of the given character at or after the given position, or the length of the string if there is none
+         */
+        std::size_t find(char c, std::size_t pos) const;
+
+        /**
+         * substr
+         * returns a view over the given range of this string, the range is clamped to the length of the string
+         */
+        shared_string substr(std::size_t pos, std::size_t len) const;
+
+        /**
+         * reversed
+         * returns a view over this string that reads it backwards
+         */
+        shared_string reversed() const;
+
+        /**
+         * concat
+         * returns the concatenation of both strings, appending to the buffer of the first one when possible
+         */
+        static shared_string concat(const shared_string& lhs, const shared_string& rhs);
+
+        /**
+         * str
+         * returns a copy of this string as a contiguous std::string
+         */
+        std::string str() const;
+
+        /**
+         * copy
+         * copies at most count characters starting at the given position into dest and returns the number of characters copied
+         */
+        std::size_t copy(char * dest, std::size_t count, std::size_t pos) const;
+
+        /**
+         * compare
+         * compares both strings character by character like std::string::compare does
+         */
+        int compare(const shared_string& other) const;
+
+        /**
+         * hash
+         * returns the same hash std::hash<std::string> would return for this string
+         */
+        std::size_t hash() const;
+
+    private:
+        /**
+         * data
+         * returns the start of the memory this string is a view of
+         */
+        const char * data() const {
+            return m_external != nullptr ? m_external.get() : m_buffer -> data();
+        }
+
+        /*
+         * the buffer this string is a view of, shared with the strings it was built from
+         */
+        std::shared_ptr<std::string> m_buffer;
+
+        /*
+         * read only memory this string is a view of instead of a buffer
+         */
+        std::shared_ptr<const char> m_external;
+
+        /*
+         * the range of the buffer this string covers
+         */
+        std::size_t m_offset;
+        std::size_t m_length;
+
+        /*
+         * whether this string reads the range backwards
+         */
+        bool m_reversed;
+    };
+
+    bool operator==(const shared_string& lhs, const shared_string& rhs);
+    bool operator!=(const shared_string& lhs, const shared_string& rhs);
+}
+
+#endif
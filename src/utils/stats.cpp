@@ -0,0 +1,249 @@
+/*
+ *  This file is part of the Avalon programming language
+ * 
+ *  Copyright (c) 2018 Ntwali Bashige Toussaint
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <cstdint>
+#include <cstddef>
+#include <chrono>
+#include <vector>
+#include <string>
+
+#include <sys/resource.h>
+#include <sys/time.h>
+
+#include "utils/stats.hpp"
+
+
+namespace avalon {
+/**
+ * wall_time
+ * returns a monotonic time in seconds
+ */
+static double wall_time() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * cpu_time_and_rss
+ * returns the user plus system time of the process in seconds and its peak resident set size in kilobytes
+ */
+static double cpu_time_and_rss(long& rss) {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    rss = usage.ru_maxrss;
+    return usage.ru_utime.tv_sec + usage.ru_utime.tv_usec / 1e6 + usage.ru_stime.tv_sec + usage.ru_stime.tv_usec / 1e6;
+}
+
+/**
+ * phase stats
+ */
+phase_stats::phase_stats(const std::string& name) : m_name(name), m_wall(0), m_cpu(0), m_rss(0), m_tokens(0), m_nodes(0), m_specializations(0) {
+}
+
+
+/**
+ * stats
+ */
+stats::stats() : m_enabled(false), m_tokens(0), m_nodes(0), m_specializations(0), m_programs(0), m_start_wall(0), m_start_cpu(0), m_start_rss(0), m_start_tokens(0), m_start_nodes(0), m_start_specializations(0) {
+}
+
+    /**
+     * enable
+     * turns on the collection of per phase statistics
+     */
+    void stats::enable() {
+        get_instance().m_enabled = true;
+    }
+
+    /**
+     * is_enabled
+     * returns true if statistics are being collected
+     */
+    bool stats::is_enabled() {
+        return get_instance().m_enabled;
+    }
+
+    /**
+     * begin
+     * starts the phase with the given name, pausing the phase that was running if any
+     */
+    void stats::begin(const std::string& name) {
+        stats& st = get_instance();
+        st.close_segment();
+
+        // find the phase or add it if this is the first time it runs
+        std::size_t index = 0;
+        for(; index < st.m_phases.size(); index++)
+            if(st.m_phases[index].m_name == name)
+                break;
+        if(index == st.m_phases.size())
+            st.m_phases.emplace_back(name);
+
+        st.m_stack.push_back(index);
+        st.snapshot();
+    }
+
+    /**
+     * end
+     * ends the phase that was started last and resumes the one it interrupted if any
+     */
+    void stats::end() {
+        stats& st = get_instance();
+        st.close_segment();
+        if(st.m_stack.empty() == false)
+            st.m_stack.pop_back();
+        st.snapshot();
+    }
+
+    /**
+     * set_programs
+     * records the number of programs in the global symbol table
+     */
+    void stats::set_programs(std::size_t programs) {
+        get_instance().m_programs = programs;
+    }
+
+    /**
+     * report
+     * prints the statistics collected so far, either in human readable form or as json
+     */
+    void stats::report(std::ostream& os, bool json) {
+        stats& st = get_instance();
+        phase_stats total("total");
+        for(auto& phase : st.m_phases) {
+            total.m_wall += phase.m_wall;
+            total.m_cpu += phase.m_cpu;
+            total.m_rss += phase.m_rss;
+            total.m_tokens += phase.m_tokens;
+            total.m_nodes += phase.m_nodes;
+            total.m_specializations += phase.m_specializations;
+        }
+
+        std::ios::fmtflags flags = os.flags();
+        std::streamsize precision = os.precision();
+        os << std::fixed << std::setprecision(6);
+
+        if(json) {
+            os << "{\"phases\": [";
+            for(std::size_t i = 0; i < st.m_phases.size(); i++) {
+                phase_stats& phase = st.m_phases[i];
+                os << (i == 0 ? "" : ", ")
+                   << "{\"name\": \"" << phase.m_name << "\""
+                   << ", \"wall\": " << phase.m_wall
+                   << ", \"cpu\": " << phase.m_cpu
+                   << ", \"rss_kb\": " << phase.m_rss
+                   << ", \"tokens\": " << phase.m_tokens
+                   << ", \"nodes\": " << phase.m_nodes
+                   << ", \"specializations\": " << phase.m_specializations << "}";
+            }
+            os << "], \"wall\": " << total.m_wall
+               << ", \"cpu\": " << total.m_cpu
+               << ", \"rss_kb\": " << total.m_rss
+               << ", \"tokens\": " << total.m_tokens
+               << ", \"nodes\": " << total.m_nodes
+               << ", \"specializations\": " << total.m_specializations
+               << ", \"programs\": " << st.m_programs << "}" << std::endl;
+        }
+        else {
+            os << std::left << std::setw(12) << "phase" << std::right
+               << std::setw(12) << "wall (s)" << std::setw(12) << "cpu (s)" << std::setw(12) << "rss (kB)"
+               << std::setw(12) << "tokens" << std::setw(12) << "nodes" << std::setw(18) << "specializations" << std::endl;
+            st.m_phases.push_back(total);
+            for(auto& phase : st.m_phases) {
+                os << std::left << std::setw(12) << phase.m_name << std::right
+                   << std::setw(12) << phase.m_wall << std::setw(12) << phase.m_cpu << std::setw(12) << phase.m_rss
+                   << std::setw(12) << phase.m_tokens << std::setw(12) << phase.m_nodes << std::setw(18) << phase.m_specializations << std::endl;
+            }
+            st.m_phases.pop_back();
+            os << "programs in the global symbol table: " << st.m_programs << std::endl;
+        }
+
+        os.flags(flags);
+        os.precision(precision);
+    }
+
+    /**
+     * get_instance
+     * returns the only stats instance
+     */
+    stats& stats::get_instance() {
+        static stats instance;
+        return instance;
+    }
+
+    /**
+     * snapshot
+     * records the current time, memory and counters as the start of a new segment
+     */
+    void stats::snapshot() {
+        m_start_wall = wall_time();
+        m_start_cpu = cpu_time_and_rss(m_start_rss);
+        m_start_tokens = m_tokens;
+        m_start_nodes = m_nodes;
+        m_start_specializations = m_specializations;
+    }
+
+    /**
+     * close_segment
+     * attributes everything since the last snapshot to the phase on top of the stack
+     */
+    void stats::close_segment() {
+        if(m_stack.empty())
+            return;
+
+        long rss = 0;
+        double cpu = cpu_time_and_rss(rss);
+        phase_stats& phase = m_phases[m_stack.back()];
+        phase.m_wall += wall_time() - m_start_wall;
+        phase.m_cpu += cpu - m_start_cpu;
+        phase.m_rss += rss - m_start_rss;
+        phase.m_tokens += m_tokens - m_start_tokens;
+        phase.m_nodes += m_nodes - m_start_nodes;
+        phase.m_specializations += m_specializations - m_start_specializations;
+    }
+
+
+/**
+ * phase timer
+ */
+phase_timer::phase_timer(const std::string& name) : m_started(stats::is_enabled()) {
+    if(m_started)
+        stats::begin(name);
+}
+
+phase_timer::~phase_timer() {
+    stop();
+}
+
+    /**
+     * stop
+     * ends the phase before the timer goes out of scope
+     */
+    void phase_timer::stop() {
+        if(m_started)
+            stats::end();
+        m_started = false;
+    }
+}
@@ -0,0 +1,219 @@
+/*
+ *  This file is part of the Avalon programming language
+ * 
+ *  Copyright (c) 2018 Ntwali Bashige Toussaint
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#ifndef AVALON_UTILS_STATS_HPP_
+#define AVALON_UTILS_STATS_HPP_
+
+#include <cstdint>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+#include <string>
+
+
+namespace avalon {
+    /**
+     * phase_stats
+     * the resources consumed by one compiler phase and the objects created while it was running
+     */
+    struct phase_stats {
+        phase_stats(const std::string& name);
+
+        /*
+         * the name of the phase
+         */
+        std::string m_name;
+
+        /*
+         * the wall clock and cpu time spent in the phase, in seconds
+         */
+        double m_wall;
+        double m_cpu;
+
+        /*
+         * how much the peak resident set size grew while in the phase, in kilobytes
+         */
+        long m_rss;
+
+        /*
+         * the number of tokens, ast nodes and function specializations created while in the phase
+         */
+        std::uint64_t m_tokens;
+        std::uint64_t m_nodes;
+        std::uint64_t m_specializations;
+    };
+
+    /**
+     * stats
+     * collects per phase timing, memory and object counts when enabled with "--stats".
+     * phases nest: time spent in a phase started from within another one is only attributed to the inner phase.
+     * the object counters are always updated since a plain increment is cheaper than checking whether we should.
+     */
+    class stats {
+    public:
+        /**
+         * enable
+         * turns on the collection of per phase statistics
+         */
+        static void enable();
+
+        /**
+         * is_enabled
+         * returns true if statistics are being collected
+         */
+        static bool is_enabled();
+
+        /**
+         * begin
+         * starts the phase with the given name, pausing the phase that was running if any
+         */
+        static void begin(const std::string& name);
+
+        /**
+         * end
+         * ends the phase that was started last and resumes the one it interrupted if any
+         */
+        static void end();
+
+        /**
+         * count_token
+         * records the creation of a token
+         */
+        static void count_token() {
+            get_instance().m_tokens++;
+        }
+
+        /**
+         * count_node
+         * records the creation of a declaration, statement or expression
+         */
+        static void count_node() {
+            get_instance().m_nodes++;
+        }
+
+        /**
+         * count_specialization
+         * records the generation of a function specialization
+         */
+        static void count_specialization() {
+            get_instance().m_specializations++;
+        }
+
+        /**
+         * get_objects
+         * returns the number of tokens and ast nodes created so far
+         */
+        static std::uint64_t get_objects() {
+            stats& st = get_instance();
+            return st.m_tokens + st.m_nodes;
+        }
+
+        /**
+         * set_programs
+         * records the number of programs in the global symbol table
+         */
+        static void set_programs(std::size_t programs);
+
+        /**
+         * report
+         * prints the statistics collected so far, either in human readable form or as json
+         */
+        static void report(std::ostream& os, bool json);
+
+    private:
+        stats();
+
+        /**
+         * get_instance
+         * returns the only stats instance
+         */
+        static stats& get_instance();
+
+        /**
+         * snapshot
+         * records the current time, memory and counters as the start of a new segment
+         */
+        void snapshot();
+
+        /**
+         * close_segment
+         * attributes everything since the last snapshot to the phase on top of the stack
+         */
+        void close_segment();
+
+        /*
+         * whether statistics are being collected
+         */
+        bool m_enabled;
+
+        /*
+         * the phases in the order they first ran
+         */
+        std::vector<phase_stats> m_phases;
+
+        /*
+         * the indices into m_phases of the phases that are running, innermost last
+         */
+        std::vector<std::size_t> m_stack;
+
+        /*
+         * the object counters
+         */
+        std::uint64_t m_tokens;
+        std::uint64_t m_nodes;
+        std::uint64_t m_specializations;
+        std::size_t m_programs;
+
+        /*
+         * the state of things at the start of the current segment
+         */
+        double m_start_wall;
+        double m_start_cpu;
+        long m_start_rss;
+        std::uint64_t m_start_tokens;
+        std::uint64_t m_start_nodes;
+        std::uint64_t m_start_specializations;
+    };
+
+    /**
+     * phase_timer
+     * starts a phase on construction and ends it on destruction, doing nothing if statistics are disabled
+     */
+    class phase_timer {
+    public:
+        phase_timer(const std::string& name);
+        ~phase_timer();
+
+        /**
+         * stop
+         * ends the phase before the timer goes out of scope
+         */
+        void stop();
+
+    private:
+        bool m_started;
+    };
+}
+
+#endif